@@ -5,6 +5,8 @@
 #include <carl-common/meta/SFINAE.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <iterator>
 #include <variant>
 #include <vector>
 
@@ -135,6 +137,9 @@ public:
 		mAddedSinceCompact = 0;
 	}
 	bool has(Variable var) const {
+		if (mAddedSinceCompact == 0) {
+			return std::binary_search(mVariables.begin(), mVariables.end(), var);
+		}
 		return std::find(mVariables.begin(), mVariables.end(), var) != mVariables.end();
 	}
 
@@ -199,6 +204,85 @@ public:
 	}
 };
 
+/**
+ * An immutable summary of the variables occurring in some object, meant to be computed once and cached.
+ * It stores the variables as a sorted array together with a 64 bit fingerprint in which variable `v` sets bit `v.id() % 64`.
+ * Membership and intersection queries are first checked against the fingerprints, hence most negative answers are given by a single word operation.
+ */
+class VariableSignature {
+	/// The sorted variables, compacted upon construction.
+	carlVariables mVariables;
+	/// Fingerprint of mVariables.
+	std::uint64_t mFingerprint = 0;
+
+	static std::uint64_t fingerprint(Variable v) {
+		return std::uint64_t(1) << (v.id() % 64);
+	}
+public:
+	VariableSignature() = default;
+	explicit VariableSignature(carlVariables&& vars): mVariables(std::move(vars)) {
+		// as_vector() compacts the variables once, hence the const accessors below never modify them and may be used concurrently.
+		for (auto v: mVariables.as_vector()) {
+			mFingerprint |= fingerprint(v);
+		}
+	}
+
+	/// Returns the variables as carlVariables.
+	const carlVariables& variables() const {
+		return mVariables;
+	}
+	auto begin() const {
+		return mVariables.as_vector().begin();
+	}
+	auto end() const {
+		return mVariables.as_vector().end();
+	}
+	bool empty() const {
+		return mFingerprint == 0;
+	}
+	std::size_t size() const {
+		return mVariables.as_vector().size();
+	}
+	/// Checks whether the given variable occurs.
+	bool has(Variable v) const {
+		return (mFingerprint & fingerprint(v)) != 0 && mVariables.has(v);
+	}
+	/// Checks whether any variable occurs in both signatures.
+	bool intersects(const VariableSignature& rhs) const {
+		if ((mFingerprint & rhs.mFingerprint) == 0) return false;
+		auto lit = begin();
+		auto rit = rhs.begin();
+		while (lit != end() && rit != rhs.end()) {
+			if (*lit < *rit) ++lit;
+			else if (*rit < *lit) ++rit;
+			else return true;
+		}
+		return false;
+	}
+	/// Adds all variables that occur in both signatures to vars.
+	void intersection(const VariableSignature& rhs, carlVariables& vars) const {
+		if ((mFingerprint & rhs.mFingerprint) == 0) return;
+		std::vector<Variable> res;
+		std::set_intersection(begin(), end(), rhs.begin(), rhs.end(), std::back_inserter(res));
+		vars.add(res.begin(), res.end());
+	}
+	/// Checks whether all variables also occur in rhs.
+	bool is_subset_of(const VariableSignature& rhs) const {
+		if ((mFingerprint & ~rhs.mFingerprint) != 0) return false;
+		return std::includes(rhs.begin(), rhs.end(), begin(), end());
+	}
+	friend bool operator==(const VariableSignature& lhs, const VariableSignature& rhs) {
+		return lhs.mFingerprint == rhs.mFingerprint && lhs.mVariables == rhs.mVariables;
+	}
+	friend std::ostream& operator<<(std::ostream& os, const VariableSignature& sig) {
+		return os << sig.mVariables;
+	}
+};
+
+inline void variables(const VariableSignature& sig, carlVariables& vars) {
+	vars.add(sig.begin(), sig.end());
+}
+
 inline void swap(Variable& lhs, Variable& rhs) {
 	auto tmp = lhs;
 	lhs = rhs;
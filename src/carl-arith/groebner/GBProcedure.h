@@ -6,8 +6,10 @@
  */
 
 #pragma once
+#include "GBSettings.h"
 #include "Ideal.h"
 #include "Reductor.h"
+#include "gb-buchberger/BuchbergerStats.h"
 #include <carl-logging/carl-logging.h>
 #include <carl-common/datastructures/BitVector.h>
 
@@ -39,6 +41,8 @@ class AbstractGBProcedure
  * Only upon calling the calculate method, these polynoimials are added to the actual groebner basis.
  * 
  * Moreover, we can 
+ * 
+ * The selection strategy and the criteria for critical pairs can be changed at runtime via setSettings().
  * @ingroup gb 
  */
 template<typename Polynomial, template<typename, template<typename> class > class Procedure, template<typename> class AddingPolynomialPolicy>
@@ -88,6 +92,7 @@ public:
 		mOrigGeneratorsIndices = rhs.mOrigGeneratorsIndices;
 		Procedure<Polynomial, AddingPolynomialPolicy>::setIdeal(mGb);
         Procedure<Polynomial, AddingPolynomialPolicy>::setCriticalPairs(rhs.pCritPairs);
+		Procedure<Polynomial, AddingPolynomialPolicy>::setSettings(rhs.getSettings());
 		return *this;
 	}
 	
@@ -100,6 +105,23 @@ public:
 		return mInputScheduled.empty();
 	}
 
+	/**
+	 * Sets the selection strategy and the pair criteria used by the next calls to calculate.
+	 * @param settings The new settings.
+	 */
+	void setSettings(const GBSettings& settings)
+	{
+		Procedure<Polynomial, AddingPolynomialPolicy>::setSettings(settings);
+	}
+
+	/**
+	 * @return The current settings.
+	 */
+	const GBSettings& getSettings() const
+	{
+		return Procedure<Polynomial, AddingPolynomialPolicy>::getSettings();
+	}
+
 	/**
 	 * The number of polynomials which were originally added to the GB.
      * @return number of polynomials added.
@@ -216,6 +238,7 @@ public:
 	std::list<std::pair<BitVector, BitVector> > reduceInput()
 	{
 		CARL_LOG_TRACE("carl.gb.gbproc", "Reduce input");
+		auto start = statistics::Timer::start();
 		std::vector<Polynomial> toBeReduced;
 		//We only schedule "new" input for reduction
 		for(typename std::list<Polynomial>::const_iterator it = mInputScheduled.begin(); it != mInputScheduled.end(); ++it)
@@ -254,12 +277,14 @@ public:
 			}
 		}
 
+		if(BuchbergerStats::active()) BuchbergerStats::getInstance()->timeReduceInput.finish(start);
 		return result;
 	}
 private:
 
 	void reduceGB()
 	{
+		auto start = statistics::Timer::start();
 		for(size_t i = 0; i < mGb->nrGenerators(); ++i)
 		{
 			bool divisible = false;
@@ -300,6 +325,7 @@ private:
 
 		mGb = reduced;
         Procedure<Polynomial, AddingPolynomialPolicy>::setIdeal(mGb);
+		if(BuchbergerStats::active()) BuchbergerStats::getInstance()->timeInterreduction.finish(start);
 	}
 };
 }
@@ -0,0 +1,48 @@
+/**
+ * @file   GBSettings.h
+ * @ingroup gb
+ */
+
+#pragma once
+
+#include <ostream>
+
+namespace carl
+{
+
+/**
+ * The strategy that determines which critical pair is processed next.
+ * @ingroup gb
+ */
+enum class GBSelectionStrategy {
+	/// The pair with the smallest lcm with respect to the monomial ordering.
+	Normal,
+	/// The pair with the smallest sugar degree, ties are broken by the normal strategy.
+	Sugar,
+	/// The pair with the smallest total degree of the lcm, ties are broken by the age of the pair.
+	Degree
+};
+
+inline std::ostream& operator<<(std::ostream& os, GBSelectionStrategy s) {
+	switch (s) {
+		case GBSelectionStrategy::Normal: return os << "normal";
+		case GBSelectionStrategy::Sugar: return os << "sugar";
+		case GBSelectionStrategy::Degree: return os << "degree";
+	}
+	return os << "unknown";
+}
+
+/**
+ * Runtime settings of a Groebner basis procedure, such that it can be tuned per workload.
+ * @ingroup gb
+ */
+struct GBSettings
+{
+	GBSelectionStrategy selection = GBSelectionStrategy::Normal;
+	/// Skip pairs whose leading monomials are coprime (Buchberger's first criterion).
+	bool productCriterion = true;
+	/// Skip pairs whose lcm is a multiple of the lcm of other pairs (Buchberger's second criterion in the Gebauer-Moeller formulation).
+	bool chainCriterion = true;
+};
+
+}
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "../poly/umvpoly/functions/SeparablePart.h"
+#include "gb-buchberger/BuchbergerStats.h"
 
 namespace carl
 {
@@ -73,9 +74,7 @@ public:
 		{
 			assert(!p.is_constant());
 			Polynomial q(carl::separable_part(*p.lmon()));
-#ifdef BUCHBERGER_STATISTICS
-			if(q.lterm().tdeg() != p.lterm().tdeg()) mStats->SingleTermSFP();
-#endif
+			if(BuchbergerStats::active() && q.lterm().tdeg() != p.lterm().tdeg()) BuchbergerStats::getInstance()->SingleTermSFP();
 			q.setReasons(p.getReasons());
 			size_t index = gb->addGenerator(q);
 			(*update)(index);
@@ -84,9 +83,7 @@ public:
 		{
 			if(p.has_constant_term())
 			{
-#ifdef BUCHBERGER_STATISTICS
-				if(p.nrOfTerms() > 1) mStats->TSQWithConstant();
-#endif
+				if(BuchbergerStats::active() && p.nr_terms() > 1) BuchbergerStats::getInstance()->TSQWithConstant();
 				gb->clear();
 				Polynomial q(1);
 				q.setReasons(p.getReasons());
@@ -95,16 +92,12 @@ public:
 			}
 			else
 			{
-#ifdef BUCHBERGER_STATISTICS
-				mStats->TSQWithoutConstant();
-#endif
+				if(BuchbergerStats::active()) BuchbergerStats::getInstance()->TSQWithoutConstant();
 				Polynomial remainder(p);
 				while(!carl::is_zero(remainder))
 				{
 					Polynomial r1(carl::separable_part(*remainder.lmon()));
-#ifdef BUCHBERGER_STATISTICS
-					if(remainder.lterm().tdeg() != r1.lterm().tdeg()) mStats->SingleTermSFP();
-#endif
+					if(BuchbergerStats::active() && remainder.lterm().tdeg() != r1.lterm().tdeg()) BuchbergerStats::getInstance()->SingleTermSFP();
 					r1.setReasons(p.getReasons());
 					remainder.strip_lterm();
 					size_t index = gb->addGenerator(r1);
@@ -114,9 +107,7 @@ public:
 		}
 		else if(p.is_reducible_identity())
 		{
-#ifdef BUCHBERGER_STATISTICS
-			mStats->ReducibleIdentity();
-#endif
+			if(BuchbergerStats::active()) BuchbergerStats::getInstance()->ReducibleIdentity();
 			Polynomial r;
 			CARL_LOG_NOTIMPLEMENTED();
 			//Polynomial r(p.getReducibleIdentity());
@@ -24,6 +24,7 @@ class ReductorConfiguration
 {
 public:
 
+	using PolynomialType = Polynomial;
 	using EntryType = ReductorEntry<Polynomial>;
 	using Entry = EntryType*;
 	using CompareResult = carl::CompareResult;
@@ -77,6 +78,7 @@ private:
 	Datastructure<Configuration<InputPolynomial>> mDatastruct;
 	std::vector<Term<Coeff>> mRemainder;
 	bool mReductionOccured;
+	std::size_t mReductionSteps = 0;
 	BitVector mReasons;
 public:
 	Reductor(const Ideal<PolynomialInIdeal>& ideal, const InputPolynomial& f) :
@@ -146,6 +148,7 @@ public:
 			if(divres.success())
 			{
 				mReductionOccured = true;
+				++mReductionSteps;
 				if(PolynomialInIdeal::Policy::has_reasons)
 				{
 					mReasons.calculateUnion(divres.mDivisor->getReasons());
@@ -174,6 +177,15 @@ public:
 		return mReductionOccured;
 	}
 
+	/**
+	 * Gets the number of reduction steps, that is the number of leading terms cancelled by some divisor.
+	 * @return the number of reduction steps
+	 */
+	std::size_t reductionSteps() const
+	{
+		return mReductionSteps;
+	}
+
 	/**
 	 * Uses the ideal to reduce a polynomial as far as possible.
 	 * @return 
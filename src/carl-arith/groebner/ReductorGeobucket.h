@@ -0,0 +1,100 @@
+/**
+ * @file   ReductorGeobucket.h
+ * @ingroup gb
+ */
+
+#pragma once
+
+#include <carl-arith/poly/umvpoly/Geobucket.h>
+
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * A Geobucket as alternative to carl::Heap for the data structure of the Reductor,
+ * which pays off if the polynomials in the ideal have many terms.
+ *
+ * Instead of keeping one entry per inserted multiple, whose terms are generated one by one,
+ * every inserted multiple is expanded and merged into a Geobucket right away.
+ * The entries handed out by top() only consist of the combined leading term,
+ * hence decreaseTop() is never required.
+ *
+ * Like carl::Heap, the data structure takes ownership of the pushed entries,
+ * while entries that were returned by top() and removed by pop() are deleted by the caller.
+ * @ingroup gb
+ */
+template<class Configuration>
+class ReductorGeobucket
+{
+public:
+	using Entry = typename Configuration::Entry;
+	using EntryType = typename Configuration::EntryType;
+	using Polynomial = typename Configuration::PolynomialType;
+private:
+	Geobucket<Polynomial> mBucket;
+	/// The entry for the current leading term, nullptr if it was not requested yet.
+	mutable Entry mTop = nullptr;
+public:
+	explicit ReductorGeobucket(const Configuration& /*conf*/)
+	{
+	}
+
+	ReductorGeobucket(const ReductorGeobucket&) = delete;
+	ReductorGeobucket& operator=(const ReductorGeobucket&) = delete;
+
+	~ReductorGeobucket()
+	{
+		delete mTop;
+	}
+
+	bool empty() const
+	{
+		return mBucket.empty();
+	}
+
+	Entry top() const
+	{
+		if(mTop == nullptr) mTop = new EntryType(mBucket.lterm());
+		return mTop;
+	}
+
+	void pop()
+	{
+		mBucket.strip_lterm();
+		// The caller owns the entry returned by top().
+		mTop = nullptr;
+	}
+
+	void push(Entry entry)
+	{
+		invalidateTop();
+		const auto& tail = entry->getTail();
+		tail.makeOrdered();
+		std::vector<Term<typename Polynomial::CoeffType>> terms;
+		terms.reserve(tail.nr_terms() + 1);
+		for(const auto& t : tail)
+		{
+			terms.push_back(entry->getMultiple() * t);
+		}
+		terms.push_back(entry->getLead());
+		mBucket.add(std::move(terms));
+		delete entry;
+	}
+
+	void decreaseTop(Entry /*entry*/)
+	{
+		// Entries returned by top() have no tail.
+		assert(false);
+	}
+
+private:
+	void invalidateTop()
+	{
+		delete mTop;
+		mTop = nullptr;
+	}
+};
+
+}
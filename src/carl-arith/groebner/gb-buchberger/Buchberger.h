@@ -9,12 +9,13 @@
  */
 
 #pragma once
-//#define BUCHBERGER_STATISTICS
 
 
+#include "../GBSettings.h"
 #include "../GBUpdateProcedures.h"
 #include "../Ideal.h"
 #include "../Reductor.h"
+#include "BuchbergerStats.h"
 #include "CriticalPairs.h"
 
 #include <list>
@@ -57,6 +58,8 @@ struct DefaultBuchbergerSettings
 /**
  * Gebauer and Moeller style implementation of the Buchberger algorithm. For more information about this Algorithm.
  * More information can be found in the Bachelor Thesis On Groebner Bases in SMT-Compliant Decision Procedures. 
+ * The selection strategy and the pair criteria are configured at runtime via GBSettings.
+ * If BuchbergerStats are enabled, every call records its events there.
  * @ingroup gb
  */
 template<typename Polynomial, template<typename> class AddingPolicy>
@@ -68,9 +71,15 @@ protected:
 	std::vector<size_t> mGbElementsIndices;
     std::shared_ptr<CritPairs> pCritPairs;
 	UpdateFnct<Buchberger<Polynomial, AddingPolicy>> mUpdateCallBack;
-#ifdef BUCHBERGER_STATISTICS
-	BuchbergerStats* mStats;
-#endif
+	GBSettings mSettings;
+	/// The sugar degree of the generators, indexed like the generators of the ideal. Zero if unknown.
+	std::vector<std::size_t> mSugar;
+	/// The sugar degree of the polynomial which is currently added to the ideal.
+	std::size_t mPendingSugar = 0;
+	/// The number of pairs created so far, used as age of the pairs.
+	std::size_t mPairCounter = 0;
+	/// The statistics of the current call to calculate(), nullptr if they are disabled.
+	BuchbergerStats* mStats = nullptr;
 
 
 public:
@@ -89,7 +98,10 @@ public:
 		pGb(new Ideal<Polynomial>(*rhs.pGb)),
 		mGbElementsIndices(rhs.mGbElementsIndices),
 		pCritPairs(new CritPairs(*rhs.pCritPairs)),
-		mUpdateCallBack(this)
+		mUpdateCallBack(this),
+		mSettings(rhs.mSettings),
+		mSugar(rhs.mSugar),
+		mPairCounter(rhs.mPairCounter)
 	{
 	}
 	
@@ -97,6 +109,16 @@ public:
 	void setIdeal(const std::shared_ptr<Ideal<Polynomial>>& ideal)
 	{
 		pGb = ideal;
+		// The indices of the new ideal are unrelated to the old ones.
+		mSugar.clear();
+	}
+	void setSettings(const GBSettings& settings)
+	{
+		mSettings = settings;
+	}
+	const GBSettings& getSettings() const
+	{
+		return mSettings;
 	}
 	void setCriticalPairs(const std::shared_ptr<CritPairs>& criticalPairs)
 	{
@@ -115,6 +137,25 @@ protected:
 	}
 	void removeBuchbergerTriples(std::unordered_map<size_t, SPolPair>& spairs, std::vector<size_t>& primelist);
 
+	/// The sugar degree of a generator, which is at least its total degree.
+	std::size_t sugar(std::size_t index) const
+	{
+		std::size_t deg = pGb->getGenerators()[index].total_degree();
+		if(index < mSugar.size()) return std::max(mSugar[index], deg);
+		return deg;
+	}
+
+	/// The maximal bit size of the coefficients of a polynomial.
+	static std::size_t coefficientBits(const Polynomial& p)
+	{
+		std::size_t res = 0;
+		for(const auto& t : p)
+		{
+			res = std::max(res, carl::bitsize(t.coeff()));
+		}
+		return res;
+	}
+
 	void reduce();
 };
 
@@ -9,6 +9,7 @@
 #include "Buchberger.h"
 
 #include <carl-arith/poly/umvpoly/functions/SPolynomial.h>
+#include <carl-statistics/carl-statistics.h>
 //
 //
 namespace carl
@@ -20,7 +21,9 @@ namespace carl
 template<class Polynomial, template<typename> class AddingPolicy>
 void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
 {
+	CARL_TRACE_SPAN("carl.gb", "buchberger");
 	CARL_LOG_INFO("carl.gb.buchberger", "Calculate gb");
+	mStats = BuchbergerStats::active() ? BuchbergerStats::getInstance() : nullptr;
 	for(unsigned i = 0; i < pGb->getGenerators().size(); ++i)
 	{
 		mGbElementsIndices.push_back(i);
@@ -29,6 +32,8 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 	bool foundGB = false;
 	for(const Polynomial& newPol : scheduledForAdding)
 	{
+		if(mStats) mStats->inputCoefficientBits.add(coefficientBits(newPol));
+		mPendingSugar = newPol.total_degree();
 		if(addToGb(newPol))
 		{
 			CARL_LOG_INFO("carl.gb.buchberger", "Added a constant polynomial.");
@@ -48,17 +53,43 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
             assert( critPair.mP1 < pGb->getGenerators().size() );
             assert( critPair.mP2 < pGb->getGenerators().size() );
 			CARL_LOG_DEBUG("carl.gb.buchberger", "Calculate SPol for: " << pGb->getGenerators()[critPair.mP1] << ", " << pGb->getGenerators()[critPair.mP2]);
+			statistics::timing::time_point start;
+			if(mStats)
+			{
+				mStats->TreatSPair();
+				start = statistics::Timer::start();
+			}
 			// Calculates the S-Polynomial
             assert( pGb->getGenerators()[critPair.mP1].nr_terms() != 0 );
             assert( pGb->getGenerators()[critPair.mP2].nr_terms() != 0 );
 			Polynomial spol = carl::SPolynomial(pGb->getGenerators()[critPair.mP1], pGb->getGenerators()[critPair.mP2]);
 			spol.setReasons(pGb->getGenerators()[critPair.mP1].getReasons() | pGb->getGenerators()[critPair.mP2].getReasons());
 			CARL_LOG_DEBUG("carl.gb.buchberger", "SPol: " << spol);
+			if(mStats)
+			{
+				mStats->timeSPolynomial.finish(start);
+				start = statistics::Timer::start();
+			}
 			// Schedules the S-polynomial for reduction
 			Reductor<Polynomial, Polynomial> reductor(*pGb, spol);
 			// Does a full reduction on this
 			Polynomial remainder = reductor.fullReduce();
 			CARL_LOG_DEBUG("carl.gb.buchberger", "Remainder of SPol: " << remainder);
+			if(mStats)
+			{
+				mStats->timeReduction.finish(start);
+				mStats->reductionSteps.inc(reductor.reductionSteps());
+				if(is_zero(remainder))
+				{
+					mStats->zeroReductions.inc();
+				}
+				else
+				{
+					mStats->NonZeroReduction();
+					mStats->degree.add(remainder.total_degree());
+					mStats->coefficientBits.add(coefficientBits(remainder.normalize()));
+				}
+			}
 			// If it is not zero, we should add this one to our GB
 			if(!is_zero(remainder))
 			{
@@ -73,13 +104,14 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 				{
 
 					// divide the polynomial through the leading coefficient.
-
+					mPendingSugar = critPair.mSugar;
 					if(addToGb(remainder.normalize())) break;
 				}
 			}
 		}
 	}
 	mGbElementsIndices.clear();
+	mStats = nullptr;
 }
 
 
@@ -92,9 +124,14 @@ template<class Polynomial, template<typename> class AddingPolicy>
 void Buchberger<Polynomial, AddingPolicy>::update(const size_t index)
 {
 	
+	statistics::timing::time_point start;
+	if(mStats) start = statistics::Timer::start();
 	std::vector<Polynomial>& generators = pGb->getGenerators();
 	assert(generators.size() > index);
 	assert(!generators[index].is_constant());
+	if(mSugar.size() <= index) mSugar.resize(index + 1, 0);
+	mSugar[index] = mPendingSugar;
+	std::size_t indexSugar = sugar(index) - generators[index].lmon()->tdeg();
 	auto jEnd = mGbElementsIndices.end();
 
 	std::unordered_map<size_t, SPolPair> spairs;
@@ -105,7 +142,18 @@ void Buchberger<Polynomial, AddingPolicy>::update(const size_t index)
 		size_t otherIndex = *jt;
 		assert(generators.size() > otherIndex);
 		uint oideg = generators[otherIndex].lmon() ? generators[otherIndex].lmon()->tdeg() : 0;
-		SPolPair sp(otherIndex, index, Monomial::lcm(generators[index].lmon(), generators[otherIndex].lmon()));
+		Monomial::Arg lcm = Monomial::lcm(generators[index].lmon(), generators[otherIndex].lmon());
+		std::size_t pairSugar = std::max(indexSugar, sugar(otherIndex) - oideg) + lcm->tdeg();
+		std::size_t weight = 0;
+		std::size_t age = 0;
+		switch(mSettings.selection)
+		{
+			case GBSelectionStrategy::Normal: break;
+			case GBSelectionStrategy::Sugar: weight = pairSugar; break;
+			case GBSelectionStrategy::Degree: weight = lcm->tdeg(); age = mPairCounter; break;
+		}
+		++mPairCounter;
+		SPolPair sp(otherIndex, index, std::move(lcm), pairSugar, weight, age);
 		if(sp.mLcm->tdeg() == generators[index].lmon()->tdeg() + oideg)
 		{
 			// *generators[index].lmon( ), *generators[otherIndex].lmon( ) are prime.
@@ -114,16 +162,38 @@ void Buchberger<Polynomial, AddingPolicy>::update(const size_t index)
 		spairs.emplace(otherIndex, sp);
 	}
 
-	
-	pCritPairs->elimMultiples(generators[index].lmon(), spairs);
-//	pCritPairs->elimMultiples(generators[index].lmon(), index, spairs);
+	if(mStats) mStats->pairsCreated.inc(spairs.size());
 
-	removeBuchbergerTriples(spairs, primelist);
+	if(mSettings.chainCriterion)
+	{
+		std::size_t eliminated = pCritPairs->elimMultiples(generators[index].lmon(), spairs);
+//		pCritPairs->elimMultiples(generators[index].lmon(), index, spairs);
+		std::size_t before = spairs.size();
+		if(mSettings.productCriterion)
+		{
+			removeBuchbergerTriples(spairs, primelist);
+		}
+		else
+		{
+			std::vector<size_t> noPrimes;
+			removeBuchbergerTriples(spairs, noPrimes);
+		}
+		if(mStats)
+		{
+			mStats->pairsRemovedGebauerMoeller.inc(eliminated);
+			mStats->pairsRemovedChain.inc(before - spairs.size());
+		}
+	}
 
 	// Pairs which are primes don't have to be added according to Buchbergers first criterion
-	for(std::vector<size_t>::const_iterator pt = primelist.begin(); pt != primelist.end(); ++pt)
+	if(mSettings.productCriterion)
 	{
-		spairs.erase(*pt);
+		std::size_t eliminated = 0;
+		for(std::vector<size_t>::const_iterator pt = primelist.begin(); pt != primelist.end(); ++pt)
+		{
+			eliminated += spairs.erase(*pt);
+		}
+		if(mStats) mStats->pairsRemovedProduct.inc(eliminated);
 	}
 
 	// We add the critical pairs to our tree of pairs
@@ -152,6 +222,7 @@ void Buchberger<Polynomial, AddingPolicy>::update(const size_t index)
 	mGbElementsIndices.swap(tempIndices);
 	// We add the currently added polynomial to our GB.
 	mGbElementsIndices.push_back(index);
+	if(mStats) mStats->timeUpdate.finish(start);
 }
 
 template<class Polynomial, template<typename> class AddingPolicy>
@@ -1,6 +1,3 @@
-
-
-
 /*
  * @file   BuchbergerStats.cpp
  * @author Sebastian Junges
@@ -11,12 +8,11 @@
 
 namespace carl
 {
-BuchbergerStats* BuchbergerStats::instance = nullptr;
-
 BuchbergerStats* BuchbergerStats::getInstance( )
 {
-    if( instance == nullptr )
-        instance = new BuchbergerStats( );
-    return instance;
+    static BuchbergerStats& instance = statistics::get<BuchbergerStats>( "buchberger" );
+    return &instance;
 }
 }
+
+
@@ -1,6 +1,3 @@
-
-
-
 /**
  * @file   BuchbergerStats.h
  * @author Sebastian Junges
@@ -9,23 +6,82 @@
 
 #pragma once
 
+#include <carl-statistics/Statistics.h>
+
+#include <atomic>
+
 namespace carl
 {
 
 /**
  * A little class for gathering statistics about the Buchberger algorithm calls.
+ *
+ * The statistics are always compiled in, but only recorded after they have been enabled at runtime via set_enabled().
+ * The single instance is registered with the carl-statistics collector as "buchberger", hence it is reported together with all other statistics.
  */
-class BuchbergerStats
+class BuchbergerStats : public statistics::Statistics
 {
 public:
     static BuchbergerStats* getInstance( );
 
+    /// Shorthand for getInstance()->enabled().
+    static bool active( )
+    {
+        return getInstance( )->enabled( );
+    }
+
+    bool enabled( ) const override
+    {
+        return mEnabled.load( std::memory_order_relaxed );
+    }
+
+    void set_enabled( bool enabled )
+    {
+        mEnabled.store( enabled, std::memory_order_relaxed );
+    }
+
+    /// Number of critical pairs that were considered.
+    statistics::Counter pairsCreated;
+    /// Number of pairs removed by Buchberger's product criterion (coprime leading monomials).
+    statistics::Counter pairsRemovedProduct;
+    /// Number of new pairs removed by the chain criterion, as their lcm is divisible by the lcm of another new pair.
+    statistics::Counter pairsRemovedChain;
+    /// Number of scheduled pairs removed by the Gebauer-Moeller criterion when a new generator arrives.
+    statistics::Counter pairsRemovedGebauerMoeller;
+    /// Number of pairs removed by the syzygy criterion of the signature based algorithm.
+    statistics::Counter pairsRemovedSyzygy;
+    /// Number of pairs removed by the rewrite criterion of the signature based algorithm.
+    statistics::Counter pairsRemovedRewritten;
+    /// Number of S-polynomials that were reduced.
+    statistics::Counter pairsReduced;
+    /// Number of S-polynomials that reduced to zero.
+    statistics::Counter zeroReductions;
+    /// Number of single reduction steps over all reductions.
+    statistics::Counter reductionSteps;
+    /// Total degree of the polynomials added to the basis.
+    statistics::Series degree;
+    /// Maximal bit size of a coefficient of the input polynomials.
+    statistics::Series inputCoefficientBits;
+    /// Maximal bit size of a coefficient of the polynomials added to the basis.
+    statistics::Series coefficientBits;
+
+    /// Time for reducing the input polynomials.
+    statistics::Timer timeReduceInput;
+    /// Time for creating and filtering critical pairs.
+    statistics::Timer timeUpdate;
+    /// Time for computing S-polynomials.
+    statistics::Timer timeSPolynomial;
+    /// Time for reducing S-polynomials.
+    statistics::Timer timeReduction;
+    /// Time for interreducing the final basis.
+    statistics::Timer timeInterreduction;
+
     /**
      *  Count that we found a TSQ which had a constant trailing term
      */
     void TSQWithConstant( )
     {
-        mNrOfTSQWithConstant++;
+        mNrOfTSQWithConstant.inc( );
     }
 
     /**
@@ -33,7 +89,7 @@ public:
      */
     void TSQWithoutConstant( )
     {
-        mNrOfTSQWithoutConstant++;
+        mNrOfTSQWithoutConstant.inc( );
     }
 
     /**
@@ -41,19 +97,19 @@ public:
      */
     void SingleTermSFP( )
     {
-        mNrOfSingleTermSFP++;
+        mNrOfSingleTermSFP.inc( );
     }
 
     void ReducibleIdentity( )
     {
-        mNrOfReducibleIdentities++;
+        mNrOfReducibleIdentities.inc( );
     }
     /**
      *  Count that we take and reduce another S-Pair
      */
     void TreatSPair( )
     {
-        mNrOfReductions++;
+        pairsReduced.inc( );
     }
 
     /**
@@ -61,47 +117,70 @@ public:
      */
     void NonZeroReduction( )
     {
-        mNrOfNonZeroReductions++;
+        mNrOfNonZeroReductions.inc( );
     }
 
-    unsigned getNrTSQWithConstant( ) const
+    /// Number of reductions to zero that the signature based algorithm avoided.
+    std::size_t getNrZeroReductionsAvoided( ) const
     {
-        return mNrOfTSQWithConstant;
+        return pairsRemovedSyzygy.count( ) + pairsRemovedRewritten.count( );
     }
 
-    unsigned getNrTSQWithoutConstant( ) const
+    std::size_t getNrTSQWithConstant( ) const
     {
-        return mNrOfTSQWithoutConstant;
+        return mNrOfTSQWithConstant.count( );
     }
 
-    unsigned getSingleTermSFP( ) const
+    std::size_t getNrTSQWithoutConstant( ) const
     {
-        return mNrOfSingleTermSFP;
+        return mNrOfTSQWithoutConstant.count( );
     }
-    
-    unsigned getNrReducibleIdentities( ) const
+
+    std::size_t getSingleTermSFP( ) const
     {
-        return mNrOfReducibleIdentities;
+        return mNrOfSingleTermSFP.count( );
     }
-protected:
 
-    BuchbergerStats( ) :
-    mNrOfTSQWithConstant( 0 ),
-    mNrOfTSQWithoutConstant( 0 ),
-    mNrOfSingleTermSFP( 0 ),
-    mNrOfReducibleIdentities( 0 ),
-    mNrOfReductions( 0 ),
-    mNrOfNonZeroReductions( 0 )
+    std::size_t getNrReducibleIdentities( ) const
     {
+        return mNrOfReducibleIdentities.count( );
     }
-    unsigned mNrOfTSQWithConstant;
-    unsigned mNrOfTSQWithoutConstant;
-    unsigned mNrOfSingleTermSFP;
-    unsigned mNrOfReducibleIdentities;
-    unsigned mNrOfReductions;
-    unsigned mNrOfNonZeroReductions;
-
-private:
-    static BuchbergerStats* instance;
+
+    void collect( ) override
+    {
+        addKeyValuePair( "pairs-created", pairsCreated );
+        addKeyValuePair( "pairs-removed-product", pairsRemovedProduct );
+        addKeyValuePair( "pairs-removed-chain", pairsRemovedChain );
+        addKeyValuePair( "pairs-removed-gebauer-moeller", pairsRemovedGebauerMoeller );
+        addKeyValuePair( "pairs-removed-syzygy", pairsRemovedSyzygy );
+        addKeyValuePair( "pairs-removed-rewritten", pairsRemovedRewritten );
+        addKeyValuePair( "zero-reductions-avoided", getNrZeroReductionsAvoided( ) );
+        addKeyValuePair( "pairs-reduced", pairsReduced );
+        addKeyValuePair( "zero-reductions", zeroReductions );
+        addKeyValuePair( "nonzero-reductions", mNrOfNonZeroReductions );
+        addKeyValuePair( "reduction-steps", reductionSteps );
+        addKeyValuePair( "degree", degree );
+        addKeyValuePair( "input-coefficient-bits", inputCoefficientBits );
+        addKeyValuePair( "coefficient-bits", coefficientBits );
+        addKeyValuePair( "time-reduce-input", timeReduceInput );
+        addKeyValuePair( "time-update", timeUpdate );
+        addKeyValuePair( "time-spolynomial", timeSPolynomial );
+        addKeyValuePair( "time-reduction", timeReduction );
+        addKeyValuePair( "time-interreduction", timeInterreduction );
+        addKeyValuePair( "tsq-with-constant", mNrOfTSQWithConstant );
+        addKeyValuePair( "tsq-without-constant", mNrOfTSQWithoutConstant );
+        addKeyValuePair( "single-term-sfp", mNrOfSingleTermSFP );
+        addKeyValuePair( "reducible-identities", mNrOfReducibleIdentities );
+    }
+
+    /// Only to be used by the statistics collector, use getInstance() instead.
+    BuchbergerStats( ) = default;
+protected:
+    std::atomic<bool> mEnabled = false;
+    statistics::Counter mNrOfTSQWithConstant;
+    statistics::Counter mNrOfTSQWithoutConstant;
+    statistics::Counter mNrOfSingleTermSFP;
+    statistics::Counter mNrOfReducibleIdentities;
+    statistics::Counter mNrOfNonZeroReductions;
 };
-}
\ No newline at end of file
+}
@@ -27,7 +27,11 @@ public:
 
     static CompareResult compare( Entry e1, Entry e2 )
     {
-        return Compare::compare( e1->getSortedFirstLCM( ), e2->getSortedFirstLCM( ) );
+        const SPolPair& p1 = e1->getFirst( );
+        const SPolPair& p2 = e2->getFirst( );
+        if( p1.mWeight != p2.mWeight ) return p1.mWeight < p2.mWeight ? CompareResult::LESS : CompareResult::GREATER;
+        if( p1.mAge != p2.mAge ) return p1.mAge < p2.mAge ? CompareResult::LESS : CompareResult::GREATER;
+        return Compare::compare( p1.mLcm, p2.mLcm );
     }
 
     static bool cmpLessThan( CompareResult res )
@@ -78,8 +82,9 @@ public:
 	 * Eliminate multiples of the given monomial.
      * @param lm
      * @param newpairs
+     * @return The number of eliminated pairs.
      */
-    void elimMultiples( const Monomial::Arg& lm, const std::unordered_map<size_t, SPolPair>& newpairs );
+    std::size_t elimMultiples( const Monomial::Arg& lm, const std::unordered_map<size_t, SPolPair>& newpairs );
     
 	/**
 	 * Checks whether there are any pairs in the data structure.
@@ -34,8 +34,9 @@ namespace carl
      * @param newpairs
      */
     template<template <class> class Datastructure, class Configuration>
-    void CriticalPairs<Datastructure, Configuration>::elimMultiples( const Monomial::Arg& lm, const std::unordered_map<size_t, SPolPair>& newpairs )
+    std::size_t CriticalPairs<Datastructure, Configuration>::elimMultiples( const Monomial::Arg& lm, const std::unordered_map<size_t, SPolPair>& newpairs )
     {
+        std::size_t eliminated = 0;
         typename Datastructure<Configuration>::const_iterator it( mDatastruct.begin( ) );
         while( it != mDatastruct.end( ) )
         {
@@ -61,6 +62,7 @@ namespace carl
                 if( psLcm->divisible( lm ) && psLcm != spp1->second.mLcm && psLcm != spp2->second.mLcm )
                 {
                     ps = it.get( )->erase( ps );
+                    ++eliminated;
                 }
                 else
                 {
@@ -76,5 +78,6 @@ namespace carl
                 it.next( );
             }
         }
+        return eliminated;
     }
 }
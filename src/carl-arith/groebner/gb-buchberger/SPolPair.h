@@ -11,19 +11,25 @@ namespace carl
 {
     /**
      * Basic spol-pair. Optimizations could be deducing p2 from the structure where it is saved, and not saving the lcm.
-     * Also sugar might be added.
      * @param p1 index of polynomial p1
      * @param p2 index of polynomial p2
      * @param lcm the lcm(lt(p1), lt(p2))
+     * @param sugar the sugar degree of the S-polynomial
+     * @param weight the primary key for the selection of pairs, smaller weights are selected first
+     * @param age the secondary key for the selection of pairs
      */
     struct SPolPair
     {
-        SPolPair( std::size_t p1, std::size_t p2, Monomial::Arg lcm ) : mP1(p1), mP2(p2), mLcm(std::move(lcm))
+        SPolPair( std::size_t p1, std::size_t p2, Monomial::Arg lcm, std::size_t sugar = 0, std::size_t weight = 0, std::size_t age = 0 ) :
+            mP1(p1), mP2(p2), mLcm(std::move(lcm)), mSugar(sugar), mWeight(weight), mAge(age)
         {}
 
         const std::size_t mP1;
         const std::size_t mP2;
         const Monomial::Arg mLcm;
+        const std::size_t mSugar;
+        const std::size_t mWeight;
+        const std::size_t mAge;
 
         void print(std::ostream& os = std::cout) const
         {
@@ -36,6 +42,8 @@ namespace carl
     {
         bool operator( )(const SPolPair& s1, const SPolPair & s2 )
         {
+            if( s1.mWeight != s2.mWeight ) return s1.mWeight < s2.mWeight;
+            if( s1.mAge != s2.mAge ) return s1.mAge < s2.mAge;
             return Compare::less( s1.mLcm, s2.mLcm );
         }
     };
@@ -0,0 +1,166 @@
+/**
+ * @file   SignatureGB.h
+ * @ingroup gb
+ *
+ */
+
+#pragma once
+
+
+#include "../GBSettings.h"
+#include "../Ideal.h"
+#include "../Reductor.h"
+#include "../gb-buchberger/BuchbergerStats.h"
+
+#include <list>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * The signature of a polynomial p = sum_i a_i f_i, being the maximal term a_i e_i with respect to the position over term ordering.
+ * The monomial nullptr represents 1.
+ * @ingroup gb
+ */
+struct Signature
+{
+	Monomial::Arg monomial;
+	std::size_t index;
+};
+
+/**
+ * Signature based Groebner basis computation, in the rewrite basis (RB) formulation of Eder and Faugere
+ * with position over term signatures, which covers both F5 and GVW.
+ *
+ * The input polynomials are processed incrementally, the current basis first.
+ * Critical pairs are considered by increasing signature and are discarded without reduction
+ *  - if their signature is divisible by the signature of a known syzygy (F5 criterion, also covering the Koszul syzygies),
+ *  - or if a later basis element can rewrite the signature (rewrite criterion).
+ * Elements of a smaller index are used for reduction via the Reductor, as they never affect the signature,
+ * while elements of the same index only top-reduce if the signature of the reducer is smaller.
+ * The resulting basis is neither minimal nor reduced, GBProcedure takes care of this,
+ * hence the final basis is the same as the one computed by Buchberger.
+ *
+ * The number of pairs removed by the two criteria is reported in the BuchbergerStats, as they replace reductions to zero.
+ * The adding policy is not applied, as modifying a polynomial would invalidate its signature.
+ * The selection strategy and the pair criteria from the GBSettings are ignored, as the order of the pairs is given by the signatures.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+class SignatureGB
+{
+protected:
+	using Order = typename Polynomial::OrderedBy;
+	using Coeff = typename Polynomial::CoeffType;
+
+	/// A polynomial of the basis together with its signature.
+	struct LabeledPolynomial
+	{
+		Signature signature;
+		Polynomial polynomial;
+	};
+
+	/// A critical pair, represented by its signature and the basis element whose multiple has this signature.
+	struct SignaturePair
+	{
+		Signature signature;
+		std::size_t generator;
+	};
+
+	std::shared_ptr<Ideal<Polynomial>> pGb;
+	GBSettings mSettings;
+	/// The labeled basis, ordered by index.
+	std::vector<LabeledPolynomial> mBasis;
+	/// Monomials m such that m e_i is the signature of a syzygy, for the index i which is currently processed.
+	std::vector<Monomial::Arg> mSyzygies;
+	/// The statistics of the current call to calculate(), nullptr if they are disabled.
+	BuchbergerStats* mStats = nullptr;
+
+public:
+	SignatureGB() = default;
+	virtual ~SignatureGB() = default;
+
+	SignatureGB(const SignatureGB& rhs):
+		pGb(new Ideal<Polynomial>(*rhs.pGb)),
+		mSettings(rhs.mSettings)
+	{
+	}
+
+	void calculate(const std::list<Polynomial>& scheduledForAdding);
+	void setIdeal(const std::shared_ptr<Ideal<Polynomial>>& ideal)
+	{
+		pGb = ideal;
+	}
+	void setSettings(const GBSettings& settings)
+	{
+		mSettings = settings;
+	}
+	const GBSettings& getSettings() const
+	{
+		return mSettings;
+	}
+
+	/**
+	 * Compares two signatures with respect to the position over term ordering.
+	 */
+	static CompareResult compare(const Signature& lhs, const Signature& rhs)
+	{
+		if(lhs.index != rhs.index) return lhs.index < rhs.index ? CompareResult::LESS : CompareResult::GREATER;
+		return Order::compare(lhs.monomial, rhs.monomial);
+	}
+
+protected:
+	/**
+	 * Adds the polynomial with the signature e_index and processes all pairs of this index.
+	 * @return true, if a constant polynomial was found.
+	 */
+	bool addIndex(const Polynomial& p, std::size_t index);
+
+	/**
+	 * Reduces p, whose signature is sig, such that the signature does not change.
+	 * @param lower The basis elements of smaller index.
+	 * @param first The position of the first basis element with the index of sig.
+	 */
+	Polynomial regularReduce(Polynomial p, const Signature& sig, const Ideal<Polynomial>& lower, std::size_t first);
+
+	/// Checks whether the signature is divisible by the signature of a known syzygy.
+	bool isSyzygy(const Signature& sig) const;
+
+	/// Checks whether a basis element after the given generator rewrites the signature.
+	bool isRewritable(const SignaturePair& pair, std::size_t first) const;
+
+	/// Creates the critical pairs of the last basis element with all other basis elements.
+	void createPairs(std::vector<SignaturePair>& pairs);
+
+	static bool divisible(const Monomial::Arg& m, const Monomial::Arg& divisor)
+	{
+		if(!divisor) return true;
+		return m && m->divisible(divisor);
+	}
+
+	static Monomial::Arg quotient(const Monomial::Arg& m, const Monomial::Arg& divisor)
+	{
+		if(!divisor) return m;
+		Monomial::Arg res;
+		bool works = m->divide(divisor, res);
+		assert(works);
+		(void)works;
+		return res;
+	}
+
+	/// The maximal bit size of the coefficients of a polynomial.
+	static std::size_t coefficientBits(const Polynomial& p)
+	{
+		std::size_t res = 0;
+		for(const auto& t : p)
+		{
+			res = std::max(res, carl::bitsize(t.coeff()));
+		}
+		return res;
+	}
+};
+
+}
+
+#include "SignatureGB.tpp"
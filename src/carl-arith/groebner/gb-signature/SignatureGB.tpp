@@ -0,0 +1,251 @@
+/**
+ * @file SignatureGB.tpp
+ * @ingroup gb
+ */
+#pragma once
+#include "SignatureGB.h"
+
+#include <carl-statistics/carl-statistics.h>
+
+#include <algorithm>
+#include <optional>
+
+namespace carl
+{
+
+/**
+ * Calculate the Groebner basis
+ */
+template<class Polynomial, template<typename> class AddingPolicy>
+void SignatureGB<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
+{
+	CARL_TRACE_SPAN("carl.gb", "signature");
+	CARL_LOG_INFO("carl.gb.signature", "Calculate gb");
+	mStats = BuchbergerStats::active() ? BuchbergerStats::getInstance() : nullptr;
+	// The current basis is already a Groebner basis, hence it comes first and yields no new elements.
+	pGb->removeEliminated();
+	std::vector<Polynomial> input(pGb->getGenerators());
+	for(const Polynomial& newPol : scheduledForAdding)
+	{
+		if(mStats) mStats->inputCoefficientBits.add(coefficientBits(newPol));
+		input.push_back(newPol);
+	}
+
+	bool foundConstant = false;
+	for(std::size_t index = 0; index < input.size(); ++index)
+	{
+		if(is_zero(input[index])) continue;
+		if(addIndex(input[index], index))
+		{
+			CARL_LOG_INFO("carl.gb.signature", "Found a constant polynomial.");
+			foundConstant = true;
+			break;
+		}
+	}
+
+	pGb->clear();
+	if(foundConstant)
+	{
+		pGb->addGenerator(mBasis.back().polynomial);
+	}
+	else
+	{
+		for(const LabeledPolynomial& lp : mBasis)
+		{
+			pGb->addGenerator(lp.polynomial);
+		}
+	}
+	mBasis.clear();
+	mSyzygies.clear();
+	mStats = nullptr;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+bool SignatureGB<Polynomial, AddingPolicy>::addIndex(const Polynomial& p, std::size_t index)
+{
+	CARL_LOG_DEBUG("carl.gb.signature", "Add index " << index << ": " << p);
+	// Elements of a smaller index never change the signature, hence they may reduce without restriction.
+	Ideal<Polynomial> lower;
+	mSyzygies.clear();
+	for(const LabeledPolynomial& lp : mBasis)
+	{
+		lower.addGenerator(lp.polynomial);
+		// The Koszul syzygy lm(g) f_index - f_index g has the signature lm(g) e_index.
+		mSyzygies.push_back(lp.polynomial.lmon());
+	}
+	const std::size_t first = mBasis.size();
+
+	// A min-heap of the pairs with respect to their signatures.
+	auto greater = [](const SignaturePair& lhs, const SignaturePair& rhs)
+	{
+		return compare(lhs.signature, rhs.signature) == CompareResult::GREATER;
+	};
+	std::vector<SignaturePair> pairs;
+
+	Signature sig{nullptr, index};
+	Polynomial next = p;
+	while(true)
+	{
+		statistics::timing::time_point start;
+		if(mStats) start = statistics::Timer::start();
+		Polynomial remainder = regularReduce(std::move(next), sig, lower, first);
+		CARL_LOG_DEBUG("carl.gb.signature", "Remainder with signature " << sig.monomial << " e_" << sig.index << ": " << remainder);
+		if(mStats)
+		{
+			mStats->timeReduction.finish(start);
+			if(is_zero(remainder))
+			{
+				mStats->zeroReductions.inc();
+			}
+			else
+			{
+				mStats->NonZeroReduction();
+				mStats->degree.add(remainder.total_degree());
+				mStats->coefficientBits.add(coefficientBits(remainder.normalize()));
+			}
+		}
+		if(is_zero(remainder))
+		{
+			mSyzygies.push_back(sig.monomial);
+		}
+		else
+		{
+			mBasis.push_back(LabeledPolynomial{sig, remainder.normalize()});
+			if(remainder.is_constant()) return true;
+			createPairs(pairs);
+		}
+
+		// Take the pairs with the smallest signature, at most one of them is reduced.
+		std::optional<SignaturePair> selected;
+		while(!selected && !pairs.empty())
+		{
+			std::pop_heap(pairs.begin(), pairs.end(), greater);
+			SignaturePair pair = pairs.back();
+			pairs.pop_back();
+			std::size_t group = 1;
+			bool rewritable = isRewritable(pair, first);
+			while(!pairs.empty() && compare(pairs.front().signature, pair.signature) == CompareResult::EQUAL)
+			{
+				std::pop_heap(pairs.begin(), pairs.end(), greater);
+				if(rewritable && !isRewritable(pairs.back(), first))
+				{
+					pair = pairs.back();
+					rewritable = false;
+				}
+				pairs.pop_back();
+				++group;
+			}
+			if(isSyzygy(pair.signature))
+			{
+				if(mStats) mStats->pairsRemovedSyzygy.inc(group);
+			}
+			else if(rewritable)
+			{
+				if(mStats) mStats->pairsRemovedRewritten.inc(group);
+			}
+			else
+			{
+				if(mStats) mStats->pairsRemovedRewritten.inc(group - 1);
+				selected = pair;
+			}
+		}
+		if(!selected) break;
+
+		statistics::timing::time_point start2;
+		if(mStats)
+		{
+			mStats->TreatSPair();
+			start2 = statistics::Timer::start();
+		}
+		const LabeledPolynomial& generator = mBasis[selected->generator];
+		sig = selected->signature;
+		Monomial::Arg factor = quotient(sig.monomial, generator.signature.monomial);
+		next = factor ? generator.polynomial * factor : generator.polynomial;
+		next.setReasons(generator.polynomial.getReasons());
+		if(mStats) mStats->timeSPolynomial.finish(start2);
+	}
+	return false;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+Polynomial SignatureGB<Polynomial, AddingPolicy>::regularReduce(Polynomial p, const Signature& sig, const Ideal<Polynomial>& lower, std::size_t first)
+{
+	while(true)
+	{
+		Reductor<Polynomial, Polynomial> reductor(lower, p);
+		p = reductor.fullReduce();
+		if(mStats) mStats->reductionSteps.inc(reductor.reductionSteps());
+		if(is_zero(p)) return p;
+
+		bool reduced = false;
+		for(std::size_t i = first; i < mBasis.size(); ++i)
+		{
+			const LabeledPolynomial& g = mBasis[i];
+			if(!divisible(p.lmon(), g.polynomial.lmon())) continue;
+			Monomial::Arg factor = quotient(p.lmon(), g.polynomial.lmon());
+			// Only reductions with a smaller signature keep the signature.
+			Signature reducerSig{factor * g.signature.monomial, g.signature.index};
+			if(compare(reducerSig, sig) != CompareResult::LESS) continue;
+			BitVector reasons = p.getReasons() | g.polynomial.getReasons();
+			p.subtractProduct(Term<Coeff>(p.lcoeff() / g.polynomial.lcoeff(), factor), g.polynomial);
+			p.setReasons(reasons);
+			if(mStats) mStats->reductionSteps.inc();
+			reduced = true;
+			break;
+		}
+		if(!reduced) return p;
+	}
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+bool SignatureGB<Polynomial, AddingPolicy>::isSyzygy(const Signature& sig) const
+{
+	return std::any_of(mSyzygies.begin(), mSyzygies.end(), [&sig](const Monomial::Arg& m)
+	{
+		return divisible(sig.monomial, m);
+	});
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+bool SignatureGB<Polynomial, AddingPolicy>::isRewritable(const SignaturePair& pair, std::size_t first) const
+{
+	assert(pair.generator >= first);
+	(void)first;
+	for(std::size_t i = pair.generator + 1; i < mBasis.size(); ++i)
+	{
+		if(divisible(pair.signature.monomial, mBasis[i].signature.monomial)) return true;
+	}
+	return false;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+void SignatureGB<Polynomial, AddingPolicy>::createPairs(std::vector<SignaturePair>& pairs)
+{
+	statistics::timing::time_point start;
+	if(mStats) start = statistics::Timer::start();
+	auto greater = [](const SignaturePair& lhs, const SignaturePair& rhs)
+	{
+		return compare(lhs.signature, rhs.signature) == CompareResult::GREATER;
+	};
+	const std::size_t last = mBasis.size() - 1;
+	const LabeledPolynomial& p = mBasis[last];
+	for(std::size_t i = 0; i < last; ++i)
+	{
+		const LabeledPolynomial& g = mBasis[i];
+		Monomial::Arg lcm = Monomial::lcm(p.polynomial.lmon(), g.polynomial.lmon());
+		Signature sp{quotient(lcm, p.polynomial.lmon()) * p.signature.monomial, p.signature.index};
+		Signature sg{quotient(lcm, g.polynomial.lmon()) * g.signature.monomial, g.signature.index};
+		switch(compare(sp, sg))
+		{
+			// Both multiples have the same signature, the S-polynomial is not regular.
+			case CompareResult::EQUAL: continue;
+			case CompareResult::GREATER: pairs.push_back(SignaturePair{sp, last}); break;
+			case CompareResult::LESS: pairs.push_back(SignaturePair{sg, i}); break;
+		}
+		std::push_heap(pairs.begin(), pairs.end(), greater);
+		if(mStats) mStats->pairsCreated.inc();
+	}
+	if(mStats) mStats->timeUpdate.finish(start);
+}
+
+}
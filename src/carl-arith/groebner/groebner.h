@@ -9,4 +9,6 @@
 
 #include "GBProcedure.h"
 #include "gb-buchberger/Buchberger.h"
-#include "Reductor.h"
\ No newline at end of file
+#include "gb-signature/SignatureGB.h"
+#include "Reductor.h"
+#include "ReductorGeobucket.h"
\ No newline at end of file
@@ -0,0 +1,467 @@
+/**
+ * @file FastDoubleInterval.h
+ *
+ * A lightweight interval over doubles for hot loops.
+ */
+
+#pragma once
+
+#include "Interval.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace carl {
+
+namespace fast_interval {
+	constexpr double infinity = std::numeric_limits<double>::infinity();
+
+	/// Values below this threshold may lose precision in the error terms below, hence they are always rounded.
+	constexpr double tiny = std::numeric_limits<double>::min() * 9007199254740992.0;
+
+	/// Values above this threshold may overflow in the error terms below, hence they are always rounded.
+	constexpr double huge = 6.69692879491417e+299; // 2^996
+
+	/// Returns the next smaller double, assuming that d is finite.
+	inline double next_down(double d) {
+		if (d == 0) return -std::numeric_limits<double>::denorm_min();
+		auto bits = std::bit_cast<std::uint64_t>(d);
+		return std::bit_cast<double>(d > 0 ? bits - 1 : bits + 1);
+	}
+
+	/**
+	 * Computes the rounding error err = a*b - p of the product p = a*b.
+	 * Uses a fused multiply-add if it is fast, otherwise Dekker's product which fails if the operands are too large.
+	 * Assumes that a, b and p are finite and that no underflow occurs.
+	 * @return false, if the error is unknown.
+	 */
+	inline bool mul_error(double a, double b, double p, double& err) {
+#ifdef FP_FAST_FMA
+		err = std::fma(a, b, -p);
+		return true;
+#else
+		constexpr double split = 134217729.0; // 2^27 + 1
+		if (std::abs(a) > huge || std::abs(b) > huge) return false;
+		double ta = split * a;
+		double ah = ta - (ta - a);
+		double al = a - ah;
+		double tb = split * b;
+		double bh = tb - (tb - b);
+		double bl = b - bh;
+		err = ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+		return true;
+#endif
+	}
+
+	/// Returns an overflowed result rounded downward, i.e. the largest double instead of infinity if the operands were finite.
+	inline double overflow_down(double res, bool finite_operands) {
+		return (res > 0 && finite_operands) ? std::numeric_limits<double>::max() : res;
+	}
+
+	/// Returns a+b rounded downward, i.e. only rounds if a+b is not exact.
+	inline double add_down(double a, double b) {
+		double s = a + b;
+		if (!std::isfinite(s)) return overflow_down(s, std::isfinite(a) && std::isfinite(b));
+		// TwoSum: s + err == a + b exactly.
+		double bb = s - a;
+		double err = (a - (s - bb)) + (b - bb);
+		return err < 0 ? next_down(s) : s;
+	}
+	/// Returns a+b rounded upward.
+	inline double add_up(double a, double b) {
+		return -add_down(-a, -b);
+	}
+
+	/// Computes a*b rounded downward and upward, where zero times infinity is zero.
+	inline void mul_round(double a, double b, double& down, double& up) {
+		if (a == 0 || b == 0) {
+			down = up = 0;
+			return;
+		}
+		double p = a * b;
+		if (!std::isfinite(p)) {
+			bool finite = std::isfinite(a) && std::isfinite(b);
+			down = overflow_down(p, finite);
+			up = -overflow_down(-p, finite);
+			return;
+		}
+		double err;
+		if (std::abs(p) < tiny || !mul_error(a, b, p, err)) {
+			down = next_down(p);
+			up = -next_down(-p);
+			return;
+		}
+		down = err < 0 ? next_down(p) : p;
+		up = err > 0 ? -next_down(-p) : p;
+	}
+	/// Returns a*b rounded downward, where zero times infinity is zero.
+	inline double mul_down(double a, double b) {
+		double down, up;
+		mul_round(a, b, down, up);
+		return down;
+	}
+	/// Returns a*b rounded upward, where zero times infinity is zero.
+	inline double mul_up(double a, double b) {
+		return -mul_down(-a, b);
+	}
+
+	/// Returns a/b rounded downward, assuming that b is not zero.
+	inline double div_down(double a, double b) {
+		if (a == 0) return 0;
+		double q = a / b;
+		if (std::isinf(b)) return q;
+		if (!std::isfinite(q)) return overflow_down(q, std::isfinite(a));
+		if (std::abs(q) < tiny || std::abs(a) < tiny) return next_down(q);
+		if (std::abs(q) > huge || std::abs(b) > huge) return next_down(q);
+		// a/b - q has the sign of (a - q*b)/b, and a - q*b is exactly q*b's rounding error with opposite sign.
+		double qb = q * b;
+		if (!std::isfinite(qb)) return next_down(q);
+		double err;
+		// Cannot fail, as q and b are at most huge.
+		mul_error(q, b, qb, err);
+		double r = (a - qb) - err;
+		return ((r < 0) != (b < 0) && r != 0) ? next_down(q) : q;
+	}
+	/// Returns a/b rounded upward, assuming that b is not zero.
+	inline double div_up(double a, double b) {
+		return -div_down(-a, b);
+	}
+}
+
+/**
+ * An interval over doubles that is trivially copyable and performs outward rounding directly.
+ *
+ * In contrast to Interval<double>, it does not wrap a boost interval and does not switch the rounding mode.
+ * Instead, every operation is computed with the default rounding and error-free transformations decide whether the result needs to be moved outwards by one ulp.
+ * Thus exact results, for example of integral operations, are not widened.
+ *
+ * Infinite bounds are represented by infinities, the strictness of the bounds is kept in a small flag field.
+ * The empty interval is represented as (0,0) with both bounds strict.
+ */
+class FastDoubleInterval {
+private:
+	static constexpr std::uint8_t LOWER_STRICT = 1;
+	static constexpr std::uint8_t UPPER_STRICT = 2;
+
+	double mLower;
+	double mUpper;
+	std::uint8_t mFlags;
+
+	FastDoubleInterval(double lower, double upper, std::uint8_t flags): mLower(lower), mUpper(upper), mFlags(flags) {
+		normalize();
+	}
+
+	/// Makes infinite bounds strict and brings empty intervals into their canonical form.
+	void normalize() {
+		assert(!std::isnan(mLower) && !std::isnan(mUpper));
+		if (std::isinf(mLower)) mFlags |= LOWER_STRICT;
+		if (std::isinf(mUpper)) mFlags |= UPPER_STRICT;
+		if (mLower > mUpper || (mLower == mUpper && mFlags != 0)) {
+			mLower = 0;
+			mUpper = 0;
+			mFlags = LOWER_STRICT | UPPER_STRICT;
+		}
+	}
+
+	/// Combines the candidates for a bound: picks the minimum (or maximum) value, which is strict only if all candidates with this value are strict.
+	template<bool Lower>
+	static void select(double& value, bool& strict, double candidate, bool candidate_strict) {
+		if ((Lower && candidate < value) || (!Lower && candidate > value)) {
+			value = candidate;
+			strict = candidate_strict;
+		} else if (candidate == value) {
+			strict = strict && candidate_strict;
+		}
+	}
+	static std::uint8_t flags(bool lower_strict, bool upper_strict) {
+		return static_cast<std::uint8_t>((lower_strict ? LOWER_STRICT : 0) | (upper_strict ? UPPER_STRICT : 0));
+	}
+
+public:
+	/// Creates the point interval [0,0].
+	FastDoubleInterval(): mLower(0), mUpper(0), mFlags(0) {}
+	/// Creates the point interval [n,n].
+	explicit FastDoubleInterval(double n): mLower(n), mUpper(n), mFlags(0) {
+		normalize();
+	}
+	/// Creates the closed interval [lower,upper], infinite values stand for infinite bounds.
+	FastDoubleInterval(double lower, double upper): mLower(lower), mUpper(upper), mFlags(0) {
+		normalize();
+	}
+	/// Creates an interval with the given bounds, the value of an infinite bound is ignored.
+	FastDoubleInterval(double lower, BoundType lowerBoundType, double upper, BoundType upperBoundType):
+		mLower(lowerBoundType == BoundType::INFTY ? -fast_interval::infinity : lower),
+		mUpper(upperBoundType == BoundType::INFTY ? fast_interval::infinity : upper),
+		mFlags(flags(lowerBoundType != BoundType::WEAK, upperBoundType != BoundType::WEAK))
+	{
+		normalize();
+	}
+	/// Converts from Interval<double>.
+	explicit FastDoubleInterval(const Interval<double>& i):
+		FastDoubleInterval(i.lower(), i.lower_bound_type(), i.upper(), i.upper_bound_type())
+	{}
+
+	static FastDoubleInterval empty_interval() {
+		return FastDoubleInterval(0, 0, LOWER_STRICT | UPPER_STRICT);
+	}
+	static FastDoubleInterval unbounded_interval() {
+		return FastDoubleInterval(-fast_interval::infinity, fast_interval::infinity);
+	}
+
+	/// Converts to Interval<double>.
+	Interval<double> to_interval() const {
+		if (is_empty()) return Interval<double>::empty_interval();
+		return Interval<double>(std::isinf(mLower) ? 0.0 : mLower, lower_bound_type(), std::isinf(mUpper) ? 0.0 : mUpper, upper_bound_type());
+	}
+
+	/// Returns the lower bound, which is -infinity if the bound is infinite.
+	double lower() const {
+		return mLower;
+	}
+	/// Returns the upper bound, which is infinity if the bound is infinite.
+	double upper() const {
+		return mUpper;
+	}
+	BoundType lower_bound_type() const {
+		if (std::isinf(mLower)) return BoundType::INFTY;
+		return (mFlags & LOWER_STRICT) ? BoundType::STRICT : BoundType::WEAK;
+	}
+	BoundType upper_bound_type() const {
+		if (std::isinf(mUpper)) return BoundType::INFTY;
+		return (mFlags & UPPER_STRICT) ? BoundType::STRICT : BoundType::WEAK;
+	}
+	bool lower_strict() const {
+		return mFlags & LOWER_STRICT;
+	}
+	bool upper_strict() const {
+		return mFlags & UPPER_STRICT;
+	}
+
+	bool is_empty() const {
+		return mLower == mUpper && mFlags != 0;
+	}
+	bool is_unbounded() const {
+		return std::isinf(mLower) && std::isinf(mUpper);
+	}
+	bool is_point_interval() const {
+		return mLower == mUpper && mFlags == 0;
+	}
+	bool is_zero() const {
+		return is_point_interval() && mLower == 0;
+	}
+	bool is_closed_interval() const {
+		return mFlags == 0;
+	}
+
+	/// Returns the width of the interval, rounded upward.
+	double diameter() const {
+		if (is_empty()) return 0;
+		return fast_interval::add_up(mUpper, -mLower);
+	}
+	/// Returns the midpoint of the interval, assuming that it is bounded.
+	double center() const {
+		assert(std::isfinite(mLower) && std::isfinite(mUpper));
+		return mLower / 2 + mUpper / 2;
+	}
+
+	bool contains(double n) const {
+		if (n < mLower || (n == mLower && lower_strict())) return false;
+		if (n > mUpper || (n == mUpper && upper_strict())) return false;
+		return true;
+	}
+	bool contains(const FastDoubleInterval& rhs) const {
+		if (rhs.is_empty()) return true;
+		if (rhs.mLower < mLower || (rhs.mLower == mLower && lower_strict() && !rhs.lower_strict())) return false;
+		if (rhs.mUpper > mUpper || (rhs.mUpper == mUpper && upper_strict() && !rhs.upper_strict())) return false;
+		return true;
+	}
+
+	FastDoubleInterval intersect(const FastDoubleInterval& rhs) const {
+		if (is_empty() || rhs.is_empty()) return empty_interval();
+		double lower = mLower;
+		bool ls = lower_strict();
+		if (rhs.mLower > lower) {
+			lower = rhs.mLower;
+			ls = rhs.lower_strict();
+		} else if (rhs.mLower == lower) {
+			ls = ls || rhs.lower_strict();
+		}
+		double upper = mUpper;
+		bool us = upper_strict();
+		if (rhs.mUpper < upper) {
+			upper = rhs.mUpper;
+			us = rhs.upper_strict();
+		} else if (rhs.mUpper == upper) {
+			us = us || rhs.upper_strict();
+		}
+		return FastDoubleInterval(lower, upper, flags(ls, us));
+	}
+	/// Returns the smallest interval containing both intervals.
+	FastDoubleInterval convex_hull(const FastDoubleInterval& rhs) const {
+		if (is_empty()) return rhs;
+		if (rhs.is_empty()) return *this;
+		double lower = mLower;
+		bool ls = lower_strict();
+		select<true>(lower, ls, rhs.mLower, rhs.lower_strict());
+		double upper = mUpper;
+		bool us = upper_strict();
+		select<false>(upper, us, rhs.mUpper, rhs.upper_strict());
+		return FastDoubleInterval(lower, upper, flags(ls, us));
+	}
+
+	FastDoubleInterval operator-() const {
+		if (is_empty()) return *this;
+		return FastDoubleInterval(-mUpper, -mLower, flags(upper_strict(), lower_strict()));
+	}
+
+	FastDoubleInterval add(const FastDoubleInterval& rhs) const {
+		if (is_empty() || rhs.is_empty()) return empty_interval();
+		return FastDoubleInterval(
+			fast_interval::add_down(mLower, rhs.mLower),
+			fast_interval::add_up(mUpper, rhs.mUpper),
+			flags(lower_strict() || rhs.lower_strict(), upper_strict() || rhs.upper_strict())
+		);
+	}
+	FastDoubleInterval sub(const FastDoubleInterval& rhs) const {
+		return add(-rhs);
+	}
+	FastDoubleInterval mul(const FastDoubleInterval& rhs) const {
+		if (is_empty() || rhs.is_empty()) return empty_interval();
+		double lower = fast_interval::infinity;
+		double upper = -fast_interval::infinity;
+		bool ls = true;
+		bool us = true;
+		const double a[2] = { mLower, mUpper };
+		const bool as[2] = { lower_strict(), upper_strict() };
+		const double b[2] = { rhs.mLower, rhs.mUpper };
+		const bool bs[2] = { rhs.lower_strict(), rhs.upper_strict() };
+		for (std::size_t i = 0; i < 2; ++i) {
+			for (std::size_t j = 0; j < 2; ++j) {
+				// A product with an attained zero is attained, otherwise both factors must be attained.
+				bool strict = (a[i] == 0 && !as[i]) || (b[j] == 0 && !bs[j]) ? false : (as[i] || bs[j]);
+				double down, up;
+				fast_interval::mul_round(a[i], b[j], down, up);
+				select<true>(lower, ls, down, strict);
+				select<false>(upper, us, up, strict);
+			}
+		}
+		return FastDoubleInterval(lower, upper, flags(ls, us));
+	}
+	/**
+	 * Divides by the given interval.
+	 * If the divisor contains zero or has zero as a bound, the result is the unbounded interval.
+	 */
+	FastDoubleInterval div(const FastDoubleInterval& rhs) const {
+		if (is_empty() || rhs.is_empty()) return empty_interval();
+		if (rhs.mLower <= 0 && rhs.mUpper >= 0) return unbounded_interval();
+		double lower = fast_interval::infinity;
+		double upper = -fast_interval::infinity;
+		bool ls = true;
+		bool us = true;
+		const double a[2] = { mLower, mUpper };
+		const bool as[2] = { lower_strict(), upper_strict() };
+		const double b[2] = { rhs.mLower, rhs.mUpper };
+		const bool bs[2] = { rhs.lower_strict(), rhs.upper_strict() };
+		for (std::size_t i = 0; i < 2; ++i) {
+			for (std::size_t j = 0; j < 2; ++j) {
+				bool strict = (a[i] == 0 && !as[i]) ? false : (as[i] || bs[j]);
+				if (std::isinf(a[i]) && std::isinf(b[j])) {
+					// inf/inf: the quotient is unbounded in the direction given by the signs, or tends to zero.
+					bool positive = (a[i] > 0) == (b[j] > 0);
+					select<true>(lower, ls, positive ? 0.0 : -fast_interval::infinity, true);
+					select<false>(upper, us, positive ? fast_interval::infinity : 0.0, true);
+					continue;
+				}
+				select<true>(lower, ls, fast_interval::div_down(a[i], b[j]), strict);
+				select<false>(upper, us, fast_interval::div_up(a[i], b[j]), strict);
+			}
+		}
+		return FastDoubleInterval(lower, upper, flags(ls, us));
+	}
+
+	/// Raises the interval to the given power.
+	FastDoubleInterval pow(std::size_t exp) const {
+		if (is_empty()) return *this;
+		if (exp == 0) return FastDoubleInterval(1.0);
+		auto pow_down = [exp](double d) {
+			double res = d;
+			for (std::size_t i = 1; i < exp; ++i) res = fast_interval::mul_down(res, d);
+			return res;
+		};
+		auto pow_up = [exp](double d) {
+			double res = d;
+			for (std::size_t i = 1; i < exp; ++i) res = fast_interval::mul_up(res, d);
+			return res;
+		};
+		if (exp % 2 == 1 || mLower >= 0) {
+			// Monotone on the whole interval.
+			double lower = mLower >= 0 ? pow_down(mLower) : -pow_up(-mLower);
+			double upper = mUpper >= 0 ? pow_up(mUpper) : -pow_down(-mUpper);
+			return FastDoubleInterval(lower, upper, mFlags);
+		}
+		if (mUpper <= 0) {
+			return FastDoubleInterval(pow_down(-mUpper), pow_up(-mLower), flags(upper_strict(), lower_strict()));
+		}
+		// The interval contains zero in its interior.
+		double upper = -mLower;
+		bool us = lower_strict();
+		select<false>(upper, us, mUpper, upper_strict());
+		return FastDoubleInterval(0, pow_up(upper), flags(false, us));
+	}
+
+	FastDoubleInterval& operator+=(const FastDoubleInterval& rhs) {
+		return *this = add(rhs);
+	}
+	FastDoubleInterval& operator-=(const FastDoubleInterval& rhs) {
+		return *this = sub(rhs);
+	}
+	FastDoubleInterval& operator*=(const FastDoubleInterval& rhs) {
+		return *this = mul(rhs);
+	}
+	FastDoubleInterval& operator/=(const FastDoubleInterval& rhs) {
+		return *this = div(rhs);
+	}
+
+	bool operator==(const FastDoubleInterval& rhs) const {
+		return mLower == rhs.mLower && mUpper == rhs.mUpper && mFlags == rhs.mFlags;
+	}
+	bool operator!=(const FastDoubleInterval& rhs) const {
+		return !(*this == rhs);
+	}
+};
+
+static_assert(std::is_trivially_copyable<FastDoubleInterval>::value, "FastDoubleInterval should be trivially copyable");
+static_assert(sizeof(FastDoubleInterval) <= 3 * sizeof(double), "FastDoubleInterval should consist of two doubles and the flags");
+
+inline FastDoubleInterval operator+(const FastDoubleInterval& lhs, const FastDoubleInterval& rhs) {
+	return lhs.add(rhs);
+}
+inline FastDoubleInterval operator-(const FastDoubleInterval& lhs, const FastDoubleInterval& rhs) {
+	return lhs.sub(rhs);
+}
+inline FastDoubleInterval operator*(const FastDoubleInterval& lhs, const FastDoubleInterval& rhs) {
+	return lhs.mul(rhs);
+}
+inline FastDoubleInterval operator/(const FastDoubleInterval& lhs, const FastDoubleInterval& rhs) {
+	return lhs.div(rhs);
+}
+inline FastDoubleInterval pow(const FastDoubleInterval& i, std::size_t exp) {
+	return i.pow(exp);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const FastDoubleInterval& i) {
+	if (i.is_empty()) return os << "(0, 0)";
+	os << (i.lower_bound_type() == BoundType::WEAK ? "[" : "(");
+	if (std::isinf(i.lower())) os << "-INF";
+	else os << i.lower();
+	os << ", ";
+	if (std::isinf(i.upper())) os << "INF";
+	else os << i.upper();
+	return os << (i.upper_bound_type() == BoundType::WEAK ? "]" : ")");
+}
+
+}
@@ -13,7 +13,6 @@
 #include <carl-arith/poly/umvpoly/functions/IntervalEvaluation.h>
 #include <algorithm>
 
-//#define CONTRACTION_DEBUG
 //#define USE_HORNER
 
 namespace carl {
@@ -52,9 +51,7 @@ namespace carl {
                 mDenominator(nullptr)
             {
         
-                #ifdef CONTRACTION_DEBUG
-                std::cout << __func__ << ": [Polynome]: " << p << " [#Terms]: " << p.nr_terms() << std::endl;     
-                #endif
+                CARL_LOG_DEBUG("carl.contraction", __func__ << ": [Polynome]: " << p << " [#Terms]: " << p.nr_terms());
 
 
                 assert(p.has(x));
@@ -65,16 +62,12 @@ namespace carl {
                 
                 // Construct the solution formula for x in p = 0
 
-                #ifdef CONTRACTION_DEBUG
-                std::cout << __func__ << ": Propagating... " << std::endl;     
-                #endif
+                CARL_LOG_DEBUG("carl.contraction", __func__ << ": Propagating... ");
 
                 // Case 1.):
                 if (p.is_linear())
                 {
-                    #ifdef CONTRACTION_DEBUG
-                    std::cout << __func__ << ": Case 1. (linear)... " << std::endl;     
-                    #endif
+                    CARL_LOG_DEBUG("carl.contraction", __func__ << ": Case 1. (linear)... ");
                     for (const auto& t: p) {
                         assert(t.monomial() != nullptr);
                         if (t.has(x)) {
@@ -83,9 +76,7 @@ namespace carl {
                             mNumerator -= x;
                             mNumerator *= (-1);
                             
-                            #ifdef CONTRACTION_DEBUG
-                            std::cout << __func__ << ": Setting mNumerator:" << mNumerator << std::endl;     
-                            #endif
+                            CARL_LOG_DEBUG("carl.contraction", __func__ << ": Setting mNumerator:" << mNumerator);
 
                             return;
                         }
@@ -95,9 +86,7 @@ namespace carl {
                 // Case 2.)
                 else
                 {   
-                    #ifdef CONTRACTION_DEBUG
-                    std::cout << __func__ << ": Case 2. (non-linear)... " << std::endl;     
-                    #endif
+                    CARL_LOG_DEBUG("carl.contraction", __func__ << ": Case 2. (non-linear)... ");
 
                     assert(p.nr_terms() == 2);
                     typename Polynomial::TermsType::const_iterator yIter;
@@ -117,7 +106,6 @@ namespace carl {
 
                     assert(xIter->monomial() != nullptr);
                     assert(!xIter->is_linear() || xIter->coeff() == (-1));
-                    //std::cout << "[Case 2]" << std::endl;
                     if (xIter->is_linear()) 
                     {
                         mNumerator = Polynomial ( *yIter );
@@ -125,19 +113,13 @@ namespace carl {
                     else
                     {
                         mRoot = xIter->monomial()->exponent_of_variable(x);
-                        #ifdef CONTRACTION_DEBUG
-                        std::cout << __func__ << ": Setting mRoot:" << mRoot << std::endl;     
-                        #endif
+                        CARL_LOG_DEBUG("carl.contraction", __func__ << ": Setting mRoot:" << mRoot);
               
                         mDenominator = xIter->monomial()->drop_variable(x);
-                        #ifdef CONTRACTION_DEBUG
-                        std::cout << __func__ << ": Setting mDenominator:" << mDenominator << std::endl;     
-                        #endif
+                        CARL_LOG_DEBUG("carl.contraction", __func__ << ": Setting mDenominator:" << mDenominator);
                         mNumerator = -Polynomial ( *yIter );
                     }
-                    #ifdef CONTRACTION_DEBUG
-                    std::cout << __func__ << ": Setting mNumerator:" << mNumerator << std::endl;     
-                    #endif                         
+                    CARL_LOG_DEBUG("carl.contraction", __func__ << ": Setting mNumerator:" << mNumerator);
                 }
             }
             
@@ -335,9 +317,7 @@ namespace carl {
                     #endif
                 }
 
-                #ifdef CONTRACTION_DEBUG
-                std::cout << __func__ << ": contraction of " << variable << " with " << intervals << " in " << mConstraint << " mpOriginal: " << mpOriginal << std::endl;
-                #endif
+                CARL_LOG_DEBUG("carl.contraction", __func__ << ": contraction of " << variable << " with " << intervals << " in " << mConstraint << " mpOriginal: " << mpOriginal);
 
                 #ifdef USE_HORNER
                 splitOccurredInContraction = Operator<Polynomial>::contract(intervals, variable, mHornerForm, (*it).second, resA, resB, useNiceCenter);
@@ -366,9 +346,7 @@ namespace carl {
                 // calculate result of propagation
                 std::vector<Interval<double>> resultPropagation = const_iterator_VarSolutionFormula->second.evaluate( intervals );
                 
-                #ifdef CONTRACTION_DEBUG
-                std::cout << "  propagation result: " << resultPropagation << std::endl;
-                #endif
+                CARL_LOG_DEBUG("carl.contraction", "  propagation result: " << resultPropagation);
 
                 if( resultPropagation.empty() )
                 {
@@ -476,9 +454,7 @@ namespace carl {
                     {
                         resB = resB.convex_hull( *iter );
                     }
-                    #ifdef CONTRACTION_DEBUG
-                    std::cout << "  after propagation: " << resA; if( !resB.is_empty() ) { std::cout << " and " << resB; } std::cout << std::endl;                            
-                    #endif
+                    CARL_LOG_DEBUG("carl.contraction", "  after propagation: " << resA << " / " << resB);
                     return true;
                 }              
             }
@@ -509,12 +485,10 @@ namespace carl {
             }
             Interval<double> centerInterval = Interval<double>(center);
             
-			#ifdef CONTRACTION_DEBUG
-            std::cout << "variable = " << variable << std::endl;
-            std::cout << "constraint = " << constraint << std::endl;
-            std::cout << "derivative = " << derivative << std::endl;
-			std::cout << __func__ << ": centerInterval: " << centerInterval << std::endl;
-			#endif
+			CARL_LOG_DEBUG("carl.contraction", "variable = " << variable);
+			CARL_LOG_DEBUG("carl.contraction", "constraint = " << constraint);
+			CARL_LOG_DEBUG("carl.contraction", "derivative = " << derivative);
+			CARL_LOG_DEBUG("carl.contraction", __func__ << ": centerInterval: " << centerInterval);
 			
             // Create map for replacement of variables by intervals and replacement of center by point interval
             typename Interval<double>::evalintervalmap substitutedIntervalMap = intervals;
@@ -532,15 +506,11 @@ namespace carl {
 
             Interval<double> result1, result2;
 			
-			#ifdef CONTRACTION_DEBUG
-			std::cout << __func__ << ": numerator: " << numerator << ", denominator: " << denominator << std::endl;
-			#endif
+			CARL_LOG_DEBUG("carl.contraction", __func__ << ": numerator: " << numerator << ", denominator: " << denominator);
             
             bool split = numerator.div_ext(denominator, result1, result2);
             if (split) {
-				#ifdef CONTRACTION_DEBUG
-				std::cout << __func__ << ": caused split: " << result1 << " and " << result2 << std::endl;
-				#endif
+				CARL_LOG_DEBUG("carl.contraction", __func__ << ": caused split: " << result1 << " and " << result2);
                 splitOccurred = true;
                 if(result1 >= result2) {
                     resA = carl::set_intersection(intervals.at(variable), centerInterval.sub(result1));
@@ -555,9 +525,7 @@ namespace carl {
                     resA = resA.integral_part();
                     resB = resB.integral_part();
                 }
-                #ifdef CONTRACTION_DEBUG
-                std::cout << __func__ << ": result after intersection: " << resA << " and " << resB << std::endl;
-                #endif
+                CARL_LOG_DEBUG("carl.contraction", __func__ << ": result after intersection: " << resA << " and " << resB);
                 if( resB.is_empty() )
                 {
                     splitOccurred = false;
@@ -578,19 +546,15 @@ namespace carl {
                     }
                 }
             } else {
-				#ifdef CONTRACTION_DEBUG
-				std::cout << __func__ << ": result: " << result1 << std::endl;
-				std::cout << __func__ << ": center: " << centerInterval << std::endl;
-				std::cout << __func__ << ": center sub: " << centerInterval.sub(result1) << std::endl;
-				std::cout << __func__ << ": intersecting " << intervals.at(variable) << " and " << centerInterval.sub(result1) << std::endl;
-				#endif
+				CARL_LOG_DEBUG("carl.contraction", __func__ << ": result: " << result1);
+				CARL_LOG_DEBUG("carl.contraction", __func__ << ": center: " << centerInterval);
+				CARL_LOG_DEBUG("carl.contraction", __func__ << ": center sub: " << centerInterval.sub(result1));
+				CARL_LOG_DEBUG("carl.contraction", __func__ << ": intersecting " << intervals.at(variable) << " and " << centerInterval.sub(result1));
                 resA = carl::set_intersection(intervals.at(variable), centerInterval.sub(result1));
 				if (variable.type() == VariableType::VT_INT) {
 					resA = resA.integral_part();
 				}
-				#ifdef CONTRACTION_DEBUG
-				std::cout << __func__ << ": result after intersection: " << resA << std::endl;
-				#endif
+				CARL_LOG_DEBUG("carl.contraction", __func__ << ": result after intersection: " << resA);
             }
             return splitOccurred;
         }
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <carl-arith/constraint/BasicConstraint.h>
+#include <carl-arith/interval/Interval.h>
+#include <carl-arith/interval/Power.h>
+#include <carl-arith/interval/SetTheory.h>
+#include <carl-arith/poly/umvpoly/functions/horner/HornerForm.h>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace carl {
+namespace contractor {
+
+/**
+ * Implements the HC4 revise operator (forward-backward contraction) for a single polynomial constraint.
+ *
+ * The left hand side of the constraint is converted into a multivariate Horner scheme, shared via the HornerPool, which is flattened into a directed acyclic graph of elementary operations.
+ * Every variable is represented by a single leaf, nodes are stored such that all children precede their parents and the root is the last node.
+ * The forward pass evaluates all nodes over the current box, the backward pass intersects the root with the relation and projects the result back to all children.
+ *
+ * Variables are identified by their index in a box, which is shared among all contractors of a Propagator.
+ */
+template<typename Polynomial, typename Number = double>
+class HC4 {
+public:
+	using Box = std::vector<Interval<Number>>;
+private:
+	enum class NodeType { CONSTANT, VARIABLE, ADD, MUL, POW };
+	struct Node {
+		NodeType type;
+		/// The left child, or the index of the variable in the box.
+		std::size_t lhs;
+		/// The right child, or the exponent.
+		std::size_t rhs;
+		/// The value of a constant, or the variable of a leaf.
+		Interval<Number> constant;
+		Variable variable;
+	};
+
+	/// The shared Horner form of the left hand side, which keeps it alive in the HornerPool. Null if the left hand side is constant.
+	std::shared_ptr<const HornerForm<Polynomial, Number>> mHorner;
+	std::vector<Node> mNodes;
+	/// Maps variables to their leaf in mNodes.
+	std::map<Variable, std::size_t> mLeaves;
+	/// Indices of all variables of this constraint in a box.
+	std::vector<std::size_t> mVariables;
+	/// The set the left hand side must be contained in.
+	Interval<Number> mRelation;
+	/// Whether the constraint is a disequality, which can only be used to detect conflicts.
+	bool mNotEqual = false;
+	/// Workspace for the values of all nodes.
+	std::vector<Interval<Number>> mValues;
+
+	std::size_t add_node(NodeType type, std::size_t lhs, std::size_t rhs, const Interval<Number>& constant = Interval<Number>(0)) {
+		mNodes.push_back(Node{ type, lhs, rhs, constant, Variable::NO_VARIABLE });
+		return mNodes.size() - 1;
+	}
+	template<typename Coeff>
+	std::size_t add_constant(const Coeff& c) {
+		return add_node(NodeType::CONSTANT, 0, 0, Interval<Number>(c));
+	}
+	std::size_t add_variable(Variable v, std::map<Variable, std::size_t>& index) {
+		auto it = mLeaves.find(v);
+		if (it != mLeaves.end()) return it->second;
+		auto vit = index.emplace(v, index.size()).first;
+		mVariables.push_back(vit->second);
+		std::size_t res = add_node(NodeType::VARIABLE, vit->second, 0);
+		mNodes[res].variable = v;
+		mLeaves.emplace(v, res);
+		return res;
+	}
+	/**
+	 * Flattens h = x^e * dependent + independent into nodes.
+	 * Chains like x * (x * d) are merged into x^2 * d, as HC4 projects powers much better than products of dependent factors.
+	 */
+	std::size_t add_horner(const MultivariateHorner<Polynomial, strategy>& h, std::map<Variable, std::size_t>& index) {
+		if (h.getVariable() == Variable::NO_VARIABLE) {
+			return add_constant(h.getIndepConstant());
+		}
+		std::size_t exponent = h.getExponent();
+		const auto* dep = &h;
+		while (dep->getDependent() && dep->getDependent()->getVariable() == h.getVariable() && !dep->getDependent()->getIndependent() && carl::is_zero(dep->getDependent()->getIndepConstant())) {
+			dep = dep->getDependent().get();
+			exponent += dep->getExponent();
+		}
+		std::size_t res = add_variable(h.getVariable(), index);
+		if (exponent > 1) {
+			res = add_node(NodeType::POW, res, exponent);
+		}
+		if (dep->getDependent()) {
+			res = add_node(NodeType::MUL, res, add_horner(*dep->getDependent(), index));
+		} else if (!carl::is_one(dep->getDepConstant())) {
+			res = add_node(NodeType::MUL, res, add_constant(dep->getDepConstant()));
+		}
+		if (h.getIndependent()) {
+			res = add_node(NodeType::ADD, res, add_horner(*h.getIndependent(), index));
+		} else if (!carl::is_zero(h.getIndepConstant())) {
+			res = add_node(NodeType::ADD, res, add_constant(h.getIndepConstant()));
+		}
+		return res;
+	}
+
+	/// Returns the hull of the parts of a / b within current.
+	static Interval<Number> project_div(const Interval<Number>& a, const Interval<Number>& b, const Interval<Number>& current) {
+		Interval<Number> resA;
+		Interval<Number> resB;
+		if (a.div_ext(b, resA, resB)) {
+			resA = set_intersection(resA, current);
+			resB = set_intersection(resB, current);
+			if (resA.is_empty()) return resB;
+			if (resB.is_empty()) return resA;
+			return resA.convex_hull(resB);
+		}
+		return set_intersection(resA, current);
+	}
+	/// Returns the hull of all exp'th roots of a within current.
+	static Interval<Number> project_root(const Interval<Number>& a, std::size_t exp, const Interval<Number>& current) {
+		auto root = a.root(static_cast<int>(exp));
+		if (exp % 2 == 1 || root.is_empty()) {
+			return set_intersection(root, current);
+		}
+		auto pos = set_intersection(root, current);
+		auto neg = set_intersection(-root, current);
+		if (pos.is_empty()) return neg;
+		if (neg.is_empty()) return pos;
+		return pos.convex_hull(neg);
+	}
+
+	void forward(const Box& box) {
+		mValues.resize(mNodes.size());
+		for (std::size_t i = 0; i < mNodes.size(); ++i) {
+			const auto& n = mNodes[i];
+			switch (n.type) {
+				case NodeType::CONSTANT: mValues[i] = n.constant; break;
+				case NodeType::VARIABLE: mValues[i] = box[n.lhs]; break;
+				case NodeType::ADD: mValues[i] = mValues[n.lhs] + mValues[n.rhs]; break;
+				case NodeType::MUL: mValues[i] = mValues[n.lhs] * mValues[n.rhs]; break;
+				case NodeType::POW: mValues[i] = carl::pow(mValues[n.lhs], n.rhs); break;
+			}
+		}
+	}
+	/// Returns false if some node has an empty value.
+	bool backward() {
+		for (std::size_t i = mNodes.size(); i-- > 0;) {
+			const auto& n = mNodes[i];
+			const auto& value = mValues[i];
+			if (value.is_empty()) return false;
+			switch (n.type) {
+				case NodeType::CONSTANT:
+				case NodeType::VARIABLE:
+					break;
+				case NodeType::ADD:
+					mValues[n.lhs] = set_intersection(mValues[n.lhs], value - mValues[n.rhs]);
+					mValues[n.rhs] = set_intersection(mValues[n.rhs], value - mValues[n.lhs]);
+					break;
+				case NodeType::MUL:
+					mValues[n.lhs] = project_div(value, mValues[n.rhs], mValues[n.lhs]);
+					mValues[n.rhs] = project_div(value, mValues[n.lhs], mValues[n.rhs]);
+					break;
+				case NodeType::POW:
+					mValues[n.lhs] = project_root(value, n.rhs, mValues[n.lhs]);
+					break;
+			}
+		}
+		return true;
+	}
+
+public:
+	/**
+	 * Creates a contractor for the given constraint.
+	 * Variables that are not yet in the given index are added to it.
+	 */
+	HC4(const BasicConstraint<Polynomial>& c, std::map<Variable, std::size_t>& index) {
+		if (c.lhs().is_constant()) {
+			add_constant(c.lhs().constant_part());
+		} else {
+			mHorner = horner_form<Number>(c.lhs());
+			add_horner(mHorner->horner(), index);
+		}
+		switch (c.relation()) {
+			case Relation::LESS: mRelation = Interval<Number>(0, BoundType::INFTY, 0, BoundType::STRICT); break;
+			case Relation::LEQ: mRelation = Interval<Number>(0, BoundType::INFTY, 0, BoundType::WEAK); break;
+			case Relation::EQ: mRelation = Interval<Number>(0, BoundType::WEAK, 0, BoundType::WEAK); break;
+			case Relation::NEQ:
+				mRelation = Interval<Number>::unbounded_interval();
+				mNotEqual = true;
+				break;
+			case Relation::GEQ: mRelation = Interval<Number>(0, BoundType::WEAK, 0, BoundType::INFTY); break;
+			case Relation::GREATER: mRelation = Interval<Number>(0, BoundType::STRICT, 0, BoundType::INFTY); break;
+		}
+		CARL_LOG_DEBUG("carl.contractor", "HC4 for " << c << " with " << mNodes.size() << " nodes");
+	}
+
+	/// Returns the indices of the variables of this constraint.
+	const std::vector<std::size_t>& variables() const {
+		return mVariables;
+	}
+	/// Returns the Horner form of the left hand side, null if it is constant.
+	const std::shared_ptr<const HornerForm<Polynomial, Number>>& horner() const {
+		return mHorner;
+	}
+	/// Returns the number of nodes.
+	std::size_t size() const {
+		return mNodes.size();
+	}
+
+	/**
+	 * Evaluates the left hand side over the given box.
+	 */
+	Interval<Number> evaluate(const Box& box) {
+		forward(box);
+		return mValues.back();
+	}
+
+	/**
+	 * Contracts the given box with respect to this constraint.
+	 * Returns false if the box contains no solution of the constraint, the box is left in an unspecified state then.
+	 * Otherwise the box is contracted and the indices of all variables whose interval has changed are appended to changed.
+	 */
+	bool contract(Box& box, std::vector<std::size_t>& changed) {
+		forward(box);
+		if (mNotEqual) {
+			return !mValues.back().is_zero();
+		}
+		mValues.back() = set_intersection(mValues.back(), mRelation);
+		if (!backward()) return false;
+		for (const auto& [var, leaf]: mLeaves) {
+			auto value = mValues[leaf];
+			if (var.type() == VariableType::VT_INT) {
+				value = value.integral_part();
+			}
+			if (value.is_empty()) return false;
+			std::size_t i = mNodes[leaf].lhs;
+			if (value != box[i]) {
+				box[i] = value;
+				changed.push_back(i);
+			}
+		}
+		return true;
+	}
+};
+
+}
+}
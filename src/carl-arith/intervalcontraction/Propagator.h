@@ -0,0 +1,240 @@
+#pragma once
+
+#include "HC4.h"
+
+#include <carl-arith/interval/Sampling.h>
+
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <utility>
+
+namespace carl {
+namespace contractor {
+
+enum class PropagationResult {
+	/// No interval was changed.
+	UNCHANGED,
+	/// Some interval was contracted.
+	CONTRACTED,
+	/// The box contains no solution.
+	EMPTY
+};
+
+inline std::ostream& operator<<(std::ostream& os, PropagationResult r) {
+	switch (r) {
+		case PropagationResult::UNCHANGED: return os << "UNCHANGED";
+		case PropagationResult::CONTRACTED: return os << "CONTRACTED";
+		case PropagationResult::EMPTY: return os << "EMPTY";
+	}
+	return os;
+}
+
+struct PropagatorSettings {
+	/// Contractions of a variable by less than this fraction of its width do not schedule other constraints.
+	double min_relative_gain = 0.01;
+	/// Maximal number of revisions per call to propagate.
+	std::size_t max_revisions = 1000;
+	/// Weight of the previous average when updating the average gain of a constraint.
+	double gain_decay = 0.5;
+};
+
+/**
+ * Propagates a set of polynomial constraints over a box of intervals using HC4 contractors.
+ *
+ * Constraints to revise are kept in a worklist that is ordered by the average relative gain of their previous revisions, such that constraints that contracted well in the past are revised first.
+ * Whenever a revision contracts a variable by at least PropagatorSettings::min_relative_gain, all other constraints containing this variable are scheduled.
+ * Together with split(), this allows for a simple branch and prune search as done by an ICP backend.
+ */
+template<typename Polynomial, typename Number = double>
+class Propagator {
+public:
+	using Box = std::vector<Interval<Number>>;
+	using BoxMap = std::map<Variable, Interval<Number>>;
+private:
+	PropagatorSettings mSettings;
+	std::map<Variable, std::size_t> mIndex;
+	std::vector<Variable> mVariables;
+	std::vector<HC4<Polynomial, Number>> mContractors;
+	/// Maps variable indices to the constraints containing them.
+	std::vector<std::vector<std::size_t>> mWatches;
+	/// Average relative gain per constraint.
+	std::vector<double> mGain;
+	std::vector<bool> mQueued;
+	std::size_t mRevisions = 0;
+	std::size_t mContractions = 0;
+
+	static double width(const Interval<Number>& i) {
+		if (i.lower_bound_type() == BoundType::INFTY || i.upper_bound_type() == BoundType::INFTY) {
+			return std::numeric_limits<double>::infinity();
+		}
+		return carl::to_double(i.upper()) - carl::to_double(i.lower());
+	}
+	/// Returns the relative gain of contracting from to to.
+	static double relative_gain(const Interval<Number>& from, const Interval<Number>& to) {
+		if (from == to) return 0;
+		double before = width(from);
+		double after = width(to);
+		if (std::isinf(before)) return std::isinf(after) ? 0.5 : 1.0;
+		if (before <= 0) return 0;
+		return (before - after) / before;
+	}
+
+public:
+	explicit Propagator(const PropagatorSettings& settings = PropagatorSettings()): mSettings(settings) {}
+
+	/**
+	 * Adds a constraint and returns its index.
+	 */
+	std::size_t add(const BasicConstraint<Polynomial>& c) {
+		std::size_t id = mContractors.size();
+		mContractors.emplace_back(c, mIndex);
+		mVariables.resize(mIndex.size());
+		for (const auto& [v, i]: mIndex) mVariables[i] = v;
+		mWatches.resize(mIndex.size());
+		for (auto v: mContractors.back().variables()) {
+			mWatches[v].push_back(id);
+		}
+		mGain.push_back(1.0);
+		mQueued.push_back(false);
+		return id;
+	}
+
+	/// Returns the variables, their position is their index in a Box.
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+	std::size_t size() const {
+		return mContractors.size();
+	}
+	/// Returns the average relative gain of the given constraint.
+	double gain(std::size_t constraint) const {
+		return mGain[constraint];
+	}
+	/// Returns the total number of revisions.
+	std::size_t revisions() const {
+		return mRevisions;
+	}
+	/// Returns the total number of revisions that contracted some interval.
+	std::size_t contractions() const {
+		return mContractions;
+	}
+
+	/// Converts a map to a box, missing variables are unbounded.
+	Box to_box(const BoxMap& map) const {
+		Box res(mVariables.size(), Interval<Number>::unbounded_interval());
+		for (std::size_t i = 0; i < mVariables.size(); ++i) {
+			auto it = map.find(mVariables[i]);
+			if (it != map.end()) res[i] = it->second;
+		}
+		return res;
+	}
+	/// Writes a box back to a map.
+	void to_map(const Box& box, BoxMap& map) const {
+		for (std::size_t i = 0; i < mVariables.size(); ++i) {
+			map[mVariables[i]] = box[i];
+		}
+	}
+
+	/**
+	 * Contracts the box with respect to all constraints until no constraint yields a sufficient gain or the revision budget is exhausted.
+	 */
+	PropagationResult propagate(Box& box) {
+		assert(box.size() == mVariables.size());
+		using Entry = std::pair<double, std::size_t>;
+		std::priority_queue<Entry> queue;
+		for (std::size_t c = 0; c < mContractors.size(); ++c) {
+			queue.emplace(mGain[c], c);
+			mQueued[c] = true;
+		}
+		bool contracted = false;
+		std::size_t revisions = 0;
+		std::vector<std::size_t> changed;
+		Box before;
+		while (!queue.empty() && revisions < mSettings.max_revisions) {
+			std::size_t c = queue.top().second;
+			queue.pop();
+			mQueued[c] = false;
+			++revisions;
+			++mRevisions;
+			changed.clear();
+			before.clear();
+			for (auto v: mContractors[c].variables()) before.push_back(box[v]);
+			if (!mContractors[c].contract(box, changed)) {
+				CARL_LOG_DEBUG("carl.contractor", "Constraint " << c << " yields an empty box");
+				for (std::size_t d = 0; d < mQueued.size(); ++d) mQueued[d] = false;
+				return PropagationResult::EMPTY;
+			}
+			double gain = 0;
+			if (!changed.empty()) {
+				++mContractions;
+				contracted = true;
+				const auto& vars = mContractors[c].variables();
+				for (std::size_t k = 0; k < vars.size(); ++k) {
+					double g = relative_gain(before[k], box[vars[k]]);
+					gain = std::max(gain, g);
+					if (g < mSettings.min_relative_gain) continue;
+					for (auto d: mWatches[vars[k]]) {
+						if (d == c || mQueued[d]) continue;
+						queue.emplace(mGain[d], d);
+						mQueued[d] = true;
+					}
+				}
+			}
+			mGain[c] = mSettings.gain_decay * mGain[c] + (1 - mSettings.gain_decay) * gain;
+		}
+		while (!queue.empty()) {
+			mQueued[queue.top().second] = false;
+			queue.pop();
+		}
+		CARL_LOG_DEBUG("carl.contractor", "Propagation finished after " << revisions << " revisions");
+		return contracted ? PropagationResult::CONTRACTED : PropagationResult::UNCHANGED;
+	}
+	/// Contracts the given map, see propagate(Box&).
+	PropagationResult propagate(BoxMap& map) {
+		Box box = to_box(map);
+		auto res = propagate(box);
+		if (res == PropagationResult::CONTRACTED) to_map(box, map);
+		return res;
+	}
+
+	/**
+	 * Selects the variable to split: the one with the largest width, preferring unbounded intervals.
+	 * Returns the number of variables if no interval can be split.
+	 */
+	std::size_t split_variable(const Box& box) const {
+		std::size_t res = box.size();
+		double best = 0;
+		for (std::size_t i = 0; i < box.size(); ++i) {
+			if (box[i].is_point_interval() || box[i].is_empty()) continue;
+			double w = width(box[i]);
+			if (res == box.size() || w > best) {
+				res = i;
+				best = w;
+			}
+		}
+		return res;
+	}
+
+	/**
+	 * Splits the given box at the center of the given variable.
+	 * Returns false if the interval is too small to be split.
+	 */
+	bool split(const Box& box, std::size_t variable, Box& left, Box& right) const {
+		const auto& i = box[variable];
+		if (i.is_point_interval() || i.is_empty()) return false;
+		Number mid = carl::center(i);
+		left = box;
+		right = box;
+		left[variable] = set_intersection(i, Interval<Number>(mid, BoundType::INFTY, mid, BoundType::WEAK));
+		right[variable] = set_intersection(i, Interval<Number>(mid, BoundType::STRICT, mid, BoundType::INFTY));
+		if (mVariables[variable].type() == VariableType::VT_INT) {
+			left[variable] = left[variable].integral_part();
+			right[variable] = right[variable].integral_part();
+		}
+		return !left[variable].is_empty() && !right[variable].is_empty() && left[variable] != i && right[variable] != i;
+	}
+};
+
+}
+}
@@ -0,0 +1,231 @@
+/**
+ * @file Geobucket.h
+ * @ingroup multirp
+ */
+
+#pragma once
+
+#include "Term.h"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * A geobucket @cite Yan98 accumulates a sum of polynomials whose leading terms are removed one by one,
+ * as it happens during multivariate division and reduction.
+ *
+ * The terms are stored in buckets of geometrically growing capacity, each of them sorted like the terms of a polynomial,
+ * that is with the leading term at the back.
+ * Adding a polynomial merges it into the smallest bucket that can hold it and carries overflowing buckets into the next one,
+ * hence every term is merged only a logarithmic number of times.
+ * Equal monomials in different buckets are only combined once they become the leading monomial,
+ * so cancellations are detected lazily.
+ * @ingroup multirp
+ */
+template<typename Polynomial>
+class Geobucket
+{
+public:
+	using Coeff = typename Polynomial::CoeffType;
+	using TermType = Term<Coeff>;
+	using Order = typename Polynomial::OrderedBy;
+private:
+	/// Capacity of the first bucket, every further bucket can hold Base times as many terms.
+	static constexpr std::size_t Base = 4;
+	mutable std::vector<std::vector<TermType>> mBuckets;
+	/// The bucket whose last term is the leading term, only valid if mLeadValid.
+	mutable std::size_t mLead = 0;
+	mutable bool mLeadValid = false;
+
+public:
+	Geobucket() = default;
+
+	explicit Geobucket(const Polynomial& p)
+	{
+		add(p);
+	}
+
+	/**
+	 * @return true iff the represented polynomial is zero.
+	 */
+	bool empty() const
+	{
+		return !findLead();
+	}
+
+	/**
+	 * Adds p.
+	 */
+	void add(const Polynomial& p)
+	{
+		if (is_zero(p)) return;
+		p.makeOrdered();
+		add(std::vector<TermType>(p.begin(), p.end()));
+	}
+
+	/**
+	 * Adds factor * p.
+	 */
+	void add(const TermType& factor, const Polynomial& p)
+	{
+		if (is_zero(p) || is_zero(factor)) return;
+		p.makeOrdered();
+		std::vector<TermType> terms;
+		terms.reserve(p.nr_terms());
+		for (const auto& t: p) {
+			terms.push_back(factor * t);
+		}
+		add(std::move(terms));
+	}
+
+	/**
+	 * Adds a single term.
+	 */
+	void add(const TermType& t)
+	{
+		if (is_zero(t)) return;
+		add(std::vector<TermType>({t}));
+	}
+
+	/**
+	 * Adds the sum of the given terms, which must be sorted like the terms of a polynomial, without duplicates.
+	 */
+	void add(std::vector<TermType>&& terms)
+	{
+		mLeadValid = false;
+		std::size_t bucket = 0;
+		while (capacity(bucket) < terms.size()) ++bucket;
+		while (true) {
+			if (mBuckets.size() <= bucket) mBuckets.resize(bucket + 1);
+			terms = merge(std::move(mBuckets[bucket]), std::move(terms));
+			mBuckets[bucket].clear();
+			if (terms.size() <= capacity(bucket)) break;
+			// Carry the overflowing bucket into the next one.
+			++bucket;
+		}
+		mBuckets[bucket] = std::move(terms);
+	}
+
+	/**
+	 * @return The leading term, must not be called if empty().
+	 */
+	const TermType& lterm() const
+	{
+		bool nonzero = findLead();
+		assert(nonzero);
+		(void)nonzero;
+		return mBuckets[mLead].back();
+	}
+
+	/**
+	 * Removes the leading term, must not be called if empty().
+	 */
+	void strip_lterm()
+	{
+		bool nonzero = findLead();
+		assert(nonzero);
+		(void)nonzero;
+		mBuckets[mLead].pop_back();
+		mLeadValid = false;
+	}
+
+	/**
+	 * Moves the represented polynomial out of the geobucket, which is empty afterwards.
+	 */
+	Polynomial to_polynomial()
+	{
+		std::vector<TermType> res;
+		for (auto& bucket: mBuckets) {
+			res = merge(std::move(res), std::move(bucket));
+		}
+		mBuckets.clear();
+		mLeadValid = false;
+		// Lazily combined coefficients may have cancelled without being removed.
+		res.erase(std::remove_if(res.begin(), res.end(), [](const TermType& t) { return is_zero(t.coeff()); }), res.end());
+		return Polynomial(std::move(res), false, true);
+	}
+
+private:
+	static std::size_t capacity(std::size_t bucket)
+	{
+		std::size_t res = Base;
+		for (std::size_t i = 0; i < bucket; ++i) res *= Base;
+		return res;
+	}
+
+	/**
+	 * Merges two sorted term vectors, adding the coefficients of equal monomials.
+	 */
+	static std::vector<TermType> merge(std::vector<TermType>&& lhs, std::vector<TermType>&& rhs)
+	{
+		if (lhs.empty()) return std::move(rhs);
+		if (rhs.empty()) return std::move(lhs);
+		std::vector<TermType> res;
+		res.reserve(lhs.size() + rhs.size());
+		auto l = lhs.begin();
+		auto r = rhs.begin();
+		while (l != lhs.end() && r != rhs.end()) {
+			switch (Order::compare(l->monomial(), r->monomial())) {
+				case CompareResult::LESS:
+					res.push_back(std::move(*l++));
+					break;
+				case CompareResult::GREATER:
+					res.push_back(std::move(*r++));
+					break;
+				case CompareResult::EQUAL:
+					l->coeff() += r->coeff();
+					if (!is_zero(l->coeff())) res.push_back(std::move(*l));
+					++l;
+					++r;
+					break;
+			}
+		}
+		std::move(l, lhs.end(), std::back_inserter(res));
+		std::move(r, rhs.end(), std::back_inserter(res));
+		return res;
+	}
+
+	/**
+	 * Makes sure that the leading monomial occurs in exactly one bucket with a nonzero coefficient.
+	 * @return false iff all buckets are empty.
+	 */
+	bool findLead() const
+	{
+		if (mLeadValid) return true;
+		while (true) {
+			bool found = false;
+			for (std::size_t i = 0; i < mBuckets.size(); ++i) {
+				if (mBuckets[i].empty()) continue;
+				if (!found) {
+					mLead = i;
+					found = true;
+					continue;
+				}
+				auto& lead = mBuckets[mLead].back();
+				auto& cur = mBuckets[i].back();
+				switch (Order::compare(cur.monomial(), lead.monomial())) {
+					case CompareResult::LESS:
+						break;
+					case CompareResult::GREATER:
+						mLead = i;
+						break;
+					case CompareResult::EQUAL:
+						lead.coeff() += cur.coeff();
+						mBuckets[i].pop_back();
+						break;
+				}
+			}
+			if (!found) return false;
+			if (!is_zero(mBuckets[mLead].back().coeff())) break;
+			mBuckets[mLead].pop_back();
+		}
+		mLeadValid = true;
+		return true;
+	}
+};
+
+}
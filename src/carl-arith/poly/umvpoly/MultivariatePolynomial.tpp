@@ -11,6 +11,7 @@
 #include "Term.h"
 #include "UnivariatePolynomial.h"
 #include <carl-logging/carl-logging.h>
+#include <carl-statistics/carl-statistics.h>
 #include <carl-arith/numbers/numbers.h>
 
 #include <algorithm>
@@ -130,8 +131,7 @@ MultivariatePolynomial<Coeff,Ordering,Policies>::MultivariatePolynomial(const Un
 	mOrdered(false)
 {
 	auto id = mTermAdditionManager.getId();
-	exponent exp = 0;
-	for (const auto& c: p.coefficients()) {
+	auto add = [&](const MultivariatePolynomial& c, exponent exp) {
 		if (exp == 0) {
 			for (const auto& term: c) mTermAdditionManager.template addTerm<true>(id, term);
 		} else {
@@ -139,7 +139,15 @@ MultivariatePolynomial<Coeff,Ordering,Policies>::MultivariatePolynomial(const Un
 				mTermAdditionManager.template addTerm<true>(id, term);
 			}
 		}
-		exp++;
+	};
+	if (p.is_sparse()) {
+		for (const auto& c: p.sparse_coefficients()) add(c.second, c.first);
+	} else {
+		exponent exp = 0;
+		for (const auto& c: p.coefficients()) {
+			add(c, exp);
+			exp++;
+		}
 	}
 	mTermAdditionManager.readTerms(id, mTerms);
 	makeMinimallyOrdered<false, true>();
@@ -152,6 +160,15 @@ MultivariatePolynomial<Coeff,Ordering,Policies>::MultivariatePolynomial(const Un
 	mTerms(),
 	mOrdered(true)
 {
+	if (p.is_sparse()) {
+		mTerms.reserve(p.sparse_coefficients().size());
+		for (const auto& c: p.sparse_coefficients()) {
+			if (c.first == 0) mTerms.emplace_back(c.second);
+			else mTerms.emplace_back(c.second, p.main_var(), c.first);
+		}
+		assert(this->is_consistent());
+		return;
+	}
 	exponent exp = 0;
 	mTerms.reserve(p.degree());
 	for (const auto& c: p.coefficients()) {
@@ -984,6 +1001,7 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff,Ordering,Policies>& MultivariatePolynomial<Coeff,Ordering,Policies>::operator*=(const MultivariatePolynomial<Coeff,Ordering,Policies>& rhs)
 {
+	CARL_TRACE_SPAN("carl.poly", "multiply");
 	assert(this->is_consistent());
 	assert(rhs.is_consistent());
 	if(mTerms.empty()) return *this;
@@ -12,10 +12,12 @@
 #include <carl-arith/core/Sign.h>
 #include <carl-arith/core/Variable.h>
 
+#include <atomic>
 #include <functional>
 #include <list>
 #include <map>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "../typetraits.h"
@@ -55,6 +57,13 @@ enum class PolynomialComparisonOrder {
  * If polynomials are used as coefficients, this can be seen as a multivariate polynomial with a distinguished main variable.
  *
  * Most methods are specifically adapted for polynomial coefficients, if necessary.
+ *
+ * Polynomials of high degree with only few nonzero coefficients, like \f$ x^{1000} - 2 \f$, are stored sparse,
+ * that is only the nonzero coefficients are stored together with their exponents.
+ * The storage is selected automatically upon construction, see sparse_min_degree and sparse_density_factor.
+ * Degree, leading coefficient, evaluation, derivative, pseudo-remainder and substitution work on the sparse storage directly.
+ * Non-const access to the dense coefficients converts the polynomial to dense storage.
+ * Const access, for example via coefficients() const, never changes the storage, but uses a dense copy that is created once on demand.
  * @ingroup unirp
  */
 template<typename Coefficient>
@@ -67,10 +76,28 @@ class UnivariatePolynomial
 private:
 	/// The main variable.
 	Variable mMainVar;
-	/// The coefficients.
+	/// The coefficients, only valid if the polynomial is stored dense.
 	std::vector<Coefficient> mCoefficients;
+	/// The nonzero coefficients together with their exponents in increasing order, only valid if the polynomial is stored sparse.
+	std::vector<std::pair<uint, Coefficient>> mSparseCoefficients;
+	/// Whether the polynomial is stored sparse.
+	bool mSparse = false;
+	/**
+	 * A dense copy of the coefficients of a sparse polynomial, created on demand by dense_coefficients().
+	 * It is only ever set once while the sparse coefficients are unchanged, hence concurrent readers may share it.
+	 */
+	mutable std::atomic<std::shared_ptr<const std::vector<Coefficient>>> mDenseCopy;
 
 public:
+	/**
+	 * Polynomials of at least this degree are stored sparse if they have few nonzero coefficients.
+	 * Hence sparse polynomials are never constant.
+	 */
+	static constexpr uint sparse_min_degree = 32;
+	/**
+	 * Polynomials are stored sparse if at most every sparse_density_factor'th coefficient is nonzero.
+	 */
+	static constexpr std::size_t sparse_density_factor = 4;
 	/**
 	 * The number type that is ultimately used for the coefficients.
 	 */
@@ -153,6 +180,12 @@ public:
 	 * @param coefficients Assignment of degree to coefficients.
 	 */
 	UnivariatePolynomial(Variable mainVar, const std::map<uint, Coefficient>& coefficients);
+	/**
+	 * Construct polynomial with the given nonzero coefficients, moving the coefficients.
+	 * @param mainVar New main variable.
+	 * @param coefficients Pairs of exponent and coefficient, sorted by increasing exponent.
+	 */
+	UnivariatePolynomial(Variable mainVar, std::vector<std::pair<uint, Coefficient>>&& coefficients);
 
 	/**
 	 * Destructor.
@@ -166,7 +199,7 @@ public:
 	[[deprecated("use carl::is_zero(p) instead.")]]
 	bool is_zero() const
 	{
-		return mCoefficients.size() == 0;
+		return !mSparse && mCoefficients.size() == 0;
 	}
 	
 	/**
@@ -176,7 +209,7 @@ public:
 	[[deprecated("use carl::is_one(p) instead.")]]
 	bool is_one() const
 	{
-		return mCoefficients.size() == 1 && mCoefficients.back() == Coefficient(1);
+		return !mSparse && mCoefficients.size() == 1 && mCoefficients.back() == Coefficient(1);
 	}
 	
 	/**
@@ -185,7 +218,7 @@ public:
 	 */
 	UnivariatePolynomial one() const {
 		if constexpr (carl::is_instantiation_of<GFNumber, Coefficient>::value) {
-			if (mCoefficients.empty()) {
+			if (!mSparse && mCoefficients.empty()) {
 				return UnivariatePolynomial(mMainVar, Coefficient(1));
 			} else {
 				return UnivariatePolynomial(mMainVar, Coefficient(1, lcoeff().gf()));
@@ -202,6 +235,7 @@ public:
 	 */
 	const Coefficient& lcoeff() const
 	{
+		if (mSparse) return mSparseCoefficients.back().second;
 		assert(mCoefficients.size() > 0);
 		return mCoefficients.back();
 	}
@@ -211,6 +245,10 @@ public:
 	 * @return The trailing coefficient.
 	 */
 	const Coefficient& tcoeff() const {
+		if (mSparse) {
+			if (mSparseCoefficients.front().first == 0) return mSparseCoefficients.front().second;
+			return dense_coefficients().front();
+		}
 		assert(mCoefficients.size() > 0);
 		return mCoefficients.front();
 	}
@@ -223,13 +261,13 @@ public:
 	bool is_constant() const
 	{
 		assert(is_consistent());
-		return mCoefficients.size() <= 1;
+		return !mSparse && mCoefficients.size() <= 1;
 	}
 	
 	bool is_linear_in_main_var() const
 	{
 		assert(is_consistent());
-		return mCoefficients.size() <= 2;
+		return !mSparse && mCoefficients.size() <= 2;
 	}
 
 	/**
@@ -238,6 +276,7 @@ public:
 	 */
 	bool is_number() const
 	{
+		if (mSparse) return false;
 		if constexpr (carl::is_number_type<Coefficient>::value) {
 			return mCoefficients.size() <= 1;
 		} else {
@@ -252,7 +291,8 @@ public:
 	 */
 	NumberType constant_part() const
 	{
-		if (mCoefficients.empty()) return NumberType(0);
+		if (mSparse && mSparseCoefficients.front().first != 0) return NumberType(0);
+		if (!mSparse && mCoefficients.empty()) return NumberType(0);
 		if constexpr (carl::is_number_type<Coefficient>::value) {
 			return tcoeff();
 		} else {
@@ -282,6 +322,7 @@ public:
 	 * @return Degree.
 	 */
 	uint degree() const {
+		if (mSparse) return mSparseCoefficients.back().first;
 		assert(!mCoefficients.empty());
 		return uint(mCoefficients.size()-1);
 	}
@@ -298,10 +339,11 @@ public:
 			return degree();
 		} else {
 			if (is_zero()) return 0;
+			const auto& coeffs = dense_coefficients();
 			uint max = 0;
-			for (std::size_t deg = 0; deg < mCoefficients.size(); deg++) {
-				if (!mCoefficients[deg].is_zero()) {
-					uint tdeg = deg + mCoefficients[deg].total_degree();
+			for (std::size_t deg = 0; deg < coeffs.size(); deg++) {
+				if (!coeffs[deg].is_zero()) {
+					uint tdeg = deg + coeffs[deg].total_degree();
 					if (tdeg > max) max = tdeg;
 				}
 			}
@@ -313,6 +355,12 @@ public:
 	 * Removes the leading term from the polynomial.
 	 */
 	void truncate() {
+		if (mSparse) {
+			mSparseCoefficients.pop_back();
+			mDenseCopy.store(nullptr);
+			choose_storage();
+			return;
+		}
 		assert(!mCoefficients.empty());
 		this->mCoefficients.resize(this->mCoefficients.size()-1);
 		this->strip_leading_zeroes();
@@ -320,20 +368,41 @@ public:
 
 	/**
 	 * Retrieves the coefficients defining this polynomial.
+	 * A sparse polynomial stays sparse, the result refers to its dense copy.
 	 * @return Coefficients.
 	 */
 	const std::vector<Coefficient>& coefficients() const & {
-		return mCoefficients;
+		return dense_coefficients();
 	}
 	/// Returns the coefficients as non-const reference.
 	std::vector<Coefficient>& coefficients() & {
+		make_dense();
 		return mCoefficients;
 	}
 	/// Returns the coefficients as rvalue. The polynomial may be in an undefined state afterwards!
 	std::vector<Coefficient>&& coefficients() && {
+		make_dense();
 		return std::move(mCoefficients);
 	}
 
+	/**
+	 * Checks whether the polynomial is stored sparse.
+	 * @return If the polynomial is stored sparse.
+	 */
+	bool is_sparse() const {
+		return mSparse;
+	}
+
+	/**
+	 * Retrieves the nonzero coefficients together with their exponents in increasing order.
+	 * Asserts that the polynomial is stored sparse.
+	 * @return Pairs of exponent and coefficient.
+	 */
+	const std::vector<std::pair<uint, Coefficient>>& sparse_coefficients() const {
+		assert(mSparse);
+		return mSparseCoefficients;
+	}
+
 	/**
 	 * Retrieves the main variable of this polynomial.
 	 * @return Main variable.
@@ -350,7 +419,7 @@ public:
 	bool has(Variable v) const {
 		if (v == main_var()) return true;
 		if constexpr (!carl::is_number_type<Coefficient>::value) {
-			for (const auto& c: mCoefficients) {
+			for (const auto& c: coefficients()) {
 				if (c.has(v)) return true;
 			}
 		}
@@ -418,6 +487,7 @@ public:
 	 */
 	UnivariatePolynomial negate_variable() const {
 		UnivariatePolynomial<Coefficient> res(*this);
+		res.make_dense();
 		for (std::size_t deg = 0; deg < res.coefficients().size(); deg++) {
 			if (deg % 2 == 1) res.mCoefficients[deg] = -res.mCoefficients[deg];
 		}
@@ -429,6 +499,7 @@ public:
 	 */
 	UnivariatePolynomial reverse_coefficients() const {
 		UnivariatePolynomial<Coefficient> res(*this);
+		res.make_dense();
 		std::reverse(res.mCoefficients.begin(), res.mCoefficients.end());
 		while(carl::is_zero(*std::prev(res.mCoefficients.end())) && std::prev(res.mCoefficients.end()) != res.mCoefficients.begin()) {
 			res.mCoefficients.erase(std::prev(res.mCoefficients.end()));
@@ -494,6 +565,7 @@ public:
 	UnivariatePolynomial& normalizeCoefficients()
 	{
 		static_assert(std::is_same<T,Coefficient>::value, "No template parameters should be given");
+		make_dense();
 		for(Coefficient& c : mCoefficients)
 		{
 			c.normalize();
@@ -540,9 +612,9 @@ public:
 	NumberType numeric_content(std::size_t i) const
 	{
 		if constexpr (carl::is_number_type<Coefficient>::value) {
-			return this->mCoefficients[i];
+			return coefficients()[i];
 		} else {
-			return this->mCoefficients[i].numeric_content();
+			return coefficients()[i].numeric_content();
 		}
 	}
 
@@ -594,6 +666,7 @@ public:
 	 * @return True if zero is a root.
 	 */
 	bool zero_is_root() const {
+		if (mSparse) return mSparseCoefficients.front().first != 0;
 		assert(!mCoefficients.empty());
 		return carl::is_zero(mCoefficients[0]);
 	}
@@ -793,11 +866,30 @@ public:
 	
 	void strip_leading_zeroes() 
 	{
+		// Sparse polynomials have no zero coefficients.
+		if (mSparse) return;
 		while(mCoefficients.size() > 0 && carl::is_zero(lcoeff()))
 		{
 			mCoefficients.pop_back();
 		}
 	}
+
+	/**
+	 * Converts the polynomial to dense storage, if it is stored sparse.
+	 * This is done implicitly by all non-const accesses to the dense coefficients.
+	 */
+	void make_dense();
+
+private:
+	/**
+	 * Returns the dense coefficients without changing the storage.
+	 * For a sparse polynomial, the dense copy is created on the first call and kept until the polynomial is modified.
+	 */
+	const std::vector<Coefficient>& dense_coefficients() const;
+	/**
+	 * Selects sparse or dense storage depending on the degree and the number of nonzero coefficients.
+	 */
+	void choose_storage();
 };
 
 /**
@@ -806,7 +898,7 @@ public:
  */
 template<typename Coefficient>
 bool is_zero(const UnivariatePolynomial<Coefficient>& p) {
-	return p.coefficients().size() == 0;
+	return !p.is_sparse() && p.coefficients().size() == 0;
 }
 
 /**
@@ -815,7 +907,7 @@ bool is_zero(const UnivariatePolynomial<Coefficient>& p) {
  */
 template<typename Coefficient>
 bool is_one(const UnivariatePolynomial<Coefficient>& p) {
-	return p.coefficients().size() == 1 && carl::is_one(p.coefficients().front());
+	return !p.is_sparse() && p.coefficients().size() == 1 && carl::is_one(p.coefficients().front());
 }
 
 /// Add the variables of the given polynomial to the variables.
@@ -25,16 +25,18 @@ namespace carl
 
 template<typename Coeff>
 UnivariatePolynomial<Coeff>::UnivariatePolynomial(const UnivariatePolynomial& p):
-	mMainVar(p.mMainVar), mCoefficients(p.mCoefficients)
+	mMainVar(p.mMainVar), mCoefficients(p.mCoefficients), mSparseCoefficients(p.mSparseCoefficients), mSparse(p.mSparse), mDenseCopy(p.mDenseCopy.load())
 {
 	assert(this->is_consistent());
 }
 
 template<typename Coeff>
 UnivariatePolynomial<Coeff>::UnivariatePolynomial(UnivariatePolynomial&& p) noexcept:
-	mMainVar(p.mMainVar), mCoefficients()
+	mMainVar(p.mMainVar), mCoefficients(), mSparseCoefficients(), mSparse(p.mSparse), mDenseCopy(p.mDenseCopy.exchange(nullptr))
 {
 	mCoefficients = std::move(p.mCoefficients);
+	mSparseCoefficients = std::move(p.mSparseCoefficients);
+	p.mSparse = false;
 	assert(is_consistent());
 }
 
@@ -42,6 +44,9 @@ template<typename Coeff>
 UnivariatePolynomial<Coeff>& UnivariatePolynomial<Coeff>::operator=(const UnivariatePolynomial& p) {
 	mMainVar = p.mMainVar;
 	mCoefficients = p.mCoefficients;
+	mSparseCoefficients = p.mSparseCoefficients;
+	mSparse = p.mSparse;
+	mDenseCopy.store(p.mDenseCopy.load());
 	assert(is_consistent());
 	return *this;
 }
@@ -50,6 +55,10 @@ template<typename Coeff>
 UnivariatePolynomial<Coeff>& UnivariatePolynomial<Coeff>::operator=(UnivariatePolynomial&& p) noexcept {
 	mMainVar = p.mMainVar;
 	mCoefficients = std::move(p.mCoefficients);
+	mSparseCoefficients = std::move(p.mSparseCoefficients);
+	mSparse = p.mSparse;
+	mDenseCopy.store(p.mDenseCopy.exchange(nullptr));
+	p.mSparse = false;
 	assert(is_consistent());
 	return *this;
 }
@@ -62,9 +71,17 @@ UnivariatePolynomial<Coeff>::UnivariatePolynomial(Variable mainVar)
 }
 template<typename Coeff>
 UnivariatePolynomial<Coeff>::UnivariatePolynomial(Variable mainVar, const Coeff& coeff, std::size_t degree) :
-mMainVar(mainVar),
-mCoefficients(degree+1, Coeff(0)) // We would like to use 0 here, but Coeff(0) is not always constructable (some methods need more parameter)
+mMainVar(mainVar)
 {
+	if(coeff != Coeff(0) && degree >= sparse_min_degree)
+	{
+		mSparseCoefficients.emplace_back(uint(degree), coeff);
+		mSparse = true;
+		assert(is_consistent());
+		return;
+	}
+	// We would like to use 0 here, but Coeff(0) is not always constructable (some methods need more parameter)
+	mCoefficients.assign(degree+1, Coeff(0));
 	if(coeff != Coeff(0))
 	{
 		mCoefficients[degree] = coeff;
@@ -102,14 +119,16 @@ UnivariatePolynomial<Coeff>::UnivariatePolynomial(Variable mainVar, const std::v
 : mMainVar(mainVar), mCoefficients(coefficients)
 {
 	this->strip_leading_zeroes();
+	choose_storage();
 	assert(this->is_consistent());
 }
 
 template<typename Coeff>
 UnivariatePolynomial<Coeff>::UnivariatePolynomial(Variable mainVar, std::vector<Coeff>&& coefficients)
-: mMainVar(mainVar), mCoefficients(coefficients)
+: mMainVar(mainVar), mCoefficients(std::move(coefficients))
 {
 	this->strip_leading_zeroes();
+	choose_storage();
 	assert(this->is_consistent());
 }
 
@@ -117,7 +136,20 @@ template<typename Coeff>
 UnivariatePolynomial<Coeff>::UnivariatePolynomial(Variable mainVar, const std::map<uint, Coeff>& coefficients)
 : mMainVar(mainVar)
 {
-	mCoefficients.reserve(coefficients.rbegin()->first);
+	for (auto it = coefficients.rbegin(); it != coefficients.rend(); ++it) {
+		if (carl::is_zero(it->second)) continue;
+		if (it->first >= sparse_min_degree && coefficients.size() * sparse_density_factor <= it->first + 1) {
+			for (const auto& expAndCoeff : coefficients) {
+				if (!carl::is_zero(expAndCoeff.second)) mSparseCoefficients.emplace_back(expAndCoeff);
+			}
+			mSparse = true;
+			assert(this->is_consistent());
+			return;
+		}
+		break;
+	}
+	if (coefficients.empty()) return;
+	mCoefficients.reserve(coefficients.rbegin()->first + 1);
 	for (const auto& expAndCoeff : coefficients)
 	{
 		if(expAndCoeff.first != mCoefficients.size())
@@ -127,12 +159,95 @@ UnivariatePolynomial<Coeff>::UnivariatePolynomial(Variable mainVar, const std::m
 		mCoefficients.push_back(expAndCoeff.second);
 	}
 	this->strip_leading_zeroes();
+	choose_storage();
 	assert(this->is_consistent());
 }
 
+template<typename Coeff>
+UnivariatePolynomial<Coeff>::UnivariatePolynomial(Variable mainVar, std::vector<std::pair<uint, Coeff>>&& coefficients)
+: mMainVar(mainVar), mSparseCoefficients(std::move(coefficients)), mSparse(true)
+{
+	assert(std::is_sorted(mSparseCoefficients.begin(), mSparseCoefficients.end(), [](const auto& lhs, const auto& rhs){ return lhs.first < rhs.first; }));
+	mSparseCoefficients.erase(
+		std::remove_if(mSparseCoefficients.begin(), mSparseCoefficients.end(), [](const auto& c){ return carl::is_zero(c.second); }),
+		mSparseCoefficients.end()
+	);
+	choose_storage();
+	assert(this->is_consistent());
+}
+
+template<typename Coeff>
+void UnivariatePolynomial<Coeff>::make_dense()
+{
+	if (!mSparse) return;
+	mDenseCopy.store(nullptr);
+	mSparse = false;
+	mCoefficients.clear();
+	if (mSparseCoefficients.empty()) return;
+	CARL_LOG_TRACE("carl.core.upoly", "Converting sparse polynomial of degree " << mSparseCoefficients.back().first << " to dense storage");
+	mCoefficients.assign(mSparseCoefficients.back().first + 1, Coeff(0));
+	for (auto& c: mSparseCoefficients) {
+		mCoefficients[c.first] = std::move(c.second);
+	}
+	mSparseCoefficients.clear();
+}
+
+template<typename Coeff>
+const std::vector<Coeff>& UnivariatePolynomial<Coeff>::dense_coefficients() const
+{
+	if (!mSparse) return mCoefficients;
+	auto copy = mDenseCopy.load();
+	if (!copy) {
+		CARL_LOG_TRACE("carl.core.upoly", "Creating dense copy of sparse polynomial of degree " << mSparseCoefficients.back().first);
+		auto dense = std::make_shared<std::vector<Coeff>>(mSparseCoefficients.back().first + 1, Coeff(0));
+		for (const auto& c: mSparseCoefficients) {
+			(*dense)[c.first] = c.second;
+		}
+		// If another thread was faster, its copy is used.
+		std::shared_ptr<const std::vector<Coeff>> expected;
+		copy = std::move(dense);
+		if (!mDenseCopy.compare_exchange_strong(expected, copy)) copy = std::move(expected);
+	}
+	return *copy;
+}
+
+template<typename Coeff>
+void UnivariatePolynomial<Coeff>::choose_storage()
+{
+	if (mSparse) {
+		if (mSparseCoefficients.empty() || mSparseCoefficients.back().first < sparse_min_degree) {
+			make_dense();
+		}
+		return;
+	}
+	if (mCoefficients.size() <= sparse_min_degree) return;
+	std::size_t nonzero = std::size_t(std::count_if(mCoefficients.begin(), mCoefficients.end(), [](const Coeff& c){ return !carl::is_zero(c); }));
+	if (nonzero * sparse_density_factor > mCoefficients.size()) return;
+	mSparseCoefficients.reserve(nonzero);
+	for (uint exp = 0; exp < mCoefficients.size(); ++exp) {
+		if (!carl::is_zero(mCoefficients[exp])) mSparseCoefficients.emplace_back(exp, std::move(mCoefficients[exp]));
+	}
+	mCoefficients.clear();
+	mCoefficients.shrink_to_fit();
+	mSparse = true;
+}
+
 template<typename Coeff>
 Coeff UnivariatePolynomial<Coeff>::evaluate(const Coeff& value) const 
 {
+	if (mSparse) {
+		// Horner's scheme, skipping the zero coefficients by powering.
+		auto it = mSparseCoefficients.rbegin();
+		Coeff result = it->second;
+		uint exp = it->first;
+		for (++it; it != mSparseCoefficients.rend(); ++it) {
+			result *= carl::pow(value, exp - it->first);
+			result += it->second;
+			exp = it->first;
+		}
+		if (exp > 0) result *= carl::pow(value, exp);
+		return result;
+	}
 	Coeff result(0);
 	Coeff var(1);
 	for(const Coeff& coeff : mCoefficients)
@@ -152,6 +267,7 @@ bool UnivariatePolynomial<Coeff>::is_normal() const
 template<typename Coefficient>
 UnivariatePolynomial<Coefficient>& UnivariatePolynomial<Coefficient>::mod(const Coefficient& modulus)
 {
+	make_dense();
 	for(Coefficient& coeff : mCoefficients)
 	{
 		coeff = carl::mod(coeff, modulus);
@@ -162,9 +278,10 @@ UnivariatePolynomial<Coefficient>& UnivariatePolynomial<Coefficient>::mod(const
 template<typename Coefficient>
 UnivariatePolynomial<Coefficient> UnivariatePolynomial<Coefficient>::mod(const Coefficient& modulus) const
 {
+	const auto& dense = dense_coefficients();
 	UnivariatePolynomial<Coefficient> result;
-	result.mCoefficients.reserve(mCoefficients.size());
-	for(const Coefficient& coeff : mCoefficients)
+	result.mCoefficients.reserve(dense.size());
+	for(const Coefficient& coeff : dense)
 	{
 		result.mCoefficients.push_back(mod(coeff, modulus));
 	}
@@ -190,9 +307,10 @@ UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::pow(std::size_t exp) co
 template<typename Coeff>
 template<typename C, DisableIf<is_number_type<C>>>
 UnivariatePolynomial<typename UnivariatePolynomial<Coeff>::NumberType> UnivariatePolynomial<Coeff>::toNumberCoefficients() const {
+	const auto& dense = dense_coefficients();
 	std::vector<NumberType> coeffs;
-	coeffs.reserve(this->mCoefficients.size());
-	for (auto c: this->mCoefficients) {
+	coeffs.reserve(dense.size());
+	for (auto c: dense) {
 		assert(c.is_constant());
 		coeffs.push_back(c.constant_part());
 	}
@@ -202,10 +320,11 @@ UnivariatePolynomial<typename UnivariatePolynomial<Coeff>::NumberType> Univariat
 template<typename Coeff>
 template<typename NewCoeff>
 UnivariatePolynomial<NewCoeff> UnivariatePolynomial<Coeff>::convert() const {
+	const auto& dense = dense_coefficients();
 	std::vector<NewCoeff> coeffs;
-	coeffs.resize(this->mCoefficients.size());
-	for (std::size_t i = 0; i < this->mCoefficients.size(); i++) {
-		coeffs[i] = NewCoeff(this->mCoefficients[i]);
+	coeffs.resize(dense.size());
+	for (std::size_t i = 0; i < dense.size(); i++) {
+		coeffs[i] = NewCoeff(dense[i]);
 	}
 	return UnivariatePolynomial<NewCoeff>(this->mMainVar, coeffs);
 }
@@ -213,10 +332,11 @@ UnivariatePolynomial<NewCoeff> UnivariatePolynomial<Coeff>::convert() const {
 template<typename Coeff>
 template<typename NewCoeff>
 UnivariatePolynomial<NewCoeff> UnivariatePolynomial<Coeff>::convert(const std::function<NewCoeff(const Coeff&)>& f) const {
+	const auto& dense = dense_coefficients();
 	std::vector<NewCoeff> coeffs;
-	coeffs.resize(this->mCoefficients.size());
-	for (std::size_t i = 0; i < this->mCoefficients.size(); i++) {
-		coeffs[i] = f(this->mCoefficients[i]);
+	coeffs.resize(dense.size());
+	for (std::size_t i = 0; i < dense.size(); i++) {
+		coeffs[i] = f(dense[i]);
 	}
 	return UnivariatePolynomial<NewCoeff>(this->mMainVar, coeffs);
 }
@@ -258,10 +378,11 @@ template<typename C, EnableIf<is_subset_of_rationals_type<C>>>
 Coeff UnivariatePolynomial<Coeff>::coprime_factor() const
 {
 	assert(!carl::is_zero(*this));
-	auto it = mCoefficients.begin();
+	const auto& dense = dense_coefficients();
+	auto it = dense.begin();
 	IntNumberType num = get_num(*it);
 	IntNumberType den = get_denom(*it);
-	for (++it; it != mCoefficients.end(); ++it) {
+	for (++it; it != dense.end(); ++it) {
 		num = carl::gcd(num, get_num(*it));
 		den = carl::lcm(den, get_denom(*it));
 	}
@@ -273,9 +394,10 @@ template<typename C, DisableIf<is_subset_of_rationals_type<C>>>
 typename UnderlyingNumberType<Coeff>::type UnivariatePolynomial<Coeff>::coprime_factor() const
 {
 	assert(!carl::is_zero(*this));
-	auto it = mCoefficients.begin();
+	const auto& dense = dense_coefficients();
+	auto it = dense.begin();
 	typename UnderlyingNumberType<Coeff>::type factor = it->coprime_factor();
-	for (++it; it != mCoefficients.end(); ++it) {
+	for (++it; it != dense.end(); ++it) {
 		factor = carl::lcm(factor, it->coprime_factor());
 	}
 	return factor;
@@ -291,9 +413,10 @@ UnivariatePolynomial<typename IntegralType<Coeff>::type> UnivariatePolynomial<Co
 	if (carl::is_zero(*this)) {
 		return result;
 	}
-	result.mCoefficients.reserve(mCoefficients.size());
+	const auto& dense = dense_coefficients();
+	result.mCoefficients.reserve(dense.size());
 	Coeff factor = this->coprime_factor();
-	for (const Coeff& coeff: mCoefficients) {
+	for (const Coeff& coeff: dense) {
 		assert(get_denom(coeff * factor) == 1);
 		result.mCoefficients.push_back(get_num(coeff * factor));
 	}
@@ -305,9 +428,10 @@ template<typename C, DisableIf<is_subset_of_rationals_type<C>>>
 UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::coprime_coefficients() const {
 	if (carl::is_zero(*this)) return *this;
 	UnivariatePolynomial<Coeff> result(mMainVar);
-	result.mCoefficients.reserve(mCoefficients.size());
+	const auto& dense = dense_coefficients();
+	result.mCoefficients.reserve(dense.size());
 	auto factor = this->coprime_factor();
-	for (const Coeff& c: mCoefficients) {
+	for (const Coeff& c: dense) {
 		result.mCoefficients.push_back(factor * c);
 	}
 	return result;
@@ -323,9 +447,10 @@ UnivariatePolynomial<typename IntegralType<Coeff>::type> UnivariatePolynomial<Co
 	if (carl::is_zero(*this)) {
 		return result;
 	}
-	result.mCoefficients.reserve(mCoefficients.size());
+	const auto& dense = dense_coefficients();
+	result.mCoefficients.reserve(dense.size());
 	Coeff factor = carl::abs(this->coprime_factor());
-	for (const Coeff& coeff: mCoefficients) {
+	for (const Coeff& coeff: dense) {
 		assert(get_denom(coeff * factor) == 1);
 		result.mCoefficients.push_back(get_num(coeff * factor));
 	}
@@ -337,9 +462,10 @@ template<typename C, DisableIf<is_subset_of_rationals_type<C>>>
 UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::coprime_coefficients_sign_preserving() const {
 	if (this->is_zero()) return *this;
 	UnivariatePolynomial<Coeff> result(mMainVar);
-	result.mCoefficients.reserve(mCoefficients.size());
+	const auto& dense = dense_coefficients();
+	result.mCoefficients.reserve(dense.size());
 	auto factor = carl::abs(this->coprime_factor());
-	for (const Coeff& c: mCoefficients) {
+	for (const Coeff& c: dense) {
 		result.mCoefficients.push_back(factor * c);
 	}
 	return result;
@@ -356,9 +482,10 @@ template<typename Coeff>
 template<typename C, EnableIf<is_instantiation_of<GFNumber, C>>>
 UnivariatePolynomial<typename IntegralType<Coeff>::type> UnivariatePolynomial<Coeff>::to_integer_domain() const
 {
+	const auto& dense = dense_coefficients();
 	UnivariatePolynomial<typename IntegralType<Coeff>::type> res(mMainVar);
-	res.mCoefficients.reserve(mCoefficients.size());
-	for(const Coeff& c : mCoefficients)
+	res.mCoefficients.reserve(dense.size());
+	for(const Coeff& c : dense)
 	{
 		assert(carl::is_integer(c));
 		res.mCoefficients.push_back(c.representing_integer());
@@ -371,9 +498,10 @@ template<typename Coeff>
 template<typename C, DisableIf<is_instantiation_of<GFNumber, C>>>
 UnivariatePolynomial<typename IntegralType<Coeff>::type> UnivariatePolynomial<Coeff>::to_integer_domain() const
 {
+	const auto& dense = dense_coefficients();
 	UnivariatePolynomial<typename IntegralType<Coeff>::type> res(mMainVar);
-	res.mCoefficients.reserve(mCoefficients.size());
-	for(const Coeff& c : mCoefficients)
+	res.mCoefficients.reserve(dense.size());
+	for(const Coeff& c : dense)
 	{
 		assert(carl::is_integer(c));
 		res.mCoefficients.push_back(get_num(c));
@@ -386,9 +514,10 @@ template<typename Coeff>
 //template<typename T = Coeff, EnableIf<!std::is_same<IntegralType<Coeff>, bool>::value>>
 UnivariatePolynomial<GFNumber<typename IntegralType<Coeff>::type>> UnivariatePolynomial<Coeff>::toFiniteDomain(const GaloisField<typename IntegralType<Coeff>::type>* galoisField) const
 {
+	const auto& dense = dense_coefficients();
 	UnivariatePolynomial<GFNumber<typename IntegralType<Coeff>::type>> res(mMainVar);
-	res.mCoefficients.reserve(mCoefficients.size());
-	for(const Coeff& c : mCoefficients)
+	res.mCoefficients.reserve(dense.size());
+	for(const Coeff& c : dense)
 	{
 		assert(carl::is_integer(c));
 		res.mCoefficients.push_back(GFNumber<typename IntegralType<Coeff>::type>(c,galoisField));
@@ -403,6 +532,7 @@ template<typename N, EnableIf<is_subset_of_rationals_type<N>>>
 typename UnivariatePolynomial<Coeff>::NumberType UnivariatePolynomial<Coeff>::numeric_content() const
 {
 	if (carl::is_zero(*this)) return NumberType(0);
+	const auto& dense = dense_coefficients();
 	// Obtain main denominator for all coefficients.
 	IntNumberType mainDenom = this->main_denom();
 	
@@ -411,7 +541,7 @@ typename UnivariatePolynomial<Coeff>::NumberType UnivariatePolynomial<Coeff>::nu
 	UnivariatePolynomial<Coeff>::NumberType c = this->numeric_content(0) * mainDenom;
 	assert(get_denom(c) == 1);
 	IntNumberType res = get_num(c);
-	for (std::size_t i = 1; i < this->mCoefficients.size(); i++) {
+	for (std::size_t i = 1; i < dense.size(); i++) {
 		c = this->numeric_content(i) * mainDenom;
 		assert(get_denom(c) == 1);
 		res = carl::gcd(get_num(c), res);
@@ -423,8 +553,9 @@ template<typename Coeff>
 template<typename C, EnableIf<is_number_type<C>>>
 typename UnivariatePolynomial<Coeff>::IntNumberType UnivariatePolynomial<Coeff>::main_denom() const
 {
+	const auto& dense = dense_coefficients();
 	IntNumberType denom = 1;
-	for (const auto& c: mCoefficients) {
+	for (const auto& c: dense) {
 		denom = carl::lcm(denom, get_denom(c));
 	}
 	CARL_LOG_TRACE("carl.core", "mainDenom of " << *this << " is " << denom);
@@ -434,8 +565,9 @@ template<typename Coeff>
 template<typename C, DisableIf<is_number_type<C>>>
 typename UnivariatePolynomial<Coeff>::IntNumberType UnivariatePolynomial<Coeff>::main_denom() const
 {
+	const auto& dense = dense_coefficients();
 	IntNumberType denom = 1;
-	for (const auto& c: mCoefficients) {
+	for (const auto& c: dense) {
 		denom = carl::lcm(denom, c.main_denom());
 	}
 	return denom;
@@ -476,6 +608,14 @@ Coeff UnivariatePolynomial<Coeff>::synthetic_division(const Coeff& zeroOfDivisor
 template<typename Coeff>
 UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::operator -() const
 {
+	if (mSparse) {
+		std::vector<std::pair<uint, Coeff>> coeffs;
+		coeffs.reserve(mSparseCoefficients.size());
+		for (const auto& c: mSparseCoefficients) {
+			coeffs.emplace_back(c.first, -c.second);
+		}
+		return UnivariatePolynomial(mMainVar, std::move(coeffs));
+	}
 	UnivariatePolynomial result(mMainVar);
 	result.mCoefficients.reserve(mCoefficients.size());
 	for(const auto& c : mCoefficients) {
@@ -488,6 +628,7 @@ UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::operator -() const
 template<typename Coefficient>
 UnivariatePolynomial<Coefficient>& UnivariatePolynomial<Coefficient>::operator+=(const Coefficient& rhs)
 {
+	make_dense();
 	if(rhs == Coefficient(0)) return *this;
 	if(mCoefficients.empty())
 	{
@@ -515,20 +656,22 @@ UnivariatePolynomial<Coeff>& UnivariatePolynomial<Coeff>::operator+=(const Univa
 	{
 		return *this;
 	}
+	make_dense();
+	const auto& rhsCoeffs = rhs.dense_coefficients();
 	
-	if(mCoefficients.size() < rhs.mCoefficients.size())
+	if(mCoefficients.size() < rhsCoeffs.size())
 	{
 		for(std::size_t i = 0; i < mCoefficients.size(); ++i)
 		{
-			mCoefficients[i] += rhs.mCoefficients[i];
+			mCoefficients[i] += rhsCoeffs[i];
 		}
-		mCoefficients.insert(mCoefficients.end(), rhs.mCoefficients.end() - sint(rhs.mCoefficients.size() - mCoefficients.size()), rhs.mCoefficients.end());
+		mCoefficients.insert(mCoefficients.end(), rhsCoeffs.end() - sint(rhsCoeffs.size() - mCoefficients.size()), rhsCoeffs.end());
 	}
 	else
 	{
-		for(std::size_t i = 0; i < rhs.mCoefficients.size(); ++i)
+		for(std::size_t i = 0; i < rhsCoeffs.size(); ++i)
 		{
-			mCoefficients[i] += rhs.mCoefficients[i]; 
+			mCoefficients[i] += rhsCoeffs[i]; 
 		}
 	}
 	strip_leading_zeroes();
@@ -598,6 +741,7 @@ UnivariatePolynomial<C> operator-(const C& lhs, const UnivariatePolynomial<C>& r
 template<typename Coefficient>
 template<typename C, EnableIf<is_number_type<C>>>
 UnivariatePolynomial<Coefficient>& UnivariatePolynomial<Coefficient>::operator*=(Variable rhs) {
+	make_dense();
 	if (rhs == this->mMainVar) {
 		this->mCoefficients.insert(this->mCoefficients.begin(), Coefficient(0));
 		return *this;
@@ -608,6 +752,7 @@ UnivariatePolynomial<Coefficient>& UnivariatePolynomial<Coefficient>::operator*=
 template<typename Coefficient>
 template<typename C, DisableIf<is_number_type<C>>>
 UnivariatePolynomial<Coefficient>& UnivariatePolynomial<Coefficient>::operator*=(Variable rhs) {
+	make_dense();
 	if (rhs == this->mMainVar) {
 		this->mCoefficients.insert(this->mCoefficients.begin(), Coefficient(0));
 		return *this;
@@ -620,6 +765,7 @@ UnivariatePolynomial<Coefficient>& UnivariatePolynomial<Coefficient>::operator*=
 template<typename Coefficient>
 UnivariatePolynomial<Coefficient>& UnivariatePolynomial<Coefficient>::operator*=(const Coefficient& rhs)
 {
+	make_dense();
 	if(rhs == Coefficient(0))
 	{
 		mCoefficients.clear();
@@ -643,6 +789,7 @@ template<typename Coeff>
 template<typename I, DisableIf<std::is_same<Coeff, I>>...>
 UnivariatePolynomial<Coeff>& UnivariatePolynomial<Coeff>::operator*=(const typename IntegralType<Coeff>::type& rhs)
 {
+	make_dense();
 	static_assert(std::is_same<Coeff, I>::value, "Do not provide template parameters");
 	if(rhs == I(0))
 	{
@@ -660,22 +807,24 @@ template<typename Coeff>
 UnivariatePolynomial<Coeff>& UnivariatePolynomial<Coeff>::operator*=(const UnivariatePolynomial& rhs)
 {
 	assert(mMainVar == rhs.mMainVar);
+	make_dense();
 	if(carl::is_zero(rhs))
 	{
 		mCoefficients.clear();
 		return *this;
 	}
+	const auto& rhsCoeffs = rhs.dense_coefficients();
 	
 	std::vector<Coeff> newCoeffs; 
-	newCoeffs.reserve(mCoefficients.size() + rhs.mCoefficients.size());
+	newCoeffs.reserve(mCoefficients.size() + rhsCoeffs.size());
 	for(std::size_t e = 0; e < mCoefficients.size() + rhs.degree(); ++e)
 	{
 		newCoeffs.push_back(Coeff(0));
 		for(std::size_t i = 0; i < mCoefficients.size() && i <= e; ++i)
 		{
-			if(e - i < rhs.mCoefficients.size())
+			if(e - i < rhsCoeffs.size())
 			{
-				newCoeffs.back() += mCoefficients[i] * rhs.mCoefficients[e-i];
+				newCoeffs.back() += mCoefficients[i] * rhsCoeffs[e-i];
 			}
 		}
 	}
@@ -736,6 +885,7 @@ template<typename Coeff>
 template<typename C, EnableIf<is_field_type<C>>>
 UnivariatePolynomial<Coeff>& UnivariatePolynomial<Coeff>::operator/=(const Coeff& rhs)
 {
+	make_dense();
 	assert(rhs != Coeff(0));
 	for(Coeff& c : mCoefficients)
 	{
@@ -748,6 +898,7 @@ template<typename Coeff>
 template<typename C, DisableIf<is_field_type<C>>>
 UnivariatePolynomial<Coeff>& UnivariatePolynomial<Coeff>::operator/=(const Coeff& rhs)
 {
+	make_dense();
 	assert(rhs != Coeff(0));
 	for(Coeff& c : mCoefficients)
 	{
@@ -776,12 +927,16 @@ bool operator==(const UnivariatePolynomial<C>& lhs, const UnivariatePolynomial<C
 	assert(rhs.is_consistent());
 	if(lhs.mMainVar == rhs.mMainVar)
 	{
-		return lhs.mCoefficients == rhs.mCoefficients;
+		if (lhs.mSparse && rhs.mSparse) {
+			return lhs.mSparseCoefficients == rhs.mSparseCoefficients;
+		}
+		return lhs.dense_coefficients() == rhs.dense_coefficients();
 	}
 	else
 	{
 		// in different variables, polynomials can still be equal if constant.
 		if(carl::is_zero(lhs) && carl::is_zero(rhs)) return true;
+		if (lhs.mSparse || rhs.mSparse) return false;
 		if ((lhs.mCoefficients.size() == 1) && (rhs.mCoefficients.size() == 1) && (lhs.mCoefficients == rhs.mCoefficients)) return true;
 		// Convert to multivariate and compare that.
 		return MultivariatePolynomial<typename carl::UnderlyingNumberType<C>::type>(lhs) == MultivariatePolynomial<typename carl::UnderlyingNumberType<C>::type>(rhs);
@@ -798,6 +953,8 @@ bool operator==(const UnivariatePolynomialPtr<C>& lhs, const UnivariatePolynomia
 template<typename C>
 bool operator==(const UnivariatePolynomial<C>& lhs, const C& rhs)
 {	
+	// Sparse polynomials are never constant.
+	if (lhs.is_sparse()) return false;
 	if (lhs.coefficients().size() == 0) {
 		return carl::is_zero(rhs);
 	}
@@ -875,6 +1032,16 @@ template<typename C>
 std::ostream& operator<<(std::ostream& os, const UnivariatePolynomial<C>& rhs)
 {
 	if(carl::is_zero(rhs)) return os << "0";
+	if(rhs.mSparse)
+	{
+		for(auto it = rhs.mSparseCoefficients.rbegin(); it != rhs.mSparseCoefficients.rend() && it->first > 0; ++it)
+		{
+			if (!(it->second == 1)) os << "(" << it->second << ")*";
+			os << rhs.mMainVar << "^" << it->first << " + ";
+		}
+		if (rhs.mSparseCoefficients.front().first == 0) return os << rhs.mSparseCoefficients.front().second;
+		return os << "0";
+	}
 	for(size_t i = 0; i < rhs.mCoefficients.size()-1; ++i )
 	{
 		const C& c = rhs.mCoefficients[rhs.mCoefficients.size()-i-1];
@@ -891,6 +1058,14 @@ std::ostream& operator<<(std::ostream& os, const UnivariatePolynomial<C>& rhs)
 template<typename Coefficient>
 template<typename C, EnableIf<is_number_type<C>>>
 bool UnivariatePolynomial<Coefficient>::is_consistent() const {
+	if (mSparse) {
+		assert(!mSparseCoefficients.empty());
+		assert(mSparseCoefficients.back().first >= sparse_min_degree);
+		for (const auto& c: mSparseCoefficients) {
+			assert(!carl::is_zero(c.second));
+		}
+		return true;
+	}
 	if (!mCoefficients.empty()) {
 		assert(!carl::is_zero(lcoeff()));
 	}
@@ -900,6 +1075,16 @@ bool UnivariatePolynomial<Coefficient>::is_consistent() const {
 template<typename Coefficient>
 template<typename C, DisableIf<is_number_type<C>>>
 bool UnivariatePolynomial<Coefficient>::is_consistent() const {
+	if (mSparse) {
+		assert(!mSparseCoefficients.empty());
+		assert(mSparseCoefficients.back().first >= sparse_min_degree);
+		for (const auto& c: mSparseCoefficients) {
+			assert(!carl::is_zero(c.second));
+			assert(!c.second.has(main_var()));
+			assert(c.second.is_consistent());
+		}
+		return true;
+	}
 	if (!mCoefficients.empty()) {
 		assert(!carl::is_zero(lcoeff()));
 	}
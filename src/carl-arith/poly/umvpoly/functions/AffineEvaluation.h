@@ -0,0 +1,223 @@
+/**
+ * @file AffineEvaluation.h
+ *
+ * Range bounding of polynomials with affine arithmetic.
+ */
+
+#pragma once
+
+#include "IntervalEvaluation.h"
+
+#include <carl-arith/interval/SetTheory.h>
+
+#include <vector>
+
+namespace carl {
+
+/**
+ * An affine form x0 + x1*e1 + ... + xn*en + [-err, err] with noise symbols ei ranging over [-1, 1].
+ *
+ * Every variable corresponds to a noise symbol, such that correlations between subexpressions are kept and the dependency problem of interval arithmetic is mitigated.
+ * All nonlinear terms and rounding errors are collected in a single error term.
+ *
+ * Rounding is rigorous for every Number that Interval<Number> rounds outwards, e.g. double and mpfr floats:
+ * every operation on coefficients is performed on point intervals, the lower bound is kept as coefficient and the width is added to the error term.
+ */
+template<typename Number>
+class AffineForm {
+private:
+	using I = Interval<Number>;
+	Number mCenter;
+	std::vector<Number> mTerms;
+	Number mError;
+	/// Set if some intermediate result overflowed.
+	bool mUnbounded = false;
+
+	static Number zero() {
+		return carl::constant_zero<Number>::get();
+	}
+	static Number abs(const Number& n) {
+		return n < zero() ? Number(-n) : n;
+	}
+	static Number add_up(const Number& a, const Number& b) {
+		return (I(a) + I(b)).upper();
+	}
+	static Number mul_up(const Number& a, const Number& b) {
+		return (I(a) * I(b)).upper();
+	}
+	/// Returns a representative of the given interval and adds the distance of all its points to the representative to the error.
+	Number split(const I& i) {
+		if (i.is_unbounded()) {
+			mUnbounded = true;
+			return zero();
+		}
+		mError = add_up(mError, (I(i.upper()) - I(i.lower())).upper());
+		return i.lower();
+	}
+	/// Returns an upper bound for the sum of the magnitudes of all noise terms and the error.
+	Number radius() const {
+		Number res = mError;
+		for (const auto& t: mTerms) {
+			res = add_up(res, abs(t));
+		}
+		return res;
+	}
+
+	AffineForm(std::size_t symbols): mCenter(zero()), mTerms(symbols, zero()), mError(zero()) {}
+
+public:
+	/// Creates an affine form for a constant, which may be an interval.
+	AffineForm(const I& constant, std::size_t symbols): AffineForm(symbols) {
+		mCenter = split(constant);
+	}
+	/**
+	 * Creates an affine form for a variable ranging over the given bounded interval, represented by the given noise symbol.
+	 */
+	AffineForm(const I& range, std::size_t symbol, std::size_t symbols): AffineForm(symbols) {
+		assert(symbol < symbols);
+		if (range.is_unbounded()) {
+			mUnbounded = true;
+			return;
+		}
+		// [l, u] = m + r*e with m = (l+u)/2 and r >= max(u - m, m - l)
+		I mid = (I(range.lower()) + I(range.upper())) * I(Number(0.5));
+		mCenter = mid.lower();
+		Number r1 = (I(range.upper()) - I(mCenter)).upper();
+		Number r2 = (I(mCenter) - I(range.lower())).upper();
+		mTerms[symbol] = r1 < r2 ? r2 : r1;
+	}
+
+	const Number& center() const {
+		return mCenter;
+	}
+	const std::vector<Number>& terms() const {
+		return mTerms;
+	}
+	const Number& error() const {
+		return mError;
+	}
+
+	AffineForm operator+(const AffineForm& rhs) const {
+		assert(mTerms.size() == rhs.mTerms.size());
+		AffineForm res(mTerms.size());
+		res.mUnbounded = mUnbounded || rhs.mUnbounded;
+		res.mCenter = res.split(I(mCenter) + I(rhs.mCenter));
+		for (std::size_t i = 0; i < mTerms.size(); ++i) {
+			if (mTerms[i] == zero()) res.mTerms[i] = rhs.mTerms[i];
+			else if (rhs.mTerms[i] == zero()) res.mTerms[i] = mTerms[i];
+			else res.mTerms[i] = res.split(I(mTerms[i]) + I(rhs.mTerms[i]));
+		}
+		res.mError = add_up(res.mError, add_up(mError, rhs.mError));
+		return res;
+	}
+
+	/// Multiplies with a constant interval.
+	AffineForm operator*(const I& c) const {
+		AffineForm res(mTerms.size());
+		res.mUnbounded = mUnbounded || c.is_unbounded();
+		if (res.mUnbounded) return res;
+		res.mCenter = res.split(I(mCenter) * c);
+		for (std::size_t i = 0; i < mTerms.size(); ++i) {
+			if (mTerms[i] != zero()) res.mTerms[i] = res.split(I(mTerms[i]) * c);
+		}
+		Number mag = abs(c.lower()) < abs(c.upper()) ? abs(c.upper()) : abs(c.lower());
+		res.mError = add_up(res.mError, mul_up(mag, mError));
+		return res;
+	}
+
+	/**
+	 * Multiplies two affine forms.
+	 * The product of the noise terms is bounded by the product of the radii and added to the error.
+	 */
+	AffineForm operator*(const AffineForm& rhs) const {
+		assert(mTerms.size() == rhs.mTerms.size());
+		AffineForm res(mTerms.size());
+		res.mUnbounded = mUnbounded || rhs.mUnbounded;
+		if (res.mUnbounded) return res;
+		res.mCenter = res.split(I(mCenter) * I(rhs.mCenter));
+		for (std::size_t i = 0; i < mTerms.size(); ++i) {
+			if (mTerms[i] == zero() && rhs.mTerms[i] == zero()) continue;
+			res.mTerms[i] = res.split(I(mCenter) * I(rhs.mTerms[i]) + I(rhs.mCenter) * I(mTerms[i]));
+		}
+		Number err = add_up(mul_up(abs(mCenter), rhs.mError), mul_up(abs(rhs.mCenter), mError));
+		err = add_up(err, mul_up(radius(), rhs.radius()));
+		res.mError = add_up(res.mError, err);
+		return res;
+	}
+
+	/// Returns an interval containing all values of this affine form.
+	I to_interval() const {
+		if (mUnbounded) return I::unbounded_interval();
+		Number r = radius();
+		return I(mCenter) + I(Number(-r), r);
+	}
+};
+
+template<typename Number>
+inline std::ostream& operator<<(std::ostream& os, const AffineForm<Number>& af) {
+	os << af.center();
+	for (std::size_t i = 0; i < af.terms().size(); ++i) {
+		if (af.terms()[i] != carl::constant_zero<Number>::get()) os << " + " << af.terms()[i] << "*e" << i;
+	}
+	return os << " +- " << af.error();
+}
+
+/**
+ * Computes an enclosure of the range of a polynomial over a box using affine arithmetic.
+ *
+ * Has the same signature as evaluate(const MultivariatePolynomial&, const std::map<Variable, Interval<Numeric>>&).
+ * Affine arithmetic keeps linear correlations, hence its enclosures are usually much tighter for small boxes, but may be wider for large boxes.
+ * Bound types are not tracked, the result is a closed interval.
+ * If some interval is unbounded, this falls back to interval evaluation.
+ */
+template<typename Coeff, typename Policy, typename Ordering, typename Numeric>
+inline Interval<Numeric> evaluate_affine(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, Interval<Numeric>>& map) {
+	CARL_LOG_FUNC("carl.core.intervalevaluation", p << ", " << map);
+	if (is_zero(p)) return Interval<Numeric>(0);
+	for (const auto& v: map) {
+		if (v.second.is_empty()) return Interval<Numeric>::empty_interval();
+		if (v.second.is_unbounded()) return evaluate(p, map);
+	}
+	carlVariables vars;
+	carl::variables(p, vars);
+	std::map<Variable, std::size_t> symbols;
+	for (auto v: vars) symbols.emplace(v, symbols.size());
+	std::vector<std::vector<AffineForm<Numeric>>> powers;
+	powers.reserve(symbols.size());
+	for (const auto& [v, s]: symbols) {
+		assert(map.count(v) > 0);
+		powers.emplace_back();
+		powers.back().emplace_back(map.at(v), s, symbols.size());
+	}
+	auto power = [&powers](std::size_t s, std::size_t exp) -> const AffineForm<Numeric>& {
+		auto& pows = powers[s];
+		while (pows.size() < exp) pows.emplace_back(pows.back() * pows.front());
+		return pows[exp - 1];
+	};
+	AffineForm<Numeric> result(Interval<Numeric>(0), symbols.size());
+	for (const auto& t: p) {
+		Interval<Numeric> coeff(t.coeff());
+		if (!t.monomial()) {
+			result = result + AffineForm<Numeric>(coeff, symbols.size());
+			continue;
+		}
+		const auto& m = *t.monomial();
+		AffineForm<Numeric> prod = power(symbols.at(m[0].first), m[0].second);
+		for (std::size_t i = 1; i < m.num_variables(); ++i) {
+			prod = prod * power(symbols.at(m[i].first), m[i].second);
+		}
+		result = result + prod * coeff;
+	}
+	CARL_LOG_TRACE("carl.core.intervalevaluation", "Affine form: " << result);
+	return result.to_interval();
+}
+
+/**
+ * Computes an enclosure of the range of a polynomial over a box as the intersection of interval and affine evaluation.
+ */
+template<typename Coeff, typename Policy, typename Ordering, typename Numeric>
+inline Interval<Numeric> evaluate_tight(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, Interval<Numeric>>& map) {
+	return set_intersection(evaluate(p, map), evaluate_affine(p, map));
+}
+
+}
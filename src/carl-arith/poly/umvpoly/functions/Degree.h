@@ -167,6 +167,12 @@ std::size_t total_degree(const UnivariatePolynomial<Coeff>& p) {
 	} else {
 		if (carl::is_zero(p)) return 0;
 		uint max = 0;
+		if (p.is_sparse()) {
+			for (const auto& c: p.sparse_coefficients()) {
+				max = std::max(max, uint(c.first + total_degree(c.second)));
+			}
+			return max;
+		}
 		for (std::size_t deg = 0; deg < p.coefficients().size(); deg++) {
 			if (!carl::is_zero(p.coefficients()[deg])) {
 				uint tdeg = deg + total_degree(p.coefficients()[deg]);
@@ -201,7 +207,7 @@ std::size_t total_degree(const UnivariatePolynomial<Coeff>& p) {
  */
 template<typename Coeff>
 bool is_constant(const UnivariatePolynomial<Coeff>& p) {
-	return p.coefficients().size() <= 1;
+	return carl::is_zero(p) || p.degree() == 0;
 }
 
 template<typename Coeff>
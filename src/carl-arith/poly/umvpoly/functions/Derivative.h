@@ -108,6 +108,15 @@ UnivariatePolynomial<C> derivative(const UnivariatePolynomial<C>& p, std::size_t
 		CARL_LOG_DEBUG("carl.core", "derivative(" << p << ", " << n << ") = 0");
 		return UnivariatePolynomial<C>(p.main_var());
 	}
+	if (p.is_sparse()) {
+		std::vector<std::pair<uint, C>> newCoeffs;
+		for (const auto& c: p.sparse_coefficients()) {
+			if (c.first < n) continue;
+			std::size_t factor = detail_derivative::multiply(c.first, n);
+			newCoeffs.emplace_back(uint(c.first - n), static_cast<C>(factor) * c.second);
+		}
+		return UnivariatePolynomial<C>(p.main_var(), std::move(newCoeffs));
+	}
 
 	std::vector<C> newCoeffs;
 	for (std::size_t i = 0; i < p.degree() + 1 - n; ++i) {
@@ -126,6 +135,13 @@ UnivariatePolynomial<C> derivative(const UnivariatePolynomial<C>& p, Variable v,
 	if (n == 0) return p;
 	if (is_zero(p)) return p;
 	if (v == p.main_var()) return derivative(p, n);
+	if (p.is_sparse()) {
+		std::vector<std::pair<uint, C>> newCoeffs;
+		for (const auto& c: p.sparse_coefficients()) {
+			newCoeffs.emplace_back(c.first, derivative(c.second, v, n));
+		}
+		return UnivariatePolynomial<C>(p.main_var(), std::move(newCoeffs));
+	}
 
 	std::vector<C> newCoeffs;
 	std::transform(p.coefficients().begin(), p.coefficients().end(), std::back_inserter(newCoeffs),
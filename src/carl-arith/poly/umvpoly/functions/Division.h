@@ -3,9 +3,12 @@
 #include "Quotient.h"
 #include "to_univariate_polynomial.h"
 
+#include "../Geobucket.h"
 #include "../MultivariatePolynomial.h"
 #include "../UnivariatePolynomial.h"
 
+#include <algorithm>
+
 namespace carl {
 
 /**
@@ -32,6 +35,11 @@ bool try_divide(const Term<Coeff>& t, const Coeff& c, Term<Coeff>& res) {
 	return true;
 }
 
+template<typename Coeff>
+bool try_divide(const Term<Coeff>& t, const Term<Coeff>& divisor, Term<Coeff>& res) {
+	return t.divide(divisor, res);
+}
+
 template<typename Coeff>
 bool try_divide(const Term<Coeff>& t, Variable v, Term<Coeff>& res) {
 	if (!t.monomial()) return false;
@@ -120,24 +128,29 @@ bool try_divide(const MultivariatePolynomial<Coeff,Ordering,Policies>& dividend,
 template<typename Coeff, typename Ordering, typename Policies>
 DivisionResult<MultivariatePolynomial<Coeff,Ordering,Policies>> divide(const MultivariatePolynomial<Coeff,Ordering,Policies>& dividend, const MultivariatePolynomial<Coeff,Ordering,Policies>& divisor) {
 	static_assert(is_field_type<Coeff>::value, "Division only defined for field coefficients");
-	MultivariatePolynomial<Coeff,Ordering,Policies> q;
-	MultivariatePolynomial<Coeff,Ordering,Policies> r;
-	MultivariatePolynomial<Coeff,Ordering,Policies> p = dividend;
-	while(!is_zero(p)) {
+	using Poly = MultivariatePolynomial<Coeff,Ordering,Policies>;
+	// The terms of quotient and remainder are found in decreasing order.
+	std::vector<Term<Coeff>> q;
+	std::vector<Term<Coeff>> r;
+	Geobucket<Poly> p(dividend);
+	while(!p.empty()) {
 		Term<Coeff> factor;
 		if (try_divide(p.lterm(), divisor.lterm(), factor)) {
-			q += factor;
-			p.subtractProduct(factor, divisor);
-			//p -= factor * divisor;
+			// The leading terms cancel within the geobucket.
+			p.add(-factor, divisor);
+			q.push_back(std::move(factor));
 		} else {
-			r += p.lterm();
+			r.push_back(p.lterm());
 			p.strip_lterm();
 		}
 	}
-	assert(q.is_consistent());
-	assert(r.is_consistent());
-	assert(dividend == q * divisor + r);
-	return DivisionResult<MultivariatePolynomial<Coeff,Ordering,Policies>> {q,r};
+	std::reverse(q.begin(), q.end());
+	std::reverse(r.begin(), r.end());
+	DivisionResult<Poly> res {Poly(std::move(q), false, true), Poly(std::move(r), false, true)};
+	assert(res.quotient.is_consistent());
+	assert(res.remainder.is_consistent());
+	assert(dividend == res.quotient * divisor + res.remainder);
+	return res;
 }
 
 template<typename Coeff>
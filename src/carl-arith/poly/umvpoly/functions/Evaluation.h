@@ -48,6 +48,19 @@ SubstitutionType evaluate(const MultivariatePolynomial<C,O,P>& p, const std::map
 
 template<typename Coeff>
 Coeff evaluate(const UnivariatePolynomial<Coeff>& p, const Coeff& value) {
+	if (p.is_sparse()) {
+		// Horner's scheme, skipping the zero coefficients by powering.
+		auto it = p.sparse_coefficients().rbegin();
+		Coeff result = it->second;
+		uint exp = it->first;
+		for (++it; it != p.sparse_coefficients().rend(); ++it) {
+			result *= carl::pow(value, exp - it->first);
+			result += it->second;
+			exp = it->first;
+		}
+		if (exp > 0) result *= carl::pow(value, exp);
+		return result;
+	}
 	Coeff result(0);
 	Coeff var(1);
 	for (const Coeff& coeff : p.coefficients()) {
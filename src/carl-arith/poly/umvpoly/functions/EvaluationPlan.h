@@ -0,0 +1,312 @@
+/**
+ * @file EvaluationPlan.h
+ *
+ * Compiles a polynomial into a flat program that can be evaluated repeatedly at many points.
+ */
+
+#pragma once
+
+#include "../MultivariatePolynomial.h"
+#include <carl-arith/interval/Interval.h>
+#include <carl-arith/interval/Power.h>
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+namespace carl {
+
+/**
+ * A polynomial compiled into a register-based program for a fixed variable order.
+ *
+ * The program is a multivariate Horner scheme: the polynomial is split according to the exponents of the first variable,
+ * the coefficients are compiled recursively for the remaining variables and combined as `((c_k * x^(e_k - e_{k-1}) + c_{k-1}) * ...) * x^(e_0)`.
+ * All powers of a variable that are needed for the gaps between consecutive exponents are computed only once per evaluation and shared.
+ *
+ * The registers are laid out as follows: the values of the variables (in the given order), the coefficients converted to Number, and finally the intermediate results.
+ * No lookup by variable and no allocation happens during evaluation if a Workspace is reused.
+ *
+ * Number can be any type supporting `+`, `*` and `carl::pow`, for example `double`, `mpq_class` or `Interval<double>`.
+ * Coefficients are converted to Number upon construction; for `Interval<double>`, this conversion rounds outwards.
+ */
+template<typename Number>
+class EvaluationPlan {
+public:
+	/// Registers for a single evaluation.
+	using Workspace = std::vector<Number>;
+	/// Registers for a batch evaluation, one column per register.
+	using BatchWorkspace = std::vector<std::vector<Number>>;
+	enum class OpCode { ADD, MUL, POW };
+	struct Instruction {
+		OpCode op;
+		std::size_t target;
+		std::size_t lhs;
+		/// Either a register or, for POW, the exponent.
+		std::size_t rhs;
+	};
+private:
+
+	/// Variable order, variable i is stored in register i.
+	std::vector<Variable> mVariables;
+	/// Converted coefficients, stored in the registers following the variables.
+	std::vector<Number> mConstants;
+	/// The program.
+	std::vector<Instruction> mProgram;
+	/// Total number of registers.
+	std::size_t mRegisters = 0;
+	/// Register containing the result.
+	std::size_t mResult = 0;
+	/// Maps (variable index, exponent) to the register holding this power.
+	std::map<std::pair<std::size_t,std::size_t>, std::size_t> mPowers;
+
+	template<typename Coeff>
+	static Number convert_constant(const Coeff& c) {
+		if constexpr (std::is_same_v<Number, Coeff>) {
+			return c;
+		} else if constexpr (std::is_floating_point_v<Number>) {
+			return carl::to_double(c);
+		} else {
+			return Number(c);
+		}
+	}
+
+	std::size_t add_constant(const Number& n) {
+		mConstants.emplace_back(n);
+		return mVariables.size() + mConstants.size() - 1;
+	}
+	std::size_t emit(OpCode op, std::size_t lhs, std::size_t rhs) {
+		mProgram.emplace_back(Instruction{op, mRegisters, lhs, rhs});
+		return mRegisters++;
+	}
+	std::size_t power(std::size_t var, std::size_t exp) {
+		assert(exp > 0);
+		if (exp == 1) return var;
+		auto it = mPowers.find(std::make_pair(var, exp));
+		if (it != mPowers.end()) return it->second;
+		std::size_t reg = emit(OpCode::POW, var, exp);
+		mPowers.emplace(std::make_pair(var, exp), reg);
+		return reg;
+	}
+
+	/**
+	 * Compiles the terms given by their coefficient registers and exponent vectors in [begin, end) with respect to the variables starting at level.
+	 * The terms are sorted lexicographically with respect to their exponent vectors, descending.
+	 */
+	template<typename It>
+	std::size_t compile(It begin, It end, std::size_t level) {
+		assert(begin != end);
+		if (level == mVariables.size()) {
+			assert(std::next(begin) == end);
+			return begin->first;
+		}
+		std::size_t result = 0;
+		std::size_t last_exp = 0;
+		bool first = true;
+		while (begin != end) {
+			std::size_t exp = begin->second[level];
+			auto group_end = std::find_if(begin, end, [level, exp](const auto& t){ return t.second[level] != exp; });
+			std::size_t sub = compile(begin, group_end, level + 1);
+			if (first) {
+				result = sub;
+				first = false;
+			} else {
+				result = emit(OpCode::MUL, result, power(level, last_exp - exp));
+				result = emit(OpCode::ADD, result, sub);
+			}
+			last_exp = exp;
+			begin = group_end;
+		}
+		if (last_exp > 0) {
+			result = emit(OpCode::MUL, result, power(level, last_exp));
+		}
+		return result;
+	}
+
+	void execute(Number* regs, std::size_t from, std::size_t to) const {
+		for (std::size_t i = from; i < to; ++i) {
+			const auto& ins = mProgram[i];
+			switch (ins.op) {
+				case OpCode::ADD: regs[ins.target] = regs[ins.lhs] + regs[ins.rhs]; break;
+				case OpCode::MUL: regs[ins.target] = regs[ins.lhs] * regs[ins.rhs]; break;
+				case OpCode::POW: regs[ins.target] = carl::pow(regs[ins.lhs], static_cast<uint>(ins.rhs)); break;
+			}
+		}
+	}
+public:
+	/**
+	 * Compiles the given polynomial for the given variable order.
+	 * All variables of the polynomial must occur in the order.
+	 */
+	template<typename Coeff, typename Ordering, typename Policies>
+	EvaluationPlan(const MultivariatePolynomial<Coeff,Ordering,Policies>& p, const std::vector<Variable>& order): mVariables(order) {
+		using Entry = std::pair<std::size_t, std::vector<std::size_t>>;
+		std::vector<Entry> terms;
+		for (const auto& t: p) {
+			std::vector<std::size_t> exps(mVariables.size(), 0);
+			if (t.monomial()) {
+				for (const auto& [var, exp]: *t.monomial()) {
+					auto it = std::find(mVariables.begin(), mVariables.end(), var);
+					assert(it != mVariables.end());
+					exps[static_cast<std::size_t>(std::distance(mVariables.begin(), it))] = exp;
+				}
+			}
+			terms.emplace_back(0, std::move(exps));
+		}
+		// Coefficients are stored in the order of the sorted terms.
+		std::vector<std::size_t> perm(terms.size());
+		std::iota(perm.begin(), perm.end(), 0);
+		std::sort(perm.begin(), perm.end(), [&terms](std::size_t a, std::size_t b){ return terms[a].second > terms[b].second; });
+		std::vector<Entry> sorted;
+		sorted.reserve(terms.size());
+		for (auto i: perm) {
+			sorted.emplace_back(add_constant(convert_constant(p[i].coeff())), std::move(terms[i].second));
+		}
+		mRegisters = mVariables.size() + mConstants.size();
+		if (sorted.empty()) {
+			mResult = add_constant(convert_constant(constant_zero<Coeff>::get()));
+			// Registers of temporaries were not used yet, move them behind the new constant.
+			mRegisters = mVariables.size() + mConstants.size();
+		} else {
+			mResult = compile(sorted.begin(), sorted.end(), 0);
+		}
+		mPowers.clear();
+	}
+	/**
+	 * Compiles the given polynomial for the variables of the polynomial in their natural order.
+	 */
+	template<typename Coeff, typename Ordering, typename Policies>
+	explicit EvaluationPlan(const MultivariatePolynomial<Coeff,Ordering,Policies>& p): EvaluationPlan(p, carl::variables(p).as_vector()) {}
+
+	/// Returns the variable order, i.e. the order of values expected by evaluate().
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+	/// Returns the number of instructions.
+	std::size_t size() const {
+		return mProgram.size();
+	}
+	/// Returns the program, for other evaluators working on the same register layout.
+	const std::vector<Instruction>& program() const {
+		return mProgram;
+	}
+	/// Returns the converted coefficients, stored in the registers following the variables.
+	const std::vector<Number>& constants() const {
+		return mConstants;
+	}
+	/// Returns the total number of registers.
+	std::size_t num_registers() const {
+		return mRegisters;
+	}
+	/// Returns the register containing the result.
+	std::size_t result_register() const {
+		return mResult;
+	}
+
+	/// Creates a workspace for evaluate(), it can be reused for any number of evaluations.
+	Workspace workspace() const {
+		Workspace res(mRegisters);
+		std::copy(mConstants.begin(), mConstants.end(), res.begin() + static_cast<long>(mVariables.size()));
+		return res;
+	}
+
+	/**
+	 * Evaluates the polynomial at the given point, using the given workspace.
+	 * @param point Values of the variables in the order given by variables().
+	 * @param ws A workspace obtained from workspace().
+	 */
+	const Number& evaluate(const Number* point, Workspace& ws) const {
+		assert(ws.size() == mRegisters);
+		std::copy(point, point + mVariables.size(), ws.begin());
+		execute(ws.data(), 0, mProgram.size());
+		return ws[mResult];
+	}
+	/// Evaluates the polynomial at the given point, values are given in the order of variables().
+	Number evaluate(const std::vector<Number>& point) const {
+		assert(point.size() == mVariables.size());
+		auto ws = workspace();
+		return evaluate(point.data(), ws);
+	}
+	/// Evaluates the polynomial at the given point.
+	Number evaluate(const std::map<Variable, Number>& point) const {
+		auto ws = workspace();
+		for (std::size_t i = 0; i < mVariables.size(); ++i) {
+			assert(point.find(mVariables[i]) != point.end());
+			ws[i] = point.at(mVariables[i]);
+		}
+		execute(ws.data(), 0, mProgram.size());
+		return ws[mResult];
+	}
+
+	/**
+	 * Evaluates the polynomial at many points given as structure of arrays.
+	 * The program is executed instruction by instruction over all points, hence the inner loops operate on contiguous memory.
+	 * @param columns columns[i][k] is the value of variable i (in the order of variables()) in the k'th point.
+	 * @param results Is resized to the number of points and filled with the results.
+	 * @param ws Workspace that is reused between calls to avoid allocations.
+	 */
+	void evaluate_batch(const std::vector<std::vector<Number>>& columns, std::vector<Number>& results, BatchWorkspace& ws) const {
+		assert(columns.size() == mVariables.size());
+		std::size_t n = columns.empty() ? results.size() : columns.front().size();
+		ws.resize(mRegisters);
+		for (std::size_t r = mVariables.size(); r < mRegisters; ++r) {
+			if (r < mVariables.size() + mConstants.size()) {
+				ws[r].assign(n, mConstants[r - mVariables.size()]);
+			} else {
+				ws[r].resize(n);
+			}
+		}
+		for (const auto& ins: mProgram) {
+			const auto& lhs = ins.lhs < mVariables.size() ? columns[ins.lhs] : ws[ins.lhs];
+			auto& target = ws[ins.target];
+			switch (ins.op) {
+				case OpCode::ADD: {
+					const auto& rhs = ins.rhs < mVariables.size() ? columns[ins.rhs] : ws[ins.rhs];
+					for (std::size_t k = 0; k < n; ++k) target[k] = lhs[k] + rhs[k];
+					break;
+				}
+				case OpCode::MUL: {
+					const auto& rhs = ins.rhs < mVariables.size() ? columns[ins.rhs] : ws[ins.rhs];
+					for (std::size_t k = 0; k < n; ++k) target[k] = lhs[k] * rhs[k];
+					break;
+				}
+				case OpCode::POW: {
+					for (std::size_t k = 0; k < n; ++k) target[k] = carl::pow(lhs[k], static_cast<uint>(ins.rhs));
+					break;
+				}
+			}
+		}
+		const auto& res = mResult < mVariables.size() ? columns[mResult] : ws[mResult];
+		results.assign(res.begin(), res.begin() + static_cast<long>(n));
+	}
+	/// Evaluates the polynomial at many points given as structure of arrays.
+	std::vector<Number> evaluate_batch(const std::vector<std::vector<Number>>& columns) const {
+		std::vector<Number> results;
+		BatchWorkspace ws;
+		evaluate_batch(columns, results, ws);
+		return results;
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const EvaluationPlan& plan) {
+		auto reg = [&plan](std::size_t r) {
+			std::stringstream ss;
+			if (r < plan.mVariables.size()) ss << plan.mVariables[r];
+			else if (r < plan.mVariables.size() + plan.mConstants.size()) ss << plan.mConstants[r - plan.mVariables.size()];
+			else ss << "r" << r;
+			return ss.str();
+		};
+		for (const auto& ins: plan.mProgram) {
+			os << "r" << ins.target << " = ";
+			switch (ins.op) {
+				case OpCode::ADD: os << reg(ins.lhs) << " + " << reg(ins.rhs); break;
+				case OpCode::MUL: os << reg(ins.lhs) << " * " << reg(ins.rhs); break;
+				case OpCode::POW: os << reg(ins.lhs) << "^" << ins.rhs; break;
+			}
+			os << std::endl;
+		}
+		return os << "return " << reg(plan.mResult);
+	}
+};
+
+}
@@ -7,6 +7,7 @@
 
 #include "../CoCoAAdaptor.h"
 #include <carl-arith/converter/OldGinacConverter.h>
+#include <carl-statistics/carl-statistics.h>
 
 namespace carl {
 
@@ -44,6 +45,7 @@ namespace gcd_detail {
 
 template<typename C, typename O, typename P>
 MultivariatePolynomial<C,O,P> gcd(const MultivariatePolynomial<C,O,P>& a, const MultivariatePolynomial<C,O,P>& b) {
+	CARL_TRACE_SPAN("carl.gcd", "gcd");
 	CARL_LOG_DEBUG("carl.core.gcd", "gcd(" << a << ", " << b << ")");
 	assert(!is_zero(a));
 	assert(!is_zero(b));
@@ -5,6 +5,7 @@
 
 #include "../UnivariatePolynomial.h"
 #include <carl-arith/core/Variable.h>
+#include <carl-statistics/carl-statistics.h>
 
 namespace carl {
 
@@ -102,6 +103,7 @@ UnivariatePolynomial<Coeff> extended_gcd(const UnivariatePolynomial<Coeff>& a, c
  */
 template<typename Coeff>
 UnivariatePolynomial<Coeff> gcd(const UnivariatePolynomial<Coeff>& a, const UnivariatePolynomial<Coeff>& b) {
+	CARL_TRACE_SPAN("carl.gcd", "gcd_univariate");
 	// We want degree(b) <= degree(a).
 	assert(!carl::is_zero(a));
 	assert(!carl::is_zero(b));
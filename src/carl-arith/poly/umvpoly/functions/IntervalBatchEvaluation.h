@@ -0,0 +1,242 @@
+/**
+ * @file IntervalBatchEvaluation.h
+ *
+ * Evaluation of polynomials over many boxes of double intervals at once.
+ */
+
+#pragma once
+
+#include "EvaluationPlan.h"
+
+#include <carl-arith/interval/FastDoubleInterval.h>
+
+#include <limits>
+
+namespace carl {
+
+namespace interval_batch {
+	/// a^n rounded upward for a >= 0.
+	inline double pow_up(double a, std::size_t n) {
+		double r = a;
+		for (std::size_t i = 1; i < n; ++i) r = fast_interval::mul_up(r, a);
+		return r;
+	}
+	/// a^n rounded downward for a >= 0.
+	inline double pow_down(double a, std::size_t n) {
+		double r = a;
+		for (std::size_t i = 1; i < n; ++i) r = fast_interval::mul_down(r, a);
+		return r;
+	}
+}
+
+/**
+ * Evaluates a polynomial over many boxes of double intervals at once.
+ *
+ * The polynomial is compiled into an EvaluationPlan and the program is executed instruction by instruction over all boxes.
+ * Every register is stored as two contiguous arrays, holding the negated lower bounds and the upper bounds.
+ * As negation is exact, all bounds are rounded upward.
+ * The rounding mode is never changed, instead the operations of fast_interval compute with the default rounding and use error-free transformations to round outwards,
+ * hence the bounds are rigorous without relying on the compiler to respect a changed rounding mode.
+ * All intervals are treated as closed, infinite bounds are represented by infinities.
+ */
+class IntervalBatchEvaluator {
+public:
+	/// Structure of arrays of intervals: lower[i][k] and upper[i][k] are the bounds of the i'th value in the k'th box.
+	struct Batch {
+		std::vector<std::vector<double>> lower;
+		std::vector<std::vector<double>> upper;
+	};
+	/// Registers, one array of negated lower bounds and one of upper bounds per register.
+	struct Workspace {
+		std::vector<std::vector<double>> nlower;
+		std::vector<std::vector<double>> upper;
+	};
+private:
+	using Plan = EvaluationPlan<Interval<double>>;
+	using OpCode = Plan::OpCode;
+	Plan mPlan;
+
+	static double lower_of(const Interval<double>& i) {
+		return i.lower_bound_type() == BoundType::INFTY ? -std::numeric_limits<double>::infinity() : i.lower();
+	}
+	static double upper_of(const Interval<double>& i) {
+		return i.upper_bound_type() == BoundType::INFTY ? std::numeric_limits<double>::infinity() : i.upper();
+	}
+	static Interval<double> to_interval(double lower, double upper) {
+		BoundType lt = lower == -std::numeric_limits<double>::infinity() ? BoundType::INFTY : BoundType::WEAK;
+		BoundType ut = upper == std::numeric_limits<double>::infinity() ? BoundType::INFTY : BoundType::WEAK;
+		if (lt == BoundType::INFTY && ut == BoundType::INFTY) return Interval<double>::unbounded_interval();
+		return Interval<double>(lt == BoundType::INFTY ? 0.0 : lower, lt, ut == BoundType::INFTY ? 0.0 : upper, ut);
+	}
+
+	/// Executes the program.
+	void execute(const std::vector<std::vector<double>>& nlower, const std::vector<std::vector<double>>& upper, std::size_t n, Workspace& ws) const {
+		std::size_t vars = mPlan.variables().size();
+		std::size_t regs = mPlan.num_registers();
+		ws.nlower.resize(regs);
+		ws.upper.resize(regs);
+		for (std::size_t r = 0; r < vars; ++r) {
+			ws.nlower[r] = nlower[r];
+			ws.upper[r] = upper[r];
+		}
+		for (std::size_t r = vars; r < regs; ++r) {
+			if (r < vars + mPlan.constants().size()) {
+				const auto& c = mPlan.constants()[r - vars];
+				ws.nlower[r].assign(n, -lower_of(c));
+				ws.upper[r].assign(n, upper_of(c));
+			} else {
+				ws.nlower[r].resize(n);
+				ws.upper[r].resize(n);
+			}
+		}
+		for (const auto& ins: mPlan.program()) {
+			const double* al = ws.nlower[ins.lhs].data();
+			const double* ah = ws.upper[ins.lhs].data();
+			double* tl = ws.nlower[ins.target].data();
+			double* th = ws.upper[ins.target].data();
+			switch (ins.op) {
+				case OpCode::ADD: {
+					const double* bl = ws.nlower[ins.rhs].data();
+					const double* bh = ws.upper[ins.rhs].data();
+					for (std::size_t k = 0; k < n; ++k) {
+						tl[k] = fast_interval::add_up(al[k], bl[k]);
+						th[k] = fast_interval::add_up(ah[k], bh[k]);
+					}
+					break;
+				}
+				case OpCode::MUL: {
+					const double* bl = ws.nlower[ins.rhs].data();
+					const double* bh = ws.upper[ins.rhs].data();
+					for (std::size_t k = 0; k < n; ++k) {
+						double a0 = -al[k], a1 = ah[k], b0 = -bl[k], b1 = bh[k];
+						th[k] = std::max(std::max(fast_interval::mul_up(a0, b0), fast_interval::mul_up(a0, b1)), std::max(fast_interval::mul_up(a1, b0), fast_interval::mul_up(a1, b1)));
+						tl[k] = std::max(std::max(fast_interval::mul_up(-a0, b0), fast_interval::mul_up(-a0, b1)), std::max(fast_interval::mul_up(-a1, b0), fast_interval::mul_up(-a1, b1)));
+					}
+					break;
+				}
+				case OpCode::POW: {
+					std::size_t e = ins.rhs;
+					for (std::size_t k = 0; k < n; ++k) {
+						double lo = -al[k], hi = ah[k];
+						if (e % 2 == 1) {
+							tl[k] = lo >= 0 ? -interval_batch::pow_down(lo, e) : interval_batch::pow_up(-lo, e);
+							th[k] = hi >= 0 ? interval_batch::pow_up(hi, e) : -interval_batch::pow_down(-hi, e);
+						} else if (lo >= 0) {
+							tl[k] = -interval_batch::pow_down(lo, e);
+							th[k] = interval_batch::pow_up(hi, e);
+						} else if (hi <= 0) {
+							tl[k] = -interval_batch::pow_down(-hi, e);
+							th[k] = interval_batch::pow_up(-lo, e);
+						} else {
+							tl[k] = 0.0;
+							th[k] = interval_batch::pow_up(std::max(-lo, hi), e);
+						}
+					}
+					break;
+				}
+			}
+		}
+	}
+
+public:
+	/// Compiles the given polynomial for the given variable order.
+	template<typename Coeff, typename Ordering, typename Policies>
+	IntervalBatchEvaluator(const MultivariatePolynomial<Coeff,Ordering,Policies>& p, const std::vector<Variable>& order): mPlan(p, order) {}
+	/// Compiles the given polynomial for its variables in their natural order.
+	template<typename Coeff, typename Ordering, typename Policies>
+	explicit IntervalBatchEvaluator(const MultivariatePolynomial<Coeff,Ordering,Policies>& p): mPlan(p) {}
+
+	/// Returns the variable order used for the rows of a Batch.
+	const std::vector<Variable>& variables() const {
+		return mPlan.variables();
+	}
+
+	/**
+	 * Creates a batch from the given boxes.
+	 * Every box must contain an interval for every variable, all intervals must be nonempty.
+	 */
+	Batch make_batch(const std::vector<std::map<Variable, Interval<double>>>& boxes) const {
+		Batch res;
+		res.lower.resize(variables().size());
+		res.upper.resize(variables().size());
+		for (std::size_t i = 0; i < variables().size(); ++i) {
+			res.lower[i].reserve(boxes.size());
+			res.upper[i].reserve(boxes.size());
+			for (const auto& box: boxes) {
+				const auto& val = box.at(variables()[i]);
+				assert(!val.is_empty());
+				res.lower[i].push_back(lower_of(val));
+				res.upper[i].push_back(upper_of(val));
+			}
+		}
+		return res;
+	}
+
+	/**
+	 * Evaluates the polynomial over all boxes of the given batch.
+	 * The result is stored in the first row of result, it is guaranteed to contain the range of the polynomial over every box.
+	 */
+	void evaluate(const Batch& boxes, Batch& result, Workspace& ws) const {
+		std::size_t n = boxes.lower.empty() ? 1 : boxes.lower.front().size();
+		std::vector<std::vector<double>> nlower(boxes.lower.size());
+		for (std::size_t i = 0; i < boxes.lower.size(); ++i) {
+			nlower[i].resize(n);
+			for (std::size_t k = 0; k < n; ++k) nlower[i][k] = -boxes.lower[i][k];
+		}
+		execute(nlower, boxes.upper, n, ws);
+		result.lower.resize(1);
+		result.upper.resize(1);
+		result.lower[0].resize(n);
+		result.upper[0].resize(n);
+		const auto& rl = ws.nlower[mPlan.result_register()];
+		const auto& ru = ws.upper[mPlan.result_register()];
+		for (std::size_t k = 0; k < n; ++k) {
+			result.lower[0][k] = -rl[k];
+			result.upper[0][k] = ru[k];
+		}
+	}
+	/// Evaluates the polynomial over all given boxes.
+	std::vector<Interval<double>> evaluate(const std::vector<std::map<Variable, Interval<double>>>& boxes) const {
+		Batch result;
+		Workspace ws;
+		evaluate(make_batch(boxes), result, ws);
+		std::vector<Interval<double>> res;
+		res.reserve(boxes.size());
+		for (std::size_t k = 0; k < boxes.size(); ++k) {
+			// Without variables, the result does not depend on the box and is only computed once.
+			std::size_t i = variables().empty() ? 0 : k;
+			res.emplace_back(to_interval(result.lower[0][i], result.upper[0][i]));
+		}
+		return res;
+	}
+	/// Evaluates the polynomial over a single box.
+	Interval<double> evaluate(const std::map<Variable, Interval<double>>& box) const {
+		return evaluate(std::vector<std::map<Variable, Interval<double>>>({box})).front();
+	}
+
+	/**
+	 * Evaluates many polynomials over a single box, reusing the workspace.
+	 */
+	static std::vector<Interval<double>> evaluate(const std::vector<IntervalBatchEvaluator>& evaluators, const std::map<Variable, Interval<double>>& box) {
+		std::vector<Interval<double>> res;
+		res.reserve(evaluators.size());
+		Workspace ws;
+		std::vector<std::vector<double>> nlower;
+		std::vector<std::vector<double>> upper;
+		for (const auto& e: evaluators) {
+			nlower.resize(e.variables().size());
+			upper.resize(e.variables().size());
+			for (std::size_t i = 0; i < e.variables().size(); ++i) {
+				const auto& val = box.at(e.variables()[i]);
+				assert(!val.is_empty());
+				nlower[i].assign(1, -lower_of(val));
+				upper[i].assign(1, upper_of(val));
+			}
+			e.execute(nlower, upper, 1, ws);
+			res.emplace_back(to_interval(-ws.nlower[e.mPlan.result_register()][0], ws.upper[e.mPlan.result_register()][0]));
+		}
+		return res;
+	}
+};
+
+}
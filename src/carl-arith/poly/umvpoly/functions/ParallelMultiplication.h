@@ -0,0 +1,68 @@
+#pragma once
+
+#include "../MultivariatePolynomial.h"
+
+#include <carl-common/config.h>
+#include <carl-common/parallel/ThreadPool.h>
+#include <carl-statistics/carl-statistics.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace carl {
+
+/**
+ * Products with fewer pairs of terms than this are computed sequentially by parallel_multiply(),
+ * as distributing them over several threads does not pay off.
+ */
+constexpr std::size_t parallel_multiplication_threshold = 1 << 14;
+
+/**
+ * Multiplies two polynomials using several threads.
+ *
+ * The terms of the larger operand are split into chunks, which are multiplied with the other operand on the ThreadPool.
+ * The partial products are then summed up pairwise, where the sums of every round are again computed in parallel.
+ * An exception thrown by some partial product is rethrown in the calling thread.
+ * If THREAD_SAFE is not defined, only a single thread is available, or the product has fewer than threshold pairs of terms,
+ * this is the same as lhs * rhs.
+ * @param lhs First factor.
+ * @param rhs Second factor.
+ * @param num_threads Number of threads, the hardware concurrency if zero.
+ * @param threshold Minimal number of pairs of terms for a parallel multiplication.
+ * @return lhs * rhs.
+ */
+template<typename C, typename O, typename P>
+MultivariatePolynomial<C,O,P> parallel_multiply(const MultivariatePolynomial<C,O,P>& lhs, const MultivariatePolynomial<C,O,P>& rhs, std::size_t num_threads = 0, std::size_t threshold = parallel_multiplication_threshold) {
+#ifdef THREAD_SAFE
+	if (num_threads == 0) num_threads = ThreadPool::hardware_threads();
+#else
+	// The monomial pool is not synchronized.
+	num_threads = 1;
+#endif
+	const auto& split = lhs.nr_terms() >= rhs.nr_terms() ? lhs : rhs;
+	const auto& other = lhs.nr_terms() >= rhs.nr_terms() ? rhs : lhs;
+	if (num_threads <= 1 || split.nr_terms() < 2 || lhs.nr_terms() * rhs.nr_terms() < threshold) {
+		return lhs * rhs;
+	}
+	CARL_TRACE_SPAN("carl.poly", "parallel_multiply");
+	// More chunks than threads balance the load if the products differ in their number of cancellations.
+	std::size_t chunks = std::min(4 * num_threads, split.nr_terms());
+	std::vector<MultivariatePolynomial<C,O,P>> partial(chunks);
+	auto& pool = ThreadPool::getInstance();
+	pool.run(chunks, num_threads, [&](std::size_t i) {
+		auto begin = split.begin() + static_cast<std::ptrdiff_t>(i * split.nr_terms() / chunks);
+		auto end = split.begin() + static_cast<std::ptrdiff_t>((i + 1) * split.nr_terms() / chunks);
+		MultivariatePolynomial<C,O,P> chunk(typename MultivariatePolynomial<C,O,P>::TermsType(begin, end), false, false);
+		partial[i] = other * chunk;
+	});
+	while (partial.size() > 1) {
+		std::size_t pairs = partial.size() / 2;
+		pool.run(pairs, num_threads, [&](std::size_t i) {
+			partial[i] += partial[partial.size() - 1 - i];
+		});
+		partial.resize(partial.size() - pairs);
+	}
+	return partial.front();
+}
+
+}
@@ -2,6 +2,7 @@
 
 #include "../MultivariatePolynomial.h"
 #include "../UnivariatePolynomial.h"
+#include "ParallelMultiplication.h"
 
 namespace carl {
 
@@ -37,18 +38,25 @@ Term<Coeff> pow(const Term<Coeff>& t, uint exp) {
 	}
 }
 
+/**
+ * Calculates the given power of a polynomial by repeated squaring.
+ * Large products are computed by parallel_multiply(), small ones sequentially.
+ * @param p The polynomial.
+ * @param exp Exponent.
+ * @return The polynomial to the power of exp.
+ */
 template<typename C, typename O, typename P>
 MultivariatePolynomial<C,O,P> pow(const MultivariatePolynomial<C,O,P>& p, std::size_t exp) {
-	//std::cout << "pw(" << *this << " ^ " << exp << ")" << std::endl;
 	if (carl::is_zero(p)) return MultivariatePolynomial<C,O,P>(constant_zero<C>::get());
 	if (exp == 0) return MultivariatePolynomial<C,O,P>(constant_one<C>::get());
 	if (exp == 1) return MultivariatePolynomial<C,O,P>(p);
-	if (exp == 2) return p*p;
+	if (exp == 2) return parallel_multiply(p, p);
 	MultivariatePolynomial<C,O,P> res(constant_one<C>::get());
 	MultivariatePolynomial<C,O,P> mult(p);
-	while(exp > 0) {
-		res *= mult;
-		exp--;
+	while (exp > 0) {
+		if ((exp & 1) != 0) res = parallel_multiply(res, mult);
+		exp /= 2;
+		if (exp > 0) mult = parallel_multiply(mult, mult);
 	}
 	return res;
 }
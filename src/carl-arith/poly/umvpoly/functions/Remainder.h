@@ -4,11 +4,75 @@
 #include "Quotient.h"
 #include "to_univariate_polynomial.h"
 
+#include "../Geobucket.h"
 #include "../MultivariatePolynomial.h"
 #include "../UnivariatePolynomial.h"
 
+#include <algorithm>
+
 namespace carl {
 
+namespace detail_remainder {
+	/// Returns the nonzero coefficients of p together with their exponents in increasing order.
+	template<typename Coeff>
+	std::vector<std::pair<uint, Coeff>> sparse_terms(const UnivariatePolynomial<Coeff>& p) {
+		if (p.is_sparse()) return p.sparse_coefficients();
+		std::vector<std::pair<uint, Coeff>> res;
+		for (uint exp = 0; exp < p.coefficients().size(); ++exp) {
+			if (!carl::is_zero(p.coefficients()[exp])) res.emplace_back(exp, p.coefficients()[exp]);
+		}
+		return res;
+	}
+
+	/**
+	 * Computes the pseudo-remainder like pseudo_remainder(), but only operates on the nonzero coefficients.
+	 * Assumes that the degree of the divisor is positive and at most the degree of the dividend.
+	 */
+	template<typename Coeff>
+	UnivariatePolynomial<Coeff> sparse_pseudo_remainder(const UnivariatePolynomial<Coeff>& dividend, const UnivariatePolynomial<Coeff>& divisor) {
+		using Terms = std::vector<std::pair<uint, Coeff>>;
+		Terms res = sparse_terms(dividend);
+		Terms reduct = sparse_terms(divisor);
+		reduct.pop_back();
+		const Coeff& lc = divisor.lcoeff();
+		uint degree = divisor.degree();
+		std::size_t reductions = 0;
+		while (!res.empty() && res.back().first >= degree) {
+			// res = lc * res - lcoeff(res) * x^shift * divisor, where the leading terms cancel.
+			Coeff factor = std::move(res.back().second);
+			uint shift = res.back().first - degree;
+			res.pop_back();
+			Terms next;
+			next.reserve(res.size() + reduct.size());
+			auto r = res.begin();
+			auto d = reduct.begin();
+			while (r != res.end() || d != reduct.end()) {
+				if (d == reduct.end() || (r != res.end() && r->first < d->first + shift)) {
+					next.emplace_back(r->first, r->second * lc);
+					++r;
+				} else if (r == res.end() || d->first + shift < r->first) {
+					next.emplace_back(d->first + shift, -(factor * d->second));
+					++d;
+				} else {
+					Coeff c = r->second * lc - factor * d->second;
+					if (!carl::is_zero(c)) next.emplace_back(r->first, std::move(c));
+					++r;
+					++d;
+				}
+			}
+			res = std::move(next);
+			reductions++;
+		}
+		if (res.empty()) return UnivariatePolynomial<Coeff>(dividend.main_var());
+		std::size_t degdiff = dividend.degree() - divisor.degree() + 1;
+		if (reductions < degdiff) {
+			Coeff factor = carl::pow(lc, degdiff - reductions);
+			for (auto& c: res) c.second *= factor;
+		}
+		return UnivariatePolynomial<Coeff>(dividend.main_var(), std::move(res));
+	}
+}
+
 /**
  * Does the heavy lifting for the remainder computation of polynomial division.
  * @param divisor
@@ -108,6 +172,9 @@ UnivariatePolynomial<Coeff> pseudo_remainder(const UnivariatePolynomial<Coeff>&
 	Variable v = dividend.main_var();
 	if (divisor.degree() == 0) return UnivariatePolynomial<Coeff>(v);
 	if (divisor.degree() > dividend.degree()) return dividend;
+	if (dividend.is_sparse() || divisor.is_sparse()) {
+		return detail_remainder::sparse_pseudo_remainder(dividend, divisor);
+	}
 
 	UnivariatePolynomial<Coeff> reduct = divisor;
 	reduct.truncate();
@@ -178,36 +245,39 @@ MultivariatePolynomial<C,O,P> remainder(const MultivariatePolynomial<C,O,P>& div
 		return MultivariatePolynomial<C,O,P>();
 	}
 
-	MultivariatePolynomial<C,O,P> remainder;
-	MultivariatePolynomial p = dividend;
-	while(!carl::is_zero(p))
+	// The terms of the remainder are found in decreasing order.
+	std::vector<Term<C>> terms;
+	Geobucket<MultivariatePolynomial<C,O,P>> p(dividend);
+	while(!p.empty())
 	{
 		if(p.lterm().tdeg() < divisor.lterm().tdeg())
 		{
 			assert(!p.lterm().divisible(divisor.lterm()));
 			if( O::degreeOrder )
 			{
-				remainder += p;
-                assert(remainder.is_consistent());
-				return remainder;
+				// No remaining term is divisible.
+				break;
 			}
-			remainder += p.lterm();
+			terms.push_back(p.lterm());
 			p.strip_lterm();
 		}
 		else
 		{
 			Term<C> factor;
 			if (p.lterm().divide(divisor.lterm(), factor)) {
-				p.subtractProduct(factor, divisor);
-				//p -= factor * divisor;
+				// The leading terms cancel within the geobucket.
+				p.add(-factor, divisor);
 			}
 			else
 			{
-				remainder += p.lterm();
+				terms.push_back(p.lterm());
 				p.strip_lterm();
 			}
 		}
 	}
+	std::reverse(terms.begin(), terms.end());
+	MultivariatePolynomial<C,O,P> remainder(std::move(terms), false, true);
+	remainder += p.to_polynomial();
 	assert(remainder.is_consistent());
 	assert(dividend == quotient(dividend, divisor) * divisor + remainder);
 	return remainder;
@@ -9,6 +9,8 @@
 #include "Remainder.h"
 #include "to_univariate_polynomial.h"
 
+#include <carl-statistics/carl-statistics.h>
+
 #include <list>
 #include <vector>
 
@@ -49,6 +51,7 @@ std::list<UnivariatePolynomial<Coeff>> subresultants(
 	const UnivariatePolynomial<Coeff>& pol1,
 	const UnivariatePolynomial<Coeff>& pol2,
 	SubresultantStrategy strategy) {
+	CARL_TRACE_SPAN("carl.resultant", "subresultants");
 	/* The algorithm consists of three parts:
 	 * Part 1: Initialization, i.e. preparation of the input so that the requirements of the core algorithm in parts 2 and 3 are met.
 	 * Part 2: First part of the main loop. If the two subresultants which were added before (initially the two inputs) differ by more
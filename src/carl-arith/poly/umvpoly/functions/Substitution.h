@@ -356,6 +356,9 @@ void substitute_inplace(UnivariatePolynomial<Coeff>& p, Variable var, const Coef
 			MultivariatePolynomial<typename UnderlyingNumberType<Coeff>::type> tmp(p);
 			substitute_inplace(tmp, var, value);
 			p = carl::to_univariate_polynomial(tmp, p.main_var());
+		} else if (p.is_sparse()) {
+			p = substitute(p, var, value);
+			return;
 		} else {
 			// Safely substitute into each coefficient separately
 			for (auto& c: p.coefficients()) {
@@ -377,8 +380,14 @@ UnivariatePolynomial<Coeff> substitute(const UnivariatePolynomial<Coeff>& p, Var
 	} else {
 		if (var == p.main_var()) {
 			UnivariatePolynomial<Coeff> res(p.main_var());
-			for (const auto& c: p.coefficients()) {
-				res += substitute(c, var, value);
+			if (p.is_sparse()) {
+				for (const auto& c: p.sparse_coefficients()) {
+					res += substitute(c.second, var, value);
+				}
+			} else {
+				for (const auto& c: p.coefficients()) {
+					res += substitute(c, var, value);
+				}
 			}
 			CARL_LOG_TRACE("carl.core.uvpolynomial", p << " [ " << var << " -> " << value << " ] = " << res);
 			return res;
@@ -388,6 +397,15 @@ UnivariatePolynomial<Coeff> substitute(const UnivariatePolynomial<Coeff>& p, Var
 				MultivariatePolynomial<typename UnderlyingNumberType<Coeff>::type> tmp(p);
 				substitute_inplace(tmp, var, value);
 				return to_univariate_polynomial(tmp, p.main_var());
+			} else if (p.is_sparse()) {
+				std::vector<std::pair<uint, Coeff>> res;
+				res.reserve(p.sparse_coefficients().size());
+				for (const auto& c: p.sparse_coefficients()) {
+					res.emplace_back(c.first, substitute(c.second, var, value));
+				}
+				UnivariatePolynomial<Coeff> resp(p.main_var(), std::move(res));
+				CARL_LOG_TRACE("carl.core.uvpolynomial", p << " [ " << var << " -> " << value << " ] = " << resp);
+				return resp;
 			} else {
 				std::vector<Coeff> res(p.coefficients().size());
 				for (std::size_t i = 0; i < res.size(); i++) {
@@ -0,0 +1,199 @@
+/**
+ * @file HornerForm.h
+ *
+ * Cached Horner schemes that can be evaluated repeatedly without allocations.
+ */
+
+#pragma once
+
+#include "MultivariateHorner.h"
+
+#include <carl-common/memory/Singleton.h>
+
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#ifdef THREAD_SAFE
+#include <mutex>
+#endif
+
+namespace carl {
+
+/**
+ * A multivariate Horner scheme together with a flattened representation for repeated interval evaluation.
+ *
+ * Every node of the Horner scheme h = x^e * dependent + independent is stored in a vector, such that children precede their parents.
+ * Coefficients are converted to intervals once, hence evaluation only needs a workspace that can be reused across calls.
+ * Instances are usually obtained from the HornerPool, which shares them among all users of the same polynomial.
+ */
+template<typename Polynomial, typename Number = double, typename Strategy = strategy>
+class HornerForm {
+public:
+	using Horner = MultivariateHorner<Polynomial, Strategy>;
+	using Workspace = std::vector<Interval<Number>>;
+private:
+	static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+	struct Node {
+		/// Index of the variable in mVariables, NONE for constants.
+		std::size_t variable;
+		unsigned exponent;
+		/// Index of the dependent node, NONE if mDependent is used.
+		std::size_t dependent;
+		/// Index of the independent node, NONE if mIndependent is used.
+		std::size_t independent;
+		Interval<Number> dep_constant;
+		Interval<Number> indep_constant;
+	};
+
+	Horner mHorner;
+	std::vector<Variable> mVariables;
+	std::vector<Node> mNodes;
+
+	std::size_t variable_index(Variable v) {
+		auto it = std::find(mVariables.begin(), mVariables.end(), v);
+		if (it != mVariables.end()) return static_cast<std::size_t>(std::distance(mVariables.begin(), it));
+		mVariables.push_back(v);
+		return mVariables.size() - 1;
+	}
+	std::size_t flatten(const Horner& h) {
+		Node n{ NONE, h.getExponent(), NONE, NONE, Interval<Number>(h.getDepConstant()), Interval<Number>(h.getIndepConstant()) };
+		if (h.getVariable() != Variable::NO_VARIABLE) {
+			n.variable = variable_index(h.getVariable());
+			if (h.getDependent()) n.dependent = flatten(*h.getDependent());
+			if (h.getIndependent()) n.independent = flatten(*h.getIndependent());
+		}
+		mNodes.push_back(n);
+		return mNodes.size() - 1;
+	}
+
+	template<typename Value>
+	const Interval<Number>& run(Value&& value, Workspace& ws) const {
+		ws.resize(mNodes.size());
+		for (std::size_t i = 0; i < mNodes.size(); ++i) {
+			const auto& n = mNodes[i];
+			if (n.variable == NONE) {
+				ws[i] = n.indep_constant;
+				continue;
+			}
+			ws[i] = carl::pow(value(n.variable), n.exponent);
+			if (n.dependent != NONE) ws[i] *= ws[n.dependent];
+			else ws[i] *= n.dep_constant;
+			if (n.independent != NONE) ws[i] += ws[n.independent];
+			else ws[i] += n.indep_constant;
+		}
+		return ws.back();
+	}
+
+public:
+	explicit HornerForm(const Polynomial& p): mHorner(p) {
+		flatten(mHorner);
+	}
+
+	/// Returns the underlying Horner scheme.
+	const Horner& horner() const {
+		return mHorner;
+	}
+	/// Returns the variables in the order expected by evaluate(const Interval<Number>*, Workspace&).
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+
+	/**
+	 * Evaluates over the given intervals, where values[i] is the interval of variables()[i].
+	 * Does not allocate once the workspace has been used for this form.
+	 */
+	Interval<Number> evaluate(const Interval<Number>* values, Workspace& ws) const {
+		return run([values](std::size_t v) -> const Interval<Number>& { return values[v]; }, ws);
+	}
+	/**
+	 * Evaluates over the given map, which must contain all variables.
+	 * Does not allocate once the workspace has been used for this form.
+	 */
+	Interval<Number> evaluate(const std::map<Variable, Interval<Number>>& map, Workspace& ws) const {
+		return run([this, &map](std::size_t v) -> const Interval<Number>& {
+			assert(map.find(mVariables[v]) != map.end());
+			return map.find(mVariables[v])->second;
+		}, ws);
+	}
+	/// Evaluates over the given map using a temporary workspace.
+	Interval<Number> evaluate(const std::map<Variable, Interval<Number>>& map) const {
+		Workspace ws;
+		return evaluate(map, ws);
+	}
+};
+
+template<typename Polynomial, typename Number, typename Strategy>
+std::ostream& operator<<(std::ostream& os, const HornerForm<Polynomial, Number, Strategy>& h) {
+	return os << h.horner();
+}
+
+/**
+ * Hash-conses Horner forms, such that every polynomial is converted only once as long as some user holds its form.
+ * Access to the pool is thread-safe if THREAD_SAFE is defined.
+ */
+template<typename Polynomial, typename Number = double, typename Strategy = strategy>
+class HornerPool: public Singleton<HornerPool<Polynomial, Number, Strategy>> {
+	friend Singleton<HornerPool<Polynomial, Number, Strategy>>;
+public:
+	using Form = HornerForm<Polynomial, Number, Strategy>;
+private:
+	std::unordered_map<Polynomial, std::weak_ptr<const Form>> mForms;
+	/// Size of mForms after which expired entries are removed.
+	std::size_t mCleanupThreshold = 64;
+#ifdef THREAD_SAFE
+	mutable std::mutex mMutex;
+	#define HORNER_POOL_LOCK_GUARD std::lock_guard<std::mutex> lock(mMutex);
+#else
+	#define HORNER_POOL_LOCK_GUARD
+#endif
+
+	HornerPool() = default;
+
+	void cleanup() {
+		for (auto it = mForms.begin(); it != mForms.end();) {
+			if (it->second.expired()) it = mForms.erase(it);
+			else ++it;
+		}
+		mCleanupThreshold = std::max(std::size_t(64), 2 * mForms.size());
+	}
+
+public:
+	/**
+	 * Returns the Horner form of the given polynomial, constructing it if necessary.
+	 */
+	std::shared_ptr<const Form> get(const Polynomial& p) {
+		{
+			HORNER_POOL_LOCK_GUARD
+			auto it = mForms.find(p);
+			if (it != mForms.end()) {
+				if (auto res = it->second.lock()) return res;
+			}
+		}
+		// The construction is done without holding the lock.
+		auto form = std::make_shared<const Form>(p);
+		HORNER_POOL_LOCK_GUARD
+		auto& entry = mForms[p];
+		if (auto res = entry.lock()) return res;
+		entry = form;
+		if (mForms.size() > mCleanupThreshold) cleanup();
+		return form;
+	}
+
+	/// Returns the number of entries, including expired ones.
+	std::size_t size() const {
+		HORNER_POOL_LOCK_GUARD
+		return mForms.size();
+	}
+	#undef HORNER_POOL_LOCK_GUARD
+};
+
+/**
+ * Returns the shared Horner form of the given polynomial.
+ */
+template<typename Number = double, typename Strategy = strategy, typename Polynomial>
+std::shared_ptr<const HornerForm<Polynomial, Number, Strategy>> horner_form(const Polynomial& p) {
+	return HornerPool<Polynomial, Number, Strategy>::getInstance().get(p);
+}
+
+}
@@ -17,8 +17,6 @@
 
 namespace carl{
 
-static std::map<Variable, Interval<double>> mMap = {{ Variable::NO_VARIABLE , Interval<double>(0)}};
-
 template<typename PolynomialType, class strategy >
 class MultivariateHorner : public std::enable_shared_from_this<MultivariateHorner<PolynomialType, strategy >> { 
 
@@ -35,24 +35,22 @@ namespace carl
 
 	//static_assert(!(strategy::variableSelectionHeurisics == variableSelectionHeurisics::GREEDY_II)&&!(strategy::variableSelectionHeurisics == variableSelectionHeurisics::GREEDY_IIs), "Strategy requires Interval map");
 
+	// The default intervals used by GREEDY_II/IIs. This map is local to avoid shared mutable state between concurrent constructions.
+	std::map<Variable, Interval<double>> map = {{ Variable::NO_VARIABLE , Interval<double>(0)}};
 	if (strategy::selectionType == variableSelectionHeurisics::GREEDY_II || strategy::selectionType == variableSelectionHeurisics::GREEDY_IIs){
 		auto allVariablesinPolynome = carl::variables(inPut);
 		carl::carlVariables::iterator variableIt;
 
 		for (variableIt = allVariablesinPolynome.begin(); variableIt != allVariablesinPolynome.end(); variableIt++)
 		{
-			typename std::map<Variable, Interval<double>>::const_iterator const_iterator_map = mMap.find(*variableIt);
-			if ( const_iterator_map == mMap.end() )
-			{
-				const_iterator_map = mMap.emplace(*variableIt, Interval<double>((-1) * strategy::targetDiameter, strategy::targetDiameter)).first;
-			}
+			map.emplace(*variableIt, Interval<double>((-1) * strategy::targetDiameter, strategy::targetDiameter));
 		}
 	}
 
 	int arithmeticOperationsReductionCounter = 0;
 
 	//Create Horner Scheme Recursivly
-	MultivariateHorner< PolynomialType, strategy > root ( std::move(inPut), mMap, arithmeticOperationsReductionCounter );
+	MultivariateHorner< PolynomialType, strategy > root ( std::move(inPut), map, arithmeticOperationsReductionCounter );
 
  	//Part after recursion
  	if (strategy::selectionType == variableSelectionHeurisics::GREEDY_Is || strategy::selectionType == variableSelectionHeurisics::GREEDY_IIs)
@@ -4,6 +4,8 @@
 #include "../UnivariatePolynomial.h"
 #include <carl-arith/core/Variables.h>
 
+#include <map>
+
 namespace carl {
 
 /**
@@ -18,10 +20,11 @@ UnivariatePolynomial<C> to_univariate_polynomial(const MultivariatePolynomial<C,
 	// Only correct when it is already only in one variable.
 	assert(variables(p).size() == 1);
 	Variable::Arg x = p.lmon()->single_variable();
-	std::vector<C> coeffs(p.total_degree()+1,0);
+	// Collect the coefficients by exponent, such that sparse polynomials are not expanded.
+	std::map<uint, C> coeffs;
 	for (const auto& t : p)
 	{
-		coeffs[t.tdeg()] = t.coeff();
+		coeffs.emplace(t.tdeg(), t.coeff());
 	}
 	return UnivariatePolynomial<C>(x, coeffs);
 }
@@ -34,15 +37,13 @@ UnivariatePolynomial<C> to_univariate_polynomial(const MultivariatePolynomial<C,
 template<typename C, typename O, typename P>
 UnivariatePolynomial<MultivariatePolynomial<C,O,P>> to_univariate_polynomial(const MultivariatePolynomial<C,O,P>& p, Variable v) {
 	assert(p.is_consistent());
-	std::vector<MultivariatePolynomial<C,O,P>> coeffs(1);
+	// Collect the coefficients by exponent, such that sparse polynomials are not expanded.
+	std::map<uint, MultivariatePolynomial<C,O,P>> coeffs;
 	for (const auto& term: p) {
 		if (term.monomial() == nullptr) coeffs[0] += term;
 		else {
 			const auto& mon = term.monomial();
 			auto exponent = mon->exponent_of_variable(v);
-			if (exponent >= coeffs.size()) {
-				coeffs.resize(exponent + 1);
-			}
 			std::shared_ptr<const carl::Monomial> tmp = mon->drop_variable(v);
 			coeffs[exponent] += term.coeff() * tmp;
 		}
@@ -5,6 +5,7 @@
 #include "helper/internal.h"
 #include <carl-arith/interval/Interval.h>
 #include <carl-logging/carl-logging.h>
+#include <carl-statistics/carl-statistics.h>
 #include <carl-arith/core/Sign.h>
 #include <carl-arith/poly/umvpoly/UnivariatePolynomial.h>
 
@@ -30,6 +31,7 @@ RealRootsResult<IntRepRealAlgebraicNumber<Number>> real_roots(
 		return RealRootsResult<IntRepRealAlgebraicNumber<Number>>::nullified_response();
 	}
 	CARL_LOG_DEBUG("carl.ran.interval", polynomial << " within " << interval);
+	CARL_TRACE_SPAN("carl.ran", "real_roots");
 	carl::ran::interval::RealRootIsolation rri(polynomial, interval);
 	auto r = rri.get_roots();
 	CARL_LOG_DEBUG("carl.ran.interval", "-> " << r);
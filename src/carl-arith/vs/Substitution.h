@@ -2,6 +2,8 @@
 
 #include "SqrtEx.h"
 
+#include <vector>
+
 namespace carl {
 
 template<typename Poly>
@@ -23,15 +25,75 @@ SqrtEx<Poly> substitute( const SqrtEx<Poly>& sqrt_ex, const std::map<Variable, t
     return SqrtEx( std::move(constantPartEvaluated), std::move(factorEvaluated), std::move(denomEvaluated), std::move(radicandEvaluated) );
 }
 
+/**
+ * Caches the powers of a square root expression (q + r*sqrt(t))/s, such that substituting it into several polynomials computes every power only once.
+ * Powers are computed on demand up to the largest degree requested so far.
+ */
+template<typename Poly>
+class SqrtExPowers {
+private:
+    SqrtEx<Poly> m_sqrt_ex;
+    /// The powers s^k of the denominator, starting with k = 0.
+    std::vector<Poly> m_denominators;
+    /// The constant parts q_k of (q + r*sqrt(t))^k = q_k + r_k*sqrt(t), starting with k = 1.
+    std::vector<Poly> m_constant_parts;
+    /// The factors r_k of (q + r*sqrt(t))^k = q_k + r_k*sqrt(t), starting with k = 1.
+    std::vector<Poly> m_factors;
+
+public:
+    explicit SqrtExPowers(const SqrtEx<Poly>& sqrt_ex):
+        m_sqrt_ex(sqrt_ex),
+        m_denominators({ constant_one<Poly>::get() }),
+        m_constant_parts({ sqrt_ex.constant_part() }),
+        m_factors({ sqrt_ex.factor() })
+    {}
+
+    const SqrtEx<Poly>& sqrt_ex() const {
+        return m_sqrt_ex;
+    }
+
+    /// Makes sure that all powers up to the given degree are available.
+    void reserve(carl::uint degree) {
+        while (m_denominators.size() <= degree) {
+            // s^i = s^{i-1} * s
+            m_denominators.push_back(m_denominators.back() * m_sqrt_ex.denominator());
+        }
+        // Let (q+r*sqrt{t})^l be (q'+r'*sqrt{t})
+        // then (q+r*sqrt{t})^l+1  =  (q'+r'*sqrt{t}) * (q+r*sqrt{t})  =  ( q'*q+r'*r't  +  (q'*r+r'*q) * sqrt{t} )
+        while (m_constant_parts.size() < degree) {
+            const Poly& q = m_constant_parts.back();
+            const Poly& r = m_factors.back();
+            Poly next_q = q * m_sqrt_ex.constant_part() + r * m_sqrt_ex.factor() * m_sqrt_ex.radicand();
+            Poly next_r = r * m_sqrt_ex.constant_part() + q * m_sqrt_ex.factor();
+            m_constant_parts.push_back(std::move(next_q));
+            m_factors.push_back(std::move(next_r));
+        }
+    }
+
+    /// Returns s^k, requires reserve(k).
+    const Poly& denominator(carl::uint k) const {
+        return m_denominators.at(k);
+    }
+    /// Returns q_k of (q + r*sqrt(t))^k = q_k + r_k*sqrt(t) for k >= 1, requires reserve(k).
+    const Poly& constant_part(carl::uint k) const {
+        return m_constant_parts.at(k - 1);
+    }
+    /// Returns r_k of (q + r*sqrt(t))^k = q_k + r_k*sqrt(t) for k >= 1, requires reserve(k).
+    const Poly& factor(carl::uint k) const {
+        return m_factors.at(k - 1);
+    }
+};
+
 /**
  * Substitutes a variable in an expression by a square root expression, which results in a square root expression.
+ * The required powers of the square root expression are taken from, or added to, the given cache.
  * @param _substituteIn The polynomial to substitute in.
  * @param _varToSubstitute The variable to substitute.
- * @param _substituteBy The square root expression by which the variable gets substituted.
+ * @param _powers The powers of the square root expression by which the variable gets substituted.
  * @return The resulting square root expression.
  */
 template<typename Poly>
-SqrtEx<Poly> substitute( const Poly& _substituteIn, const carl::Variable _varToSubstitute, const SqrtEx<Poly>& _substituteBy )
+SqrtEx<Poly> substitute( const Poly& _substituteIn, const carl::Variable _varToSubstitute, SqrtExPowers<Poly>& _powers )
 {
     if( !_substituteIn.has( _varToSubstitute ) )
         return SqrtEx<Poly>( _substituteIn );
@@ -49,44 +111,40 @@ SqrtEx<Poly> substitute( const Poly& _substituteIn, const carl::Variable _varToS
         */
     auto varInfo = carl::var_info(_substituteIn, _varToSubstitute, true);
     const auto& coeffs = varInfo.coeffs();
-    // Calculate the s^k:   (0<=k<=n)
     auto coeff = coeffs.begin();
     carl::uint lastDegree = varInfo.max_degree();
-    std::vector<Poly> sk;
-    sk.push_back(constant_one<Poly>::get());
-    for( carl::uint i = 1; i <= lastDegree; ++i )
-    {
-        // s^i = s^l * s^{i-l}
-        sk.push_back( sk.back() * _substituteBy.denominator() );
-    }
-    // Calculate the constant part and factor of the square root of (q+r*sqrt{t})^k 
-    std::vector<Poly> qk;
-    qk.push_back( _substituteBy.constant_part() );
-    std::vector<Poly> rk;
-    rk.push_back( _substituteBy.factor() );
-    // Let (q+r*sqrt{t})^l be (q'+r'*sqrt{t}) 
-    // then (q+r*sqrt{t})^l+1  =  (q'+r'*sqrt{t}) * (q+r*sqrt{t})  =  ( q'*q+r'*r't  +  (q'*r+r'*q) * sqrt{t} )
-    for( carl::uint i = 1; i < lastDegree; ++i )
-    {
-        // q'*q+r'*r't
-        qk.push_back( qk.back() * _substituteBy.constant_part() + rk.back() * _substituteBy.factor() * _substituteBy.radicand() );
-        // q'*r+r'*q
-        rk.push_back( rk.back() * _substituteBy.constant_part()  + qk.at( i - 1 ) * _substituteBy.factor() );
-    }
+    _powers.reserve( lastDegree );
     // Calculate the result:
     Poly resFactor = constant_zero<Poly>::get();
     Poly resConstantPart = constant_zero<Poly>::get();
     if( coeff->first == 0 )
     {
-        resConstantPart += sk.back() * coeff->second;
+        resConstantPart += _powers.denominator( lastDegree ) * coeff->second;
         ++coeff;
     }
     for( ; coeff != coeffs.end(); ++coeff )
     {
-        resConstantPart += coeff->second * qk.at( coeff->first - 1 ) * sk.at( lastDegree - coeff->first );
-        resFactor       += coeff->second * rk.at( coeff->first - 1 ) * sk.at( lastDegree - coeff->first );
+        const Poly& sk = _powers.denominator( lastDegree - coeff->first );
+        resConstantPart += coeff->second * _powers.constant_part( coeff->first ) * sk;
+        resFactor       += coeff->second * _powers.factor( coeff->first ) * sk;
     }
-    return SqrtEx( resConstantPart, resFactor, sk.back(), _substituteBy.radicand() );
+    return SqrtEx( resConstantPart, resFactor, _powers.denominator( lastDegree ), _powers.sqrt_ex().radicand() );
+}
+
+/**
+ * Substitutes a variable in an expression by a square root expression, which results in a square root expression.
+ * @param _substituteIn The polynomial to substitute in.
+ * @param _varToSubstitute The variable to substitute.
+ * @param _substituteBy The square root expression by which the variable gets substituted.
+ * @return The resulting square root expression.
+ */
+template<typename Poly>
+SqrtEx<Poly> substitute( const Poly& _substituteIn, const carl::Variable _varToSubstitute, const SqrtEx<Poly>& _substituteBy )
+{
+    if( !_substituteIn.has( _varToSubstitute ) )
+        return SqrtEx<Poly>( _substituteIn );
+    SqrtExPowers<Poly> powers( _substituteBy );
+    return substitute( _substituteIn, _varToSubstitute, powers );
 }
 
 }
\ No newline at end of file
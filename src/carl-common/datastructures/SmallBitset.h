@@ -0,0 +1,389 @@
+#pragma once
+
+#include "../util/hash.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <vector>
+
+namespace carl {
+
+	/**
+	 * A bitset with the same interface as Bitset that stores up to InlineBits bits without any heap allocation.
+	 * Larger bitsets transparently move their data to the heap.
+	 *
+	 * Like Bitset, a SmallBitset represents an infinite bitset that starts with the explicitly stored bits extended by mDefault.
+	 * All operations work on whole 64 bit blocks in plain loops that the compiler vectorizes, counting uses popcount and iteration skips zero blocks.
+	 * Bits beyond size() are always zero in the storage.
+	 */
+	template<std::size_t InlineBits = 256>
+	class SmallBitset {
+	public:
+		friend struct std::hash<carl::SmallBitset<InlineBits>>;
+
+		/// Underlying storage type.
+		using Block = std::uint64_t;
+		/// Sentinel element for iteration.
+		static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+		/// Number of bits in each storage block.
+		static constexpr std::size_t bits_per_block = std::numeric_limits<Block>::digits;
+		/// Number of blocks stored inline.
+		static constexpr std::size_t inline_blocks = (InlineBits + bits_per_block - 1) / bits_per_block;
+
+		/**
+		 * Iterator over all bits of a SmallBitset that are set to true.
+		 * The remaining bits of the current block are cached, such that every step only scans for the next bit in this block.
+		 */
+		struct iterator {
+		private:
+			/// The SmallBitset iterated over.
+			const SmallBitset* mBitset;
+			/// The current bit.
+			std::size_t mBit;
+			/// The bits after mBit in the current block.
+			Block mRemaining;
+
+			/// Check that two iterators speak about the same SmallBitset.
+			bool compatible(const iterator& rhs) const {
+				return mBitset == rhs.mBitset;
+			}
+			/// Moves to the first bit set in mRemaining or in the blocks starting with the given one.
+			void advance(std::size_t block) {
+				const Block* data = mBitset->blocks();
+				std::size_t num = mBitset->num_blocks();
+				while (mRemaining == 0) {
+					if (block >= num) {
+						mBit = npos;
+						return;
+					}
+					mRemaining = data[block++];
+				}
+				mBit = (block - 1) * bits_per_block + static_cast<std::size_t>(std::countr_zero(mRemaining));
+				mRemaining &= mRemaining - 1;
+			}
+		public:
+			/// Construct a new iterator pointing to the first bit set at or after the given bit.
+			iterator(const SmallBitset& b, std::size_t bit): mBitset(&b), mBit(npos), mRemaining(0) {
+				if (bit >= b.size()) return;
+				std::size_t block = bit / bits_per_block;
+				mRemaining = b.blocks()[block] & (~Block(0) << (bit % bits_per_block));
+				advance(block + 1);
+			}
+
+			/// Retrieve the index into the SmallBitset.
+			operator std::size_t() const {
+				return mBit;
+			}
+			/// Retrieve the index into the SmallBitset.
+			std::size_t operator*() const {
+				return mBit;
+			}
+			/// Step to the next bit that is set to true.
+			iterator& operator++() {
+				std::size_t block = mBit / bits_per_block;
+				if (mRemaining != 0) {
+					mBit = block * bits_per_block + static_cast<std::size_t>(std::countr_zero(mRemaining));
+					mRemaining &= mRemaining - 1;
+				} else {
+					advance(block + 1);
+				}
+				return *this;
+			}
+			/// Step to the next bit that is set to true.
+			iterator operator++(int) {
+				iterator res(*this);
+				++(*this);
+				return res;
+			}
+			/// Compare two iterators. Asserts that they are compatible.
+			bool operator==(const iterator& rhs) const {
+				assert(compatible(rhs));
+				return mBit == rhs.mBit;
+			}
+			/// Compare two iterators. Asserts that they are compatible.
+			bool operator!=(const iterator& rhs) const {
+				assert(compatible(rhs));
+				return !(*this == rhs);
+			}
+			/// Compare two iterators. Asserts that they are compatible.
+			bool operator<(const iterator& rhs) const {
+				assert(compatible(rhs));
+				return mBit < rhs.mBit;
+			}
+		};
+
+	private:
+		/// The number of explicitly stored bits.
+		mutable std::size_t mSize = 0;
+		/// The blocks, if there are at most inline_blocks of them.
+		mutable std::array<Block, inline_blocks> mInline = {};
+		/// The blocks, if there are more than inline_blocks of them.
+		mutable std::vector<Block> mHeap;
+		/// The default value for bits beyond mSize.
+		bool mDefault;
+
+		static std::size_t blocks_for(std::size_t bits) {
+			return (bits + bits_per_block - 1) / bits_per_block;
+		}
+		/// Returns the storage.
+		Block* blocks() const {
+			return num_blocks() > inline_blocks ? mHeap.data() : mInline.data();
+		}
+		/// Sets the bits in [start, end) to the given value.
+		void fill(std::size_t start, std::size_t end, bool value) const {
+			Block* data = blocks();
+			for (; start < end && start % bits_per_block != 0; ++start) {
+				write(data, start, value);
+			}
+			Block b = value ? ~Block(0) : Block(0);
+			for (; start + bits_per_block <= end; start += bits_per_block) {
+				data[start / bits_per_block] = b;
+			}
+			for (; start < end; ++start) {
+				write(data, start, value);
+			}
+		}
+		static void write(Block* data, std::size_t n, bool value) {
+			Block mask = Block(1) << (n % bits_per_block);
+			if (value) data[n / bits_per_block] |= mask;
+			else data[n / bits_per_block] &= ~mask;
+		}
+		/// Resize to hold at least pos bits.
+		void ensureSize(std::size_t pos) {
+			if (pos >= mSize) {
+				resize(pos+1);
+			}
+		}
+	public:
+		/// Create an empty bitset.
+		explicit SmallBitset(bool defaultValue = false): mDefault(defaultValue) {}
+		/// Create a bitset from a list of bits indices that shall be set to true.
+		SmallBitset(const std::initializer_list<std::size_t>& bits, bool defaultValue = false): mDefault(defaultValue) {
+			for (auto b: bits) {
+				set(b);
+			}
+		}
+
+		/// Resize the SmallBitset to hold exactly num_bits bits. New bits are set to the given value.
+		void resize(std::size_t num_bits, bool value) const {
+			std::size_t old_size = mSize;
+			if (num_bits < old_size) {
+				fill(num_bits, old_size, false);
+			}
+			std::size_t old_blocks = blocks_for(old_size);
+			std::size_t new_blocks = blocks_for(num_bits);
+			if (new_blocks > inline_blocks) {
+				if (old_blocks <= inline_blocks) {
+					mHeap.assign(mInline.begin(), mInline.end());
+					mInline.fill(0);
+				}
+				mHeap.resize(new_blocks, 0);
+			} else if (old_blocks > inline_blocks) {
+				std::copy(mHeap.begin(), mHeap.begin() + static_cast<std::ptrdiff_t>(new_blocks), mInline.begin());
+				mHeap = std::vector<Block>();
+			}
+			mSize = num_bits;
+			if (num_bits > old_size && value) {
+				fill(old_size, num_bits, true);
+			}
+		}
+		/// Resize the SmallBitset to hold exactly num_bits bits. New bits are set to mDefault.
+		void resize(std::size_t num_bits) const {
+			resize(num_bits, mDefault);
+		}
+
+		/// Sets all bits to false that are true in rhs.
+		SmallBitset& operator-=(const SmallBitset& rhs) {
+			assert(mDefault == rhs.mDefault);
+			alignSize(*this, rhs);
+			Block* l = blocks();
+			const Block* r = rhs.blocks();
+			for (std::size_t i = 0; i < num_blocks(); ++i) l[i] &= ~r[i];
+			return *this;
+		}
+		/// Computes the bitwise and with rhs.
+		SmallBitset& operator&=(const SmallBitset& rhs) {
+			alignSize(*this, rhs);
+			Block* l = blocks();
+			const Block* r = rhs.blocks();
+			for (std::size_t i = 0; i < num_blocks(); ++i) l[i] &= r[i];
+			mDefault = mDefault && rhs.mDefault;
+			return *this;
+		}
+		/// Computes the bitwise or with rhs.
+		SmallBitset& operator|=(const SmallBitset& rhs) {
+			alignSize(*this, rhs);
+			Block* l = blocks();
+			const Block* r = rhs.blocks();
+			for (std::size_t i = 0; i < num_blocks(); ++i) l[i] |= r[i];
+			mDefault = mDefault || rhs.mDefault;
+			return *this;
+		}
+
+		/// Sets the given bit to a value, true by default.
+		SmallBitset& set(std::size_t n, bool value = true) {
+			ensureSize(n);
+			write(blocks(), n, value);
+			return *this;
+		}
+		/// Sets the a range of bits to a value, true by default.
+		SmallBitset& set_interval(std::size_t start, std::size_t end, bool value = true) {
+			ensureSize(end);
+			fill(start, end + 1, value);
+			return *this;
+		}
+		/// Resets a bit to false.
+		SmallBitset& reset(std::size_t n) {
+			return set(n, false);
+		}
+		/// Retrieves the value of the given bit.
+		bool test(std::size_t n) const {
+			if (n >= mSize) {
+				return mDefault;
+			}
+			return (blocks()[n / bits_per_block] >> (n % bits_per_block)) & 1;
+		}
+		/// Checks if any bits are set to true. Asserts that mDefault is false.
+		bool any() const {
+			assert(!mDefault);
+			const Block* data = blocks();
+			for (std::size_t i = 0; i < num_blocks(); ++i) {
+				if (data[i] != 0) return true;
+			}
+			return false;
+		}
+		/// Checks if no bits are set to true. Asserts that mDefault is false.
+		bool none() const {
+			return !any();
+		}
+
+		/// Counts the number of bits that are set to true. Asserts that mDefault is false.
+		std::size_t count() const noexcept {
+			assert(!mDefault);
+			const Block* data = blocks();
+			std::size_t res = 0;
+			for (std::size_t i = 0; i < num_blocks(); ++i) {
+				res += static_cast<std::size_t>(std::popcount(data[i]));
+			}
+			return res;
+		}
+
+		/// Retrieves the number of explicitly stored bits.
+		std::size_t size() const {
+			return mSize;
+		}
+		/// Retrieves the number of blocks used to store the explicit bits.
+		std::size_t num_blocks() const {
+			return blocks_for(mSize);
+		}
+		/// Checks wether the bits set is a subset of the bits set in rhs.
+		bool is_subset_of(const SmallBitset& rhs) const {
+			if (mDefault && !rhs.mDefault) {
+				return false;
+			}
+			alignSize(*this, rhs);
+			const Block* l = blocks();
+			const Block* r = rhs.blocks();
+			Block diff = 0;
+			for (std::size_t i = 0; i < num_blocks(); ++i) diff |= l[i] & ~r[i];
+			return diff == 0;
+		}
+		/// Retrieves the index of the first bit that is set to true.
+		std::size_t find_first() const {
+			return *begin();
+		}
+		/// Retrieves the index of the first bit set to true after the given position.
+		std::size_t find_next(std::size_t pos) const {
+			if (pos == npos) return npos;
+			return *iterator(*this, pos + 1);
+		}
+		/// Returns an iterator to the first bit that is set to true.
+		iterator begin() const {
+			return iterator(*this, 0);
+		}
+		/// Returns an past-the-end iterator.
+		iterator end() const {
+			return iterator(*this, npos);
+		}
+
+		/// Ensures that the explicitly stored bits of lhs and rhs have the same size.
+		friend void alignSize(const SmallBitset& lhs, const SmallBitset& rhs) {
+			if (lhs.size() < rhs.size()) {
+				lhs.resize(rhs.size());
+			} else if (lhs.size() > rhs.size()) {
+				rhs.resize(lhs.size());
+			}
+		}
+
+		/// Compares lhs and rhs.
+		friend bool operator==(const SmallBitset& lhs, const SmallBitset& rhs) {
+			alignSize(lhs, rhs);
+			return lhs.mDefault == rhs.mDefault && std::equal(lhs.blocks(), lhs.blocks() + lhs.num_blocks(), rhs.blocks());
+		}
+		/// Compares lhs and rhs according to some order.
+		friend bool operator<(const SmallBitset& lhs, const SmallBitset& rhs) {
+			if (lhs.size() < rhs.size()) {
+				return true;
+			}
+			if (lhs.size() > rhs.size()) {
+				return false;
+			}
+			const Block* l = lhs.blocks();
+			const Block* r = rhs.blocks();
+			for (std::size_t i = lhs.num_blocks(); i > 0; --i) {
+				if (l[i-1] != r[i-1]) return l[i-1] < r[i-1];
+			}
+			return false;
+		}
+
+		/// Returns the bitwise negation of lhs.
+		friend SmallBitset operator~(const SmallBitset& lhs) {
+			SmallBitset res(lhs);
+			res.mDefault = !lhs.mDefault;
+			Block* data = res.blocks();
+			for (std::size_t i = 0; i < res.num_blocks(); ++i) data[i] = ~data[i];
+			if (res.mSize % bits_per_block != 0) {
+				data[res.num_blocks() - 1] &= ~Block(0) >> (bits_per_block - res.mSize % bits_per_block);
+			}
+			return res;
+		}
+		/// Returns the bitwise `and` of lhs and rhs.
+		friend SmallBitset operator&(const SmallBitset& lhs, const SmallBitset& rhs) {
+			SmallBitset res(lhs);
+			return res &= rhs;
+		}
+		/// Returns the bitwise `or` of lhs and rhs.
+		friend SmallBitset operator|(const SmallBitset& lhs, const SmallBitset& rhs) {
+			SmallBitset res(lhs);
+			return res |= rhs;
+		}
+
+		/// Outputs `b` to `os` using the format `<explicit bits>[<default>]`.
+		friend std::ostream& operator<<(std::ostream& os, const SmallBitset& b) {
+			for (std::size_t i = b.size(); i > 0; --i) {
+				os << (b.test(i-1) ? '1' : '0');
+			}
+			return os << '|' << b.mDefault;
+		}
+	};
+}
+
+namespace std {
+
+template<std::size_t InlineBits>
+struct hash<carl::SmallBitset<InlineBits>> {
+	std::size_t operator()(const carl::SmallBitset<InlineBits>& bs) const {
+		std::size_t seed = bs.size();
+		for (std::size_t i = 0; i < bs.num_blocks(); ++i) {
+			carl::hash_add(seed, static_cast<std::size_t>(bs.blocks()[i]));
+		}
+		return seed;
+	}
+};
+
+}
@@ -0,0 +1,80 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+namespace carl {
+
+void ThreadPool::Loop::work() {
+	std::size_t count = 0;
+	for (std::size_t i = next++; i < tasks; i = next++) {
+		++count;
+		if (failed) continue;
+		try {
+			task(i);
+		} catch (...) {
+			std::lock_guard<std::mutex> lock(mutex);
+			if (!error) error = std::current_exception();
+			failed = true;
+		}
+	}
+	if (count == 0) return;
+	std::lock_guard<std::mutex> lock(mutex);
+	done += count;
+	if (done == tasks) finished.notify_all();
+}
+
+void ThreadPool::worker() {
+	while (true) {
+		std::shared_ptr<Loop> loop;
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mWakeup.wait(lock, [this]() { return mStop || !mQueue.empty(); });
+			if (mStop) return;
+			loop = std::move(mQueue.front());
+			mQueue.pop_front();
+		}
+		loop->work();
+	}
+}
+
+void ThreadPool::run_loop(std::size_t tasks, std::size_t num_threads, std::function<void(std::size_t)>&& task) {
+	auto loop = std::make_shared<Loop>();
+	loop->task = std::move(task);
+	loop->tasks = tasks;
+	std::size_t helpers = std::min(num_threads, tasks) - 1;
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		while (mThreads.size() < helpers) {
+			mThreads.emplace_back([this]() { worker(); });
+		}
+		// Helpers that take the loop after it has finished return immediately.
+		for (std::size_t i = 0; i < helpers; ++i) {
+			mQueue.push_back(loop);
+		}
+	}
+	mWakeup.notify_all();
+	loop->work();
+	std::unique_lock<std::mutex> lock(loop->mutex);
+	loop->finished.wait(lock, [&loop]() { return loop->done == loop->tasks; });
+	if (loop->error) std::rethrow_exception(loop->error);
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStop = true;
+	}
+	mWakeup.notify_all();
+	for (auto& t: mThreads) t.join();
+}
+
+std::size_t ThreadPool::hardware_threads() {
+	return std::max(1u, std::thread::hardware_concurrency());
+}
+
+std::size_t ThreadPool::size() {
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mThreads.size();
+}
+
+}
@@ -0,0 +1,96 @@
+/**
+ * @file ThreadPool.h
+ *
+ * A pool of persistent worker threads for parallel loops.
+ */
+
+#pragma once
+
+#include "../memory/Singleton.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace carl {
+
+/**
+ * A pool of worker threads that executes parallel loops.
+ *
+ * The workers are started lazily and kept until the program terminates, hence repeated parallel loops do not pay for starting threads.
+ * The calling thread always takes part in its own loop, such that loops may be nested and finish even if all workers are busy.
+ * If a task throws, the remaining tasks of the loop are skipped and the first exception is rethrown in the calling thread.
+ *
+ * The pool does not make the tasks thread-safe.
+ * In particular, the pools for variables, monomials and polynomials are only synchronized if THREAD_SAFE is defined,
+ * hence tasks that create such objects must only be run on more than one thread in this case.
+ */
+class ThreadPool: public Singleton<ThreadPool> {
+	friend Singleton<ThreadPool>;
+private:
+	/// A single parallel loop, shared by all threads working on it.
+	struct Loop {
+		std::function<void(std::size_t)> task;
+		std::size_t tasks = 0;
+		/// The next task that was not taken yet.
+		std::atomic<std::size_t> next{0};
+		/// Set if some task has thrown, the remaining tasks are skipped.
+		std::atomic<bool> failed{false};
+		std::mutex mutex;
+		std::condition_variable finished;
+		/// The number of tasks that were executed or skipped, protected by mutex.
+		std::size_t done = 0;
+		/// The first exception thrown by a task, protected by mutex.
+		std::exception_ptr error;
+
+		/// Executes tasks until all of them are taken.
+		void work();
+	};
+
+	std::vector<std::thread> mThreads;
+	std::deque<std::shared_ptr<Loop>> mQueue;
+	std::mutex mMutex;
+	std::condition_variable mWakeup;
+	bool mStop = false;
+
+	ThreadPool() = default;
+
+	void worker();
+	void run_loop(std::size_t tasks, std::size_t num_threads, std::function<void(std::size_t)>&& task);
+
+public:
+	~ThreadPool() override;
+
+	/// Returns the number of hardware threads, but at least one.
+	static std::size_t hardware_threads();
+
+	/// Returns the number of worker threads that have been started, the calling thread is not included.
+	std::size_t size();
+
+	/**
+	 * Runs task(i) for all i < tasks on at most num_threads threads, including the calling thread.
+	 * Returns once all tasks are finished.
+	 * @param tasks Number of tasks.
+	 * @param num_threads Maximal number of threads, hardware_threads() if zero.
+	 * @param task Function that is called for every task.
+	 */
+	template<typename Task>
+	void run(std::size_t tasks, std::size_t num_threads, Task&& task) {
+		if (num_threads == 0) num_threads = hardware_threads();
+		if (num_threads <= 1 || tasks <= 1) {
+			for (std::size_t i = 0; i < tasks; ++i) task(i);
+			return;
+		}
+		// The loop returns only after all tasks are finished, hence the task may be referenced.
+		run_loop(tasks, num_threads, [&task](std::size_t i) { task(i); });
+	}
+};
+
+}
@@ -7,18 +7,61 @@
 
 namespace carl::covering {
 
-void SetCover::set(std::size_t set, std::size_t element) {
+void SetCover::add_set(std::size_t set) {
 	while (set >= mSets.size()) {
+		if (mOrdered) mBySize.emplace(0, mSets.size());
 		mSets.emplace_back();
+		mSizes.emplace_back(0);
+	}
+}
+
+void SetCover::resize_set(std::size_t set, std::size_t size) {
+	std::size_t old = mSizes[set];
+	if (old == size) return;
+	if (mOrdered) {
+		mBySize.erase(std::make_pair(old, set));
+		mBySize.emplace(size, set);
+	}
+	mSizes[set] = size;
+	if (old == 0) ++mActiveSets;
+	else if (size == 0) --mActiveSets;
+}
+
+void SetCover::order_sets() const {
+	if (mOrdered) return;
+	mBySize.clear();
+	for (std::size_t id = 0; id < mSizes.size(); ++id) {
+		mBySize.emplace_hint(mBySize.end(), mSizes[id], id);
 	}
+	mOrdered = true;
+}
+
+void SetCover::set(std::size_t set, std::size_t element) {
+	add_set(set);
+	if (mSets[set].test(element)) return;
 	mSets[set].set(element);
+	if (element >= mElements.size()) {
+		mElements.resize(element + 1);
+	}
+	mElements[element].push_back(set);
+	resize_set(set, mSizes[set] + 1);
 }
 
 void SetCover::set(std::size_t set, const Bitset& elements) {
-	while (set >= mSets.size()) {
-		mSets.emplace_back();
+	add_set(set);
+	for (auto e: elements) {
+		this->set(set, e);
 	}
-	mSets[set] |= elements;
+	// Keep the size of the given bitset, as it determines the number of elements.
+	if (mSets[set].size() < elements.size()) {
+		mSets[set].resize(elements.size());
+	}
+}
+
+const std::vector<std::size_t>& SetCover::covering_sets(std::size_t element) const {
+	static const std::vector<std::size_t> empty;
+	if (element >= mElements.size()) return empty;
+	return mElements[element];
 }
 
 std::size_t SetCover::element_count() const {
@@ -42,31 +85,21 @@ std::size_t SetCover::set_count() const {
 }
 
 std::size_t SetCover::active_set_count() const {
-	return static_cast<std::size_t>(std::count_if(mSets.begin(), mSets.end(),
-		[](const auto& d){ return d.any(); }
-	));
+	return mActiveSets;
 }
 
 std::size_t SetCover::largest_set() const {
 	assert(mSets.size() > 0);
-	std::size_t largest_id = 0;
-	std::size_t largest_size = mSets[0].count();
-	for (std::size_t id = 1; id < mSets.size(); ++id) {
-		std::size_t size = mSets[id].count();
-		if (size > largest_size) {
-			largest_id = id;
-			largest_size = size;
-		}
-	}
-	return largest_id;
+	order_sets();
+	return mBySize.begin()->second;
 }
 
 std::size_t SetCover::largest_set(const std::vector<double>& weights) const {
 	assert(mSets.size() > 0);
 	std::size_t largest_id = 0;
-	double largest_size = mSets[0].count() * weights[0];
+	double largest_size = static_cast<double>(mSizes[0]) * weights[0];
 	for (std::size_t id = 1; id < mSets.size(); ++id) {
-		double size = mSets[id].count() * weights[id];
+		double size = static_cast<double>(mSizes[id]) * weights[id];
 		if (size > largest_size) {
 			largest_id = id;
 			largest_size = size;
@@ -86,8 +119,12 @@ Bitset SetCover::get_uncovered() const {
 void SetCover::select_set(std::size_t s) {
 	assert(mSets.size() > s);
 	auto selected = mSets[s];
-	for (auto& d: mSets){
-		d -= selected;
+	for (auto e: selected) {
+		for (auto t: mElements[e]) {
+			mSets[t].set(e, false);
+			resize_set(t, mSizes[t] - 1);
+		}
+		mElements[e].clear();
 	}
 }
 
@@ -101,4 +138,4 @@ std::ostream& operator<<(std::ostream& os, const SetCover& sc) {
 	return os;
 }
 
-}
\ No newline at end of file
+}
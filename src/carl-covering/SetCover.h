@@ -4,6 +4,8 @@
 
 
 #include <ostream>
+#include <set>
+#include <utility>
 #include <vector>
 
 namespace carl::covering {
@@ -11,13 +13,40 @@ namespace carl::covering {
 /**
  * Represents a set cover problem.
  * Allows to state which sets cover which elements and offers some helper methods to work with this set cover for the heuristics.
+ *
+ * Besides the sets, an inverted index from elements to the sets containing them and the sets ordered by their size are maintained incrementally.
+ * Thereby selecting a set only touches the sets that share elements with it and the largest set is available in logarithmic time.
  */
 class SetCover {
 public:
 	friend std::ostream& operator<<(std::ostream& os, const SetCover& sc);
 private:
+	/// Orders sets by decreasing size, ties are broken by increasing id.
+	struct LargerSet {
+		bool operator()(const std::pair<std::size_t, std::size_t>& lhs, const std::pair<std::size_t, std::size_t>& rhs) const {
+			if (lhs.first != rhs.first) return lhs.first > rhs.first;
+			return lhs.second < rhs.second;
+		}
+	};
 	/// The actual sets.
 	std::vector<Bitset> mSets;
+	/// The number of elements of every set.
+	std::vector<std::size_t> mSizes;
+	/// The sets containing every element.
+	std::vector<std::vector<std::size_t>> mElements;
+	/// Pairs of size and id of all sets, the largest set comes first. Built on first use.
+	mutable std::set<std::pair<std::size_t, std::size_t>, LargerSet> mBySize;
+	/// Whether mBySize is up to date.
+	mutable bool mOrdered = false;
+	/// The number of nonempty sets.
+	std::size_t mActiveSets = 0;
+
+	/// Makes sure that the given set exists.
+	void add_set(std::size_t set);
+	/// Updates the size of the given set.
+	void resize_set(std::size_t set, std::size_t size);
+	/// Makes sure that mBySize is up to date.
+	void order_sets() const;
 public:
 	/// States that s covers the given element.
 	void set(std::size_t set, std::size_t element);
@@ -27,6 +56,8 @@ public:
 	const auto& get_set(std::size_t set) const {
 		return mSets[set];
 	}
+	/// Returns the ids of all sets covering the given uncovered element.
+	const std::vector<std::size_t>& covering_sets(std::size_t element) const;
 	/// Returns the number of elements.
 	std::size_t element_count() const;
 	/// Removes empty sets.
@@ -48,4 +79,4 @@ public:
 /// Print the set cover to os.
 std::ostream& operator<<(std::ostream& os, const SetCover& sc);
 
-}
\ No newline at end of file
+}
@@ -6,33 +6,186 @@
 #include <carl-logging/carl-logging.h>
 #include <carl-common/datastructures/Bitset.h>
 
-#include <optional>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
 
 namespace carl::covering::heuristic {
 
-std::optional<Bitset> exact_of_size(const SetCover& sc, const Bitset& uncovered, const std::vector<std::size_t>& id_map, std::size_t size) {
-	std::vector<bool> selection(id_map.size() - size, false);
-	selection.resize(id_map.size(), true);
+namespace {
 
-	do {
-		Bitset covered;
-		for (std::size_t id = 0; id < selection.size(); ++id) {
-			if (selection[id]) {
-				covered |= sc.get_set(id_map[id]);
+/**
+ * Branch and bound search for a minimum set cover.
+ *
+ * Elements and sets are renumbered densely and all sets are stored as plain words, such that covering checks and updates are word-parallel.
+ * Branching follows the strategy of dancing links: the uncovered element contained in the fewest sets is covered by each of its sets in turn.
+ * A branch is pruned if a lower bound on the number of additional sets, obtained from elements whose sets are pairwise disjoint, cannot improve on the best cover.
+ */
+class BranchAndBound {
+	using Word = std::uint64_t;
+	static constexpr std::size_t word_bits = 64;
+	using Words = std::vector<Word>;
+
+	/// Number of words per element set.
+	std::size_t mElementWords;
+	/// Number of words per set of sets.
+	std::size_t mSetWords;
+	/// The elements of every set.
+	std::vector<Words> mSets;
+	/// The sets containing every element.
+	std::vector<Words> mContaining;
+	/// The number of sets containing every element.
+	std::vector<std::size_t> mContainingCount;
+
+	std::vector<std::size_t> mBest;
+	std::vector<std::size_t> mCurrent;
+	std::size_t mNodes = 0;
+	std::size_t mMaxNodes;
+
+	static bool test(const Words& w, std::size_t i) {
+		return (w[i / word_bits] >> (i % word_bits)) & 1;
+	}
+	static void set(Words& w, std::size_t i) {
+		w[i / word_bits] |= Word(1) << (i % word_bits);
+	}
+	static bool none(const Words& w) {
+		return std::all_of(w.begin(), w.end(), [](Word x) { return x == 0; });
+	}
+	static std::size_t count_common(const Words& a, const Words& b) {
+		std::size_t res = 0;
+		for (std::size_t i = 0; i < a.size(); ++i) res += static_cast<std::size_t>(std::popcount(a[i] & b[i]));
+		return res;
+	}
+	static bool intersects(const Words& a, const Words& b) {
+		for (std::size_t i = 0; i < a.size(); ++i) {
+			if (a[i] & b[i]) return true;
+		}
+		return false;
+	}
+	template<typename F>
+	static void for_each(const Words& w, F&& f) {
+		for (std::size_t i = 0; i < w.size(); ++i) {
+			for (Word x = w[i]; x != 0; x &= x - 1) {
+				f(i * word_bits + static_cast<std::size_t>(std::countr_zero(x)));
 			}
 		}
-		if (uncovered.is_subset_of(covered)) {
-			Bitset result;
-			for (std::size_t id = 0; id < selection.size(); ++id) {
-				result.set(id_map[id], selection[id]);
+	}
+
+	/// Returns the set covering the most uncovered elements, preferring larger ids.
+	std::size_t largest(const Words& uncovered) const {
+		std::size_t res = 0;
+		std::size_t res_count = 0;
+		for (std::size_t s = 0; s < mSets.size(); ++s) {
+			std::size_t c = count_common(mSets[s], uncovered);
+			if (c >= res_count) {
+				res = s;
+				res_count = c;
 			}
-			return result;
 		}
-	} while (std::next_permutation(selection.begin(), selection.end()));
-	return std::nullopt;
+		return res;
+	}
+
+	/// Returns a lower bound on the number of sets needed to cover the given elements.
+	std::size_t lower_bound(const Words& uncovered) const {
+		std::size_t res = 0;
+		Words blocked(mSetWords, 0);
+		for_each(uncovered, [&](std::size_t e) {
+			if (!intersects(mContaining[e], blocked)) {
+				++res;
+				for (std::size_t i = 0; i < mSetWords; ++i) blocked[i] |= mContaining[e][i];
+			}
+		});
+		return res;
+	}
+
+	void search(const Words& uncovered) {
+		if (none(uncovered)) {
+			if (mCurrent.size() < mBest.size()) {
+				mBest = mCurrent;
+				CARL_LOG_DEBUG("carl.covering", "Found cover of size " << mBest.size());
+			}
+			return;
+		}
+		if (mNodes >= mMaxNodes) return;
+		++mNodes;
+		if (mCurrent.size() + lower_bound(uncovered) >= mBest.size()) return;
+
+		// Branch on the element contained in the fewest sets.
+		std::size_t element = 0;
+		std::size_t element_count = std::numeric_limits<std::size_t>::max();
+		for_each(uncovered, [&](std::size_t e) {
+			if (mContainingCount[e] < element_count) {
+				element = e;
+				element_count = mContainingCount[e];
+			}
+		});
+		std::vector<std::pair<std::size_t, std::size_t>> candidates;
+		for_each(mContaining[element], [&](std::size_t s) {
+			candidates.emplace_back(count_common(mSets[s], uncovered), s);
+		});
+		std::sort(candidates.rbegin(), candidates.rend());
+
+		Words next(uncovered.size());
+		for (const auto& c: candidates) {
+			for (std::size_t i = 0; i < next.size(); ++i) next[i] = uncovered[i] & ~mSets[c.second][i];
+			mCurrent.push_back(c.second);
+			search(next);
+			mCurrent.pop_back();
+			if (mCurrent.size() + 1 >= mBest.size()) break;
+		}
+	}
+
+public:
+	/// Creates the search for the given sets over elements 0, ..., num_elements - 1.
+	BranchAndBound(const std::vector<Bitset>& sets, std::size_t num_elements, std::size_t max_nodes):
+		mElementWords((num_elements + word_bits - 1) / word_bits),
+		mSetWords((sets.size() + word_bits - 1) / word_bits),
+		mSets(sets.size(), Words(mElementWords, 0)),
+		mContaining(num_elements, Words(mSetWords, 0)),
+		mContainingCount(num_elements, 0),
+		mMaxNodes(max_nodes)
+	{
+		for (std::size_t s = 0; s < sets.size(); ++s) {
+			for (auto e: sets[s]) {
+				set(mSets[s], e);
+				set(mContaining[e], s);
+				++mContainingCount[e];
+			}
+		}
+	}
+
+	/// Returns a minimum cover as indices of sets, or the best cover found within the node budget.
+	std::vector<std::size_t> solve() {
+		Words uncovered(mElementWords, 0);
+		for (std::size_t e = 0; e < mContaining.size(); ++e) set(uncovered, e);
+		// Greedy yields the initial upper bound.
+		Words rest = uncovered;
+		mBest.clear();
+		while (!none(rest)) {
+			std::size_t s = largest(rest);
+			mBest.push_back(s);
+			for (std::size_t i = 0; i < rest.size(); ++i) rest[i] &= ~mSets[s][i];
+		}
+		CARL_LOG_DEBUG("carl.covering", "Greedy cover of size " << mBest.size());
+		search(uncovered);
+		if (mNodes >= mMaxNodes) {
+			CARL_LOG_DEBUG("carl.covering", "Node budget exhausted, cover of size " << mBest.size() << " may not be minimal");
+		}
+		return mBest;
+	}
+
+	std::size_t nodes() const {
+		return mNodes;
+	}
+};
+
 }
 
 Bitset exact(SetCover& sc) {
+	return exact_bounded(sc, std::numeric_limits<std::size_t>::max());
+}
+
+Bitset exact_bounded(SetCover& sc, std::size_t max_nodes) {
 	Bitset pre;
 	pre |= carl::covering::heuristic::remove_duplicates(sc);
 	CARL_LOG_DEBUG("carl.covering", "Removed duplicates: " << pre << std::endl << sc);
@@ -46,25 +199,29 @@ Bitset exact(SetCover& sc) {
 	}
 	CARL_LOG_DEBUG("carl.covering", "Remaining: " << uncovered);
 
-	// Maps local ids to ids in sc. We only consider active sets for local ids.
+	// Maps local ids to ids in sc. We only consider active sets for local ids and uncovered elements.
 	std::vector<std::size_t> id_map;
+	std::vector<std::size_t> element_map(uncovered.size(), 0);
+	std::size_t num_elements = 0;
+	for (auto e: uncovered) element_map[e] = num_elements++;
+	std::vector<Bitset> sets;
 	for (std::size_t sid = 0; sid < sc.set_count(); ++sid) {
-		if (sc.get_set(sid).any()) id_map.emplace_back(sid);
+		if (sc.get_set(sid).none()) continue;
+		id_map.emplace_back(sid);
+		sets.emplace_back();
+		for (auto e: sc.get_set(sid)) sets.back().set(element_map[e]);
 	}
 
-	for (std::size_t size = 0; size < sc.active_set_count(); ++size) {
-		auto res = exact_of_size(sc, uncovered, id_map, size);
-		if (res) {
-			for (auto bit: *res) {
-				sc.select_set(bit);
-			}
-			CARL_LOG_DEBUG("carl.covering", "Got exact covering of size " << size << " -> " << *res);
-			return pre | *res;
-		}
+	BranchAndBound bnb(sets, num_elements, max_nodes);
+	Bitset res;
+	for (auto s: bnb.solve()) {
+		res.set(id_map[s]);
 	}
-
-	CARL_LOG_ERROR("carl.covering", "Did not find an exact set cover.")
-	return Bitset();
+	for (auto bit: res) {
+		sc.select_set(bit);
+	}
+	CARL_LOG_DEBUG("carl.covering", "Got covering of size " << res.count() << " after " << bnb.nodes() << " nodes -> " << res);
+	return pre | res;
 }
 
-}
\ No newline at end of file
+}
@@ -3,6 +3,8 @@
 #include "../SetCover.h"
 #include "../TypedSetCover.h"
 
+#include <limits>
+
 namespace carl::covering::heuristic {
 
 /**
@@ -11,4 +13,11 @@ namespace carl::covering::heuristic {
  */
 Bitset exact(SetCover& sc);
 
-}
\ No newline at end of file
+/**
+ * Bounded exact heuristic:
+ * Computes a minimum set cover by branch and bound, starting from the greedy solution as upper bound.
+ * If more than max_nodes nodes of the search tree are explored, the best cover found so far is returned, which is at least as good as the one of greedy.
+ */
+Bitset exact_bounded(SetCover& sc, std::size_t max_nodes = 100000);
+
+}
@@ -10,14 +10,9 @@ Bitset select_essential(SetCover& sc) {
 	while (has_selected) {
 		has_selected = false;
 		for (std::size_t e = 0; e < sc.element_count(); ++e) {
-			std::size_t num = 0;
-			std::size_t set = 0;
-			for (std::size_t s = 0; (s < sc.set_count()) && (num <= 1); ++s) {
-				if (sc.get_set(s).test(e)) {
-					++num;
-					set = s;
-				}
-			}
+			const auto& sets = sc.covering_sets(e);
+			std::size_t num = sets.size();
+			std::size_t set = num == 1 ? sets.front() : 0;
 			if (num == 1) {
 				sc.select_set(set);
 				selected.set(set);
@@ -31,22 +31,18 @@ template<typename Pol>
 struct CachedConstraintContent {
 	/// Basic constraint.
 	BasicConstraint<Pol> m_constraint;
+	/// The variables occurring in the polynomial considered by this constraint, computed once when the constraint is added to the pool.
+	VariableSignature m_variables;
 	/// Cache for the factorization.
 	mutable Factors<Pol> m_lhs_factorization;
-	/// A container which includes all variables occurring in the polynomial considered by this constraint.
-	mutable carlVariables m_variables;
 	/// A map which stores information about properties of the variables in this constraint.
 	mutable VarsInfo<Pol> m_var_info_map;
 	#ifdef THREAD_SAFE
-	/// Mutex for access to variable information map.
-	std::mutex m_var_info_map_mutex;
-	/// Mutex for access to the factorization.
-	std::mutex m_lhs_factorization_mutex;
-	/// Mutex for access to the variables.
-	std::mutex m_variables_mutex;
+	/// Mutex for access to the lazily computed caches, i.e. the factorization and the variable information map.
+	mutable std::mutex m_cache_mutex;
 	#endif
 
-	CachedConstraintContent(BasicConstraint<Pol>&& c) : m_constraint(std::move(c)) {}
+	CachedConstraintContent(BasicConstraint<Pol>&& c) : m_constraint(std::move(c)), m_variables(carl::variables(m_constraint.lhs())) {}
 	const auto& key() const { return m_constraint; }
 };
 
@@ -127,29 +123,24 @@ public:
 	/**
      * @return A container containing all variables occurring in the polynomial of this constraint.
      */
-	const auto& variables() const {
-		#ifdef THREAD_SAFE
-		m_element->m_variables_mutex.lock();
-		#endif
-		if (m_element->m_variables.empty()) {
-			m_element->m_variables = carl::variables(lhs());
-		}
-		#ifdef THREAD_SAFE
-		m_element->m_variables_mutex.unlock();
-		#endif
+	const carlVariables& variables() const {
+		return m_element->m_variables.variables();
+	}
+
+	/**
+     * @return The variable signature of this constraint, allowing for fast membership and intersection queries.
+     */
+	const VariableSignature& variable_signature() const {
 		return m_element->m_variables;
 	}
 
 	const Factors<Pol>& lhs_factorization() const {
 		#ifdef THREAD_SAFE
-		m_element->m_lhs_factorization_mutex.lock();
+		std::lock_guard<std::mutex> lock(m_element->m_cache_mutex);
 		#endif
 		if (m_element->m_lhs_factorization.empty()) {
 			m_element->m_lhs_factorization = carl::factorization(lhs());
 		}
-		#ifdef THREAD_SAFE
-		m_element->m_lhs_factorization_mutex.unlock();
-		#endif
 		return m_element->m_lhs_factorization;
 	}
 
@@ -164,15 +155,12 @@ public:
 	template<bool gatherCoeff = false>
 	const VarInfo<Pol>& var_info(const Variable variable) const {
 		#ifdef THREAD_SAFE
-		m_element->m_var_info_map_mutex.lock();
+		std::lock_guard<std::mutex> lock(m_element->m_cache_mutex);
 		#endif
 		if (!m_element->m_var_info_map.occurs(variable) || (gatherCoeff && !m_element->m_var_info_map.var(variable).has_coeff())) {
 			m_element->m_var_info_map.data()[variable] = carl::var_info(lhs(),variable,gatherCoeff);
 			assert(m_element->m_var_info_map.occurs(variable));
 		}
-		#ifdef THREAD_SAFE
-		m_element->m_var_info_map_mutex.unlock();
-		#endif
 		return m_element->m_var_info_map.var(variable);
 	}
 
@@ -206,7 +194,7 @@ public:
      * @return The maximal degree of the given variable in this constraint. (Monomial-wise)
      */
 	uint maxDegree(const Variable& _variable) const {
-		if (!variables().has(_variable)) return 0;
+		if (!variable_signature().has(_variable)) return 0;
 		else return var_info(_variable).max_degree();
 	}
 
@@ -327,7 +315,7 @@ std::ostream& operator<<(std::ostream& os, const Constraint<Poly>& c) {
 
 template<typename Pol>
 void variables(const Constraint<Pol>& c, carlVariables& vars) {
-	vars.add(c.variables().begin(), c.variables().end());
+	carl::variables(c.variable_signature(), vars);
 }
 
 template<typename Pol>
@@ -66,6 +66,13 @@ namespace carl
              */
             static void addConstraintProperties( const Constraint<Pol>& _constraint, Condition& _properties );
 
+            /**
+             * Collects the variables occurring in the given formula content, reusing the variables already stored for its sub-formulas.
+             * @param _content The formula content to collect the variables for.
+             * @return The variable signature of the given formula content.
+             */
+            static VariableSignature collectVariables( const FormulaContent<Pol>& _content );
+
             // Members.
 
             /// The content of this formula.
@@ -81,10 +88,8 @@ namespace carl
 
             #ifdef THREAD_SAFE
             #define ACTIVITY_LOCK_GUARD std::lock_guard<std::mutex> lock1( mpContent->mActivityMutex );
-            #define VARIABLES_LOCK_GUARD std::lock_guard<std::mutex> lock3( mpContent->mVariablesMutex );
             #else
             #define ACTIVITY_LOCK_GUARD
-            #define VARIABLES_LOCK_GUARD
             #endif
 
         public:
@@ -304,13 +309,20 @@ namespace carl
                 return mpContent->mProperties;
             }
 
-            const Variables& variables() const
+            /**
+             * @return All variables occurring in this formula, including quantified variables.
+             */
+            const carlVariables& variables() const
             {
-                VARIABLES_LOCK_GUARD
-                if( mpContent->mpVariables == nullptr ) {
-                    mpContent->mpVariables = new Variables(carl::variables(*this).as_set());
-                }
-                return *(mpContent->mpVariables);
+                return mpContent->mVariables.variables();
+            }
+
+            /**
+             * @return The variable signature of this formula, allowing for fast membership and intersection queries.
+             */
+            const VariableSignature& variable_signature() const
+            {
+                return mpContent->mVariables;
             }
 
             Formula negated() const
@@ -19,6 +19,7 @@ namespace carl
     template<typename Pol>
     void Formula<Pol>::init( FormulaContent<Pol>& _content )
     {
+        _content.mVariables = collectVariables( _content );
         _content.mProperties = Condition();
         switch( _content.mType )
         {
@@ -173,6 +174,62 @@ namespace carl
         }
     }
 
+    template<typename Pol>
+    VariableSignature Formula<Pol>::collectVariables( const FormulaContent<Pol>& _content )
+    {
+        carlVariables vars;
+        switch( _content.mType )
+        {
+            case FormulaType::TRUE:
+            case FormulaType::FALSE:
+            case FormulaType::CONSTRAINT:
+                carl::variables(std::get<Constraint<Pol>>(_content.mContent).variable_signature(), vars);
+                break;
+            case FormulaType::BOOL:
+                vars.add(std::get<carl::Variable>(_content.mContent));
+                break;
+            case FormulaType::VARCOMPARE:
+                carl::variables(std::get<VariableComparison<Pol>>(_content.mContent), vars);
+                break;
+            case FormulaType::VARASSIGN:
+                carl::variables(std::get<VariableAssignment<Pol>>(_content.mContent), vars);
+                break;
+            case FormulaType::BITVECTOR:
+                std::get<BVConstraint>(_content.mContent).gatherVariables(vars);
+                break;
+            case FormulaType::UEQ:
+                std::get<UEquality>(_content.mContent).gatherVariables(vars);
+                break;
+            case FormulaType::NOT:
+                carl::variables(std::get<Formula<Pol>>(_content.mContent).variable_signature(), vars);
+                break;
+            case FormulaType::EXISTS:
+            case FormulaType::FORALL:
+            {
+                const auto& qc = std::get<QuantifierContent<Pol>>(_content.mContent);
+                vars.add(qc.mVariables.begin(), qc.mVariables.end());
+                carl::variables(qc.mFormula.variable_signature(), vars);
+                break;
+            }
+            case FormulaType::AUX_EXISTS:
+            {
+                const auto& qc = std::get<AuxQuantifierContent<Pol>>(_content.mContent);
+                vars.add(qc.mVariables.begin(), qc.mVariables.end());
+                carl::variables(qc.mAuxFormula.variable_signature(), vars);
+                carl::variables(qc.mFormula.variable_signature(), vars);
+                break;
+            }
+            default:
+            {
+                assert(_content.is_nary());
+                for (const auto& subFormula: std::get<Formulas<Pol>>(_content.mContent)) {
+                    carl::variables(subFormula.variable_signature(), vars);
+                }
+            }
+        }
+        return VariableSignature(std::move(vars));
+    }
+
     template<typename Pol>
     void Formula<Pol>::addConstraintProperties( const Constraint<Pol>& _constraint, Condition& _properties )
     {
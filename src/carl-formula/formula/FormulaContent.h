@@ -182,11 +182,9 @@ namespace carl {
             #ifdef THREAD_SAFE
             /// Mutex for access to activity.
             mutable std::mutex mActivityMutex;
-            /// Mutex for collecting the variables within this formula.
-            mutable std::mutex mVariablesMutex;
             #endif
-            /// Container collecting the variables which occur in this formula.
-            mutable Variables* mpVariables = nullptr;
+            /// The variables which occur in this formula, computed once when the formula is added to the pool.
+            VariableSignature mVariables;
             
             FormulaContent() = delete;
             FormulaContent(const FormulaContent&) = delete;
@@ -250,14 +248,6 @@ namespace carl {
             
         public:
 
-            /**
-             * Destructor.
-             */
-            ~FormulaContent() {
-                if( mpVariables != nullptr )
-                    delete mpVariables;
-            }
-
             std::size_t hash() const {
                 return mHash;
             }
@@ -9,6 +9,8 @@
 
 #include "FormulaPool.h"
 
+#include <carl-statistics/carl-statistics.h>
+
 namespace carl
 {
     template<typename Pol>
@@ -45,6 +47,7 @@ namespace carl
     template<typename Pol>
     const FormulaContent<Pol>* FormulaPool<Pol>::add( FormulaContent<Pol>&& _element )
     {
+        CARL_TRACE_SPAN("carl.formula", "pool_add");
         assert( _element.mType != FormulaType::NOT );
         FORMULA_POOL_LOCK_GUARD
 
@@ -98,7 +98,7 @@ Formula<Poly> to_pnf(const Formula<Poly>& f, QuantifierPrefix& reverse_prefix, b
 
 			auto subres = to_pnf(sub, reverse_prefix, used_vars, negated);
 			for (auto v : new_qvars) {
-				if (subres.variables().find(v) != subres.variables().end()) {
+				if (subres.variable_signature().has(v)) {
 					reverse_prefix.push_back(std::make_pair(q, v));
 				}
 			}
@@ -125,7 +125,7 @@ Formula<Poly> to_pnf(const Formula<Poly>& f, QuantifierPrefix& reverse_prefix, b
 
 			auto subres = carl::Formula(carl::FormulaType::AND, sub_aux, to_pnf(sub, reverse_prefix, used_vars, negated));
 			for (auto v : new_qvars) {
-				if (subres.variables().find(v) != subres.variables().end()) {
+				if (subres.variable_signature().has(v)) {
 					reverse_prefix.push_back(std::make_pair(q, v));
 				}
 			}
@@ -5,38 +5,13 @@
 
 namespace carl{
 
+/**
+ * Collects all variables occurring in this formula.
+ * As the variables are stored for every formula when it is created, this does not traverse the formula.
+ */
 template<typename Pol>
 void variables(const Formula<Pol>& f, carlVariables& vars) {
-    carl::visit(f,
-        [&vars](const Formula<Pol>& f) {
-            switch (f.type()) {
-                case FormulaType::BOOL:
-                    vars.add(f.boolean());
-                    break;
-                case FormulaType::CONSTRAINT:
-                    carl::variables(f.constraint(), vars);
-                    break;
-                case FormulaType::VARCOMPARE:
-                    carl::variables(f.variable_comparison(), vars);
-                    break;
-                case FormulaType::VARASSIGN:
-                    carl::variables(f.variable_assignment(), vars);
-                    break;
-                case FormulaType::BITVECTOR:
-                    f.bv_constraint().gatherVariables(vars);
-                    break;
-                case FormulaType::UEQ:
-                    f.u_equality().gatherVariables(vars);
-                    break;
-                case FormulaType::EXISTS:
-                case FormulaType::AUX_EXISTS:
-                case FormulaType::FORALL:
-                    vars.add(f.quantified_variables().begin(),f.quantified_variables().end());
-                    break;
-                default: break;
-            }
-        }
-    );
+    carl::variables(f.variable_signature(), vars);
 }
 
 template<typename Pol>
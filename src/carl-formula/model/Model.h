@@ -5,6 +5,10 @@
 #include "ModelVariable.h"
 #include "ModelValue.h"
 
+#include <atomic>
+#include <map>
+#include <vector>
+
 namespace carl
 {
 	/**
@@ -25,11 +29,36 @@ namespace carl
 		static_assert(std::is_same<mapped_type, typename Map::mapped_type>::value, "Should be the same type");
 	private:
 		Map mData;
-		std::map<key_type, std::size_t> mUsedInSubstitution;
-		void resetCaches() const {
-			for (const auto& d: mData) {
-				if (d.second.isSubstitution()) {
+		/// Identifies this model, a model gets a new id whenever it is assigned, hence no two states of models share an id and a generation.
+		std::size_t mId = next_id();
+		/// Counts the modifications of this model.
+		std::size_t mGeneration = 0;
+		/// Stores for every model variable the generation of its last change, including changes of values it depends on.
+		std::map<key_type, std::size_t> mLastChanged;
+		static std::size_t next_id() {
+			static std::atomic<std::size_t> counter(0);
+			return ++counter;
+		}
+		/**
+		 * Records that the value of the given key changes.
+		 * Only the caches of substitutions that (transitively) depend on the given key are reset, and the keys of these substitutions are considered to be changed as well.
+		 */
+		void invalidate(const key_type& key) {
+			++mGeneration;
+			mLastChanged[key] = mGeneration;
+			std::vector<key_type> worklist({key});
+			while (!worklist.empty()) {
+				key_type cur = worklist.back();
+				worklist.pop_back();
+				for (const auto& d: mData) {
+					if (!d.second.isSubstitution()) continue;
+					if (!d.second.asSubstitution()->dependsOn(cur)) continue;
 					d.second.asSubstitution()->resetCache();
+					auto& changed = mLastChanged[d.first];
+					if (changed != mGeneration) {
+						changed = mGeneration;
+						worklist.push_back(d.first);
+					}
 				}
 			}
 		}
@@ -55,38 +84,41 @@ namespace carl
 		}
 		// Modifiers
 		void clear() {
+			++mGeneration;
+			for (const auto& d: mData) {
+				mLastChanged[d.first] = mGeneration;
+			}
 			mData.clear();
 		}
 		template<typename P>
 		auto insert(const P& pair) {
-			resetCaches();
+			invalidate(pair.first);
 			return mData.insert(pair);
 		}
 		template<typename P>
 		auto insert(typename Map::const_iterator it, const P& pair) {
-			resetCaches();
+			invalidate(pair.first);
 			return mData.insert(it, pair);
 		}
 		template<typename... Args>
 		auto emplace(const key_type& key, Args&& ...args) {
-			resetCaches();
+			invalidate(key);
 			return mData.emplace(key,std::forward<Args>(args)...);
 		}
 		template<typename... Args>
 		auto emplace_hint(typename Map::const_iterator it, const key_type& key, Args&& ...args) {
-			resetCaches();
+			invalidate(key);
 			return mData.emplace_hint(it, key,std::forward<Args>(args)...);
 		}
 		typename Map::iterator erase(const ModelVariable& variable) {
-			resetCaches();
 			return erase(mData.find(variable));
 		}
 		typename Map::iterator erase(const typename Map::iterator& it) {
-			resetCaches();
 			return erase(typename Map::const_iterator(it));
 		}
 		typename Map::iterator erase(const typename Map::const_iterator& it) {
 			if (it == mData.end()) return mData.end();
+			invalidate(it->first);
 			return mData.erase(it);
 		}
         void clean() {
@@ -102,15 +134,71 @@ namespace carl
 		auto find(const typename Map::key_type& key) const {
 			return mData.find(key);
 		}
+		/**
+		 * Note that modifying a value through the returned iterator bypasses the cache invalidation, use assign() instead.
+		 */
 		auto find(const typename Map::key_type& key) {
 			return mData.find(key);
 		}
 		
 		// Additional (w.r.t. std::map)
 		Model() = default;
+		Model(const Model& m):
+			mData(m.mData), mGeneration(m.mGeneration), mLastChanged(m.mLastChanged)
+		{}
+		Model(Model&& m) noexcept:
+			mData(std::move(m.mData)), mGeneration(m.mGeneration), mLastChanged(std::move(m.mLastChanged))
+		{}
+		Model& operator=(const Model& m) {
+			mData = m.mData;
+			mId = next_id();
+			mGeneration = m.mGeneration;
+			mLastChanged = m.mLastChanged;
+			return *this;
+		}
+		Model& operator=(Model&& m) noexcept {
+			mData = std::move(m.mData);
+			mId = next_id();
+			mGeneration = m.mGeneration;
+			mLastChanged = std::move(m.mLastChanged);
+			return *this;
+		}
 		Model(const std::map<Variable, Rational>& assignment) {
+			// Plain values do not depend on other keys, hence a single generation covers all of them.
+			++mGeneration;
 			for (const auto& a: assignment) {
-				mData.emplace(a.first, a.second);
+				mData.emplace_hint(mData.end(), a.first, a.second);
+				mLastChanged.emplace_hint(mLastChanged.end(), a.first, mGeneration);
+			}
+		}
+		/**
+		 * Returns an id that is unique among all models of this type, it changes whenever the model is assigned.
+		 */
+		std::size_t id() const {
+			return mId;
+		}
+		/**
+		 * Returns the current generation of this model, which is increased by every modification.
+		 */
+		std::size_t generation() const {
+			return mGeneration;
+		}
+		/**
+		 * Returns the generation in which the value of the given key has changed last, or zero if it never changed.
+		 * A key is also considered to be changed if it is assigned a substitution depending on a changed key.
+		 */
+		std::size_t last_changed(const key_type& key) const {
+			auto it = mLastChanged.find(key);
+			if (it == mLastChanged.end()) return 0;
+			return it->second;
+		}
+		/**
+		 * Calls the given function for every key that has changed after the given generation.
+		 */
+		template<typename F>
+		void changed_since(std::size_t generation, F&& f) const {
+			for (const auto& c: mLastChanged) {
+				if (c.second > generation) f(c.first);
 			}
 		}
 		template<typename Container>
@@ -122,12 +210,14 @@ namespace carl
 		}
 		template<typename T>
 		void assign(const typename Map::key_type& key, const T& t) {
+			invalidate(key);
 			auto it = mData.find(key);
 			if (it == mData.end()) mData.emplace(key, t);
 			else it->second = t;
 		}
 		void update(const Model& model, bool disjoint = true) {
 			for (const auto& m: model) {
+				invalidate(m.first);
 				auto res = mData.insert(m);
 				if (disjoint) {
 					assert(res.second);
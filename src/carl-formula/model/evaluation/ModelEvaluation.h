@@ -64,3 +64,5 @@ unsigned satisfied_by(const T& t, const Model<Rational,Poly>& m) {
 }
 
 }
+
+#include "ModelEvaluation_Incremental.h"
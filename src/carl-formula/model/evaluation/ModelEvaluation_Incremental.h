@@ -0,0 +1,170 @@
+#pragma once
+
+#include <carl-formula/formula/Formula.h>
+#include "../Model.h"
+
+#include <carl-logging/carl-logging.h>
+
+#include <unordered_map>
+
+namespace carl {
+
+	/**
+	 * Stores results of substituting a model into formulas, such that repeated evaluations over a changing model only recompute subformulas whose variables have changed.
+	 * The cache is tied to a single model, identified by Model::id(): whenever it is used with a different model or the model was assigned in the meantime, it is cleared.
+	 * Before every evaluation, the cache asks the model for all keys that have changed since the last evaluation and drops all results for formulas that contain any of them.
+	 */
+	template<typename Rational, typename Poly>
+	class FormulaEvaluationCache {
+	private:
+		/// The id of the model the results have been computed for, zero if there is none.
+		std::size_t mModel = 0;
+		/// The generation of mModel the results are valid for.
+		std::size_t mGeneration = 0;
+		/// Maps formulas to the result of substituting mModel.
+		std::unordered_map<Formula<Poly>, Formula<Poly>> mResults;
+		/// Statistics: number of results that were reused.
+		std::size_t mHits = 0;
+		/// Statistics: number of results that were computed.
+		std::size_t mMisses = 0;
+
+	public:
+		/**
+		 * Drops all results that are outdated with respect to the given model.
+		 */
+		void synchronize(const Model<Rational,Poly>& m) {
+			if (mModel != m.id()) {
+				mResults.clear();
+				mModel = m.id();
+				mGeneration = m.generation();
+				return;
+			}
+			if (mGeneration == m.generation()) return;
+			carlVariables changed;
+			bool all = false;
+			m.changed_since(mGeneration, [&changed, &all](const ModelVariable& mv) {
+				if (mv.is_variable()) changed.add(mv.asVariable());
+				else if (mv.isBVVariable()) changed.add(mv.asBVVariable().variable());
+				else if (mv.isUVariable()) changed.add(mv.asUVariable().variable());
+				else all = true;
+			});
+			mGeneration = m.generation();
+			if (all) {
+				mResults.clear();
+				return;
+			}
+			VariableSignature sig(std::move(changed));
+			for (auto it = mResults.begin(); it != mResults.end();) {
+				if (it->first.variable_signature().intersects(sig)) {
+					it = mResults.erase(it);
+				} else {
+					++it;
+				}
+			}
+			CARL_LOG_DEBUG("carl.model.evaluation", "Kept " << mResults.size() << " results after changes of " << sig);
+		}
+
+		/// Looks up the result for the given formula.
+		const Formula<Poly>* lookup(const Formula<Poly>& f) {
+			auto it = mResults.find(f);
+			if (it == mResults.end()) {
+				++mMisses;
+				return nullptr;
+			}
+			++mHits;
+			return &it->second;
+		}
+		/// Stores the result for the given formula.
+		const Formula<Poly>& store(const Formula<Poly>& f, const Formula<Poly>& result) {
+			return mResults.insert_or_assign(f, result).first->second;
+		}
+
+		void clear() {
+			mResults.clear();
+			mModel = 0;
+		}
+		std::size_t size() const {
+			return mResults.size();
+		}
+		std::size_t hits() const {
+			return mHits;
+		}
+		std::size_t misses() const {
+			return mMisses;
+		}
+	};
+
+namespace model {
+
+	template<typename Rational, typename Poly>
+	Formula<Poly> substitute_cached(const Formula<Poly>& f, const Model<Rational,Poly>& m, FormulaEvaluationCache<Rational,Poly>& cache) {
+		if (f.is_true() || f.is_false()) return f;
+		if (const auto* res = cache.lookup(f); res != nullptr) {
+			return *res;
+		}
+		switch (f.type()) {
+			case FormulaType::NOT:
+				return cache.store(f, Formula<Poly>(FormulaType::NOT, substitute_cached(f.subformula(), m, cache)));
+			case FormulaType::IMPLIES: {
+				auto premise = substitute_cached(f.premise(), m, cache);
+				if (premise.is_false()) return cache.store(f, Formula<Poly>(FormulaType::TRUE));
+				return cache.store(f, Formula<Poly>(FormulaType::IMPLIES, premise, substitute_cached(f.conclusion(), m, cache)));
+			}
+			case FormulaType::ITE: {
+				auto condition = substitute_cached(f.condition(), m, cache);
+				if (condition.is_true()) return cache.store(f, substitute_cached(f.first_case(), m, cache));
+				if (condition.is_false()) return cache.store(f, substitute_cached(f.second_case(), m, cache));
+				return cache.store(f, Formula<Poly>(FormulaType::ITE, condition, substitute_cached(f.first_case(), m, cache), substitute_cached(f.second_case(), m, cache)));
+			}
+			case FormulaType::AND:
+			case FormulaType::OR: {
+				// A single false (resp. true) subformula determines the result, the remaining subformulas are not evaluated.
+				bool is_and = f.type() == FormulaType::AND;
+				Formulas<Poly> res;
+				res.reserve(f.subformulas().size());
+				for (const auto& sub: f.subformulas()) {
+					res.emplace_back(substitute_cached(sub, m, cache));
+					if ((is_and && res.back().is_false()) || (!is_and && res.back().is_true())) {
+						return cache.store(f, res.back());
+					}
+				}
+				return cache.store(f, Formula<Poly>(f.type(), std::move(res)));
+			}
+			case FormulaType::XOR:
+			case FormulaType::IFF: {
+				Formulas<Poly> res;
+				res.reserve(f.subformulas().size());
+				for (const auto& sub: f.subformulas()) {
+					res.emplace_back(substitute_cached(sub, m, cache));
+				}
+				return cache.store(f, Formula<Poly>(f.type(), std::move(res)));
+			}
+			default:
+				return cache.store(f, substitute(f, m));
+		}
+	}
+
+}
+
+	/**
+	 * Substitutes a model into a formula, reusing the results for all subformulas that are not affected by changes of the model since the last call with the same cache.
+	 */
+	template<typename Rational, typename Poly>
+	Formula<Poly> substitute(const Formula<Poly>& f, const Model<Rational,Poly>& m, FormulaEvaluationCache<Rational,Poly>& cache) {
+		cache.synchronize(m);
+		return model::substitute_cached(f, m, cache);
+	}
+
+	/**
+	 * Evaluates a formula over a model incrementally, see substitute(const Formula<Poly>&, const Model<Rational,Poly>&, FormulaEvaluationCache<Rational,Poly>&).
+	 * The result is the same as for evaluate(const T&, const Model<Rational,Poly>&).
+	 */
+	template<typename Rational, typename Poly>
+	ModelValue<Rational,Poly> evaluate(const Formula<Poly>& f, const Model<Rational,Poly>& m, FormulaEvaluationCache<Rational,Poly>& cache) {
+		auto res = substitute(f, m, cache);
+		if (res.is_true()) return true;
+		if (res.is_false()) return false;
+		return createSubstitution<Rational,Poly,ModelFormulaSubstitution<Rational,Poly>>(res);
+	}
+
+}
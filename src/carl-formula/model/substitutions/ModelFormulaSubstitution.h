@@ -26,7 +26,7 @@ namespace carl {
 		}
 		virtual bool dependsOn(const ModelVariable& var) const {
 			if (var.is_variable()) {
-				return mFormula.variables().count(var.asVariable()) > 0;
+				return mFormula.variable_signature().has(var.asVariable());
 			} else if (var.isBVVariable()) {
 				
 			} else if (var.isUVariable()) {
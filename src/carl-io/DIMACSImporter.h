@@ -1,10 +1,10 @@
 #pragma once
 
-#include <fstream>
-#include <iostream>
-#include <regex>
-#include <sstream>
+#include "DIMACSReader.h"
+
+#include <cstdlib>
 #include <string>
+#include <vector>
 
 #include <carl-formula/formula/Formula.h>
 #include <carl-logging/carl-logging.h>
@@ -19,47 +19,29 @@ namespace carl::io {
 template<typename Pol>
 class DIMACSImporter {
 private:
-	std::ifstream in;
+	DIMACSReader mReader;
 	std::vector<Formula<Pol>> variables;
-	std::regex headerRegex;
+	/// Buffer for the literals of the current clause.
+	std::vector<long long> mLiterals;
 	
-	Formula<Pol> parseLine(const std::string& line) const {
+	Formula<Pol> parseClause() const {
 		std::vector<Formula<Pol>> vars;
-		const char* begin = line.c_str();
-		char* end = nullptr;
-		long long id;
-		while (true) {
-			id = std::strtoll(begin, &end, 10);
-			begin = end;
-			if (id == 0) break;
+		vars.reserve(mLiterals.size());
+		for (auto id: mLiterals) {
 			Formula<Pol> v = variables.at(std::size_t(std::abs(id)-1));
 			if (id > 0) vars.emplace_back(v);
 			else vars.emplace_back(NOT, v);
 		}
-		return std::move(Formula<Pol>(OR, std::move(vars)));
+		return Formula<Pol>(OR, std::move(vars));
 	}
 	
 	Formula<Pol> parseFormula() {
-		std::string line;
 		std::vector<Formula<Pol>> formulas;
-		while (!in.eof()) {
-			std::getline(in, line);
-			if (line == "") continue;
-			if (line == "reset") break;
-			if (line.front() == 'c') continue;
-			if (line.front() == 'p') {
-				std::smatch m;
-				if (!std::regex_match(line, m, headerRegex)) {
-					CARL_LOG_ERROR("carl.formula", "DIMACS line starting with \"p\" does not match header format: \"" << line << "\".");
-				}
-				std::size_t varCount = std::stoull(m[1]);
-				variables.reserve(varCount);
-				while (variables.size() < varCount) {
-					variables.emplace_back(fresh_boolean_variable());
-				}
-				continue;
+		while (mReader.next_clause(mLiterals)) {
+			while (variables.size() < mReader.variables()) {
+				variables.emplace_back(fresh_boolean_variable());
 			}
-			formulas.push_back(parseLine(line));
+			formulas.push_back(parseClause());
 		}
 		return Formula<Pol>(AND, std::move(formulas));
 	}
@@ -67,13 +49,12 @@ private:
 public:
 	/// Load the given file.
 	DIMACSImporter(const std::string& filename):
-		in(filename),
-		headerRegex("p cnf (\\d+) (\\d+)")
+		mReader(filename)
 	{}
 	
 	/// Checks if there is another formula to parse.
 	bool hasNext() const {
-		return !in.eof();
+		return !mReader.at_end();
 	}
 	
 	/// Parses and returns the next formula (until the next reset line).
@@ -0,0 +1,65 @@
+#include "DIMACSReader.h"
+
+#include <carl-logging/carl-logging.h>
+
+namespace carl::io {
+
+DIMACSReader::DIMACSReader(const std::string& filename):
+	mFile(filename),
+	mScanner(mFile)
+{
+	mScanner.skip_space();
+}
+
+bool DIMACSReader::parse_header() {
+	mScanner.skip_blank();
+	if (!mScanner.consume("cnf")) return false;
+	mScanner.skip_blank();
+	if (!mScanner.read_integer(mVariables)) return false;
+	mScanner.skip_blank();
+	if (!mScanner.read_integer(mClauses)) return false;
+	mScanner.skip_blank();
+	return mScanner.peek() == '\n' || mScanner.peek() == '\0';
+}
+
+bool DIMACSReader::next_clause(std::vector<long long>& literals) {
+	literals.clear();
+	while (true) {
+		mScanner.skip_space();
+		char c = mScanner.peek();
+		if (c == '\0' && mScanner.at_end()) {
+			return !literals.empty();
+		}
+		if (literals.empty()) {
+			if (c == 'c') {
+				mScanner.skip_line();
+				continue;
+			}
+			if (c == 'p') {
+				mScanner.consume("p");
+				if (!parse_header()) {
+					CARL_LOG_ERROR("carl.io.dimacs", "DIMACS line " << mScanner.line() << " starting with \"p\" does not match header format \"p cnf <variables> <clauses>\".");
+					mFailed = true;
+				}
+				mScanner.skip_line();
+				continue;
+			}
+			if (mScanner.consume("reset")) {
+				mScanner.skip_line();
+				mScanner.skip_space();
+				return false;
+			}
+		}
+		long long lit = 0;
+		if (!mScanner.read_integer(lit)) {
+			CARL_LOG_ERROR("carl.io.dimacs", "Unexpected input in DIMACS line " << mScanner.line() << ": \"" << mScanner.read_line() << "\".");
+			mFailed = true;
+			literals.clear();
+			continue;
+		}
+		if (lit == 0) return true;
+		literals.push_back(lit);
+	}
+}
+
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "MappedFile.h"
+
+#include <string>
+#include <vector>
+
+namespace carl::io {
+
+/**
+ * Streaming reader for the DIMACS CNF format working on a memory-mapped file.
+ *
+ * Clauses are returned one by one as lists of literals, without building formulas or allocating per line.
+ * Like DIMACSImporter, a line only containing "reset" separates multiple problems in one file.
+ */
+class DIMACSReader {
+private:
+	MappedFile mFile;
+	MappedScanner mScanner;
+	/// Number of variables from the last header.
+	std::size_t mVariables = 0;
+	/// Number of clauses from the last header.
+	std::size_t mClauses = 0;
+	/// Set if some line could not be parsed.
+	bool mFailed = false;
+
+	bool parse_header();
+public:
+	/// Maps the given file.
+	explicit DIMACSReader(const std::string& filename);
+
+	/// Checks whether the file could be opened.
+	bool is_open() const {
+		return mFile.is_open();
+	}
+	/// Checks whether the whole file has been read.
+	bool at_end() const {
+		return mScanner.at_end();
+	}
+	/// Checks whether some line could not be parsed.
+	bool failed() const {
+		return mFailed;
+	}
+	/// Returns the number of variables stated in the last header.
+	std::size_t variables() const {
+		return mVariables;
+	}
+	/// Returns the number of clauses stated in the last header.
+	std::size_t clauses() const {
+		return mClauses;
+	}
+	/// Returns the size of the file in bytes.
+	std::size_t bytes() const {
+		return mFile.size();
+	}
+
+	/**
+	 * Reads the next clause into literals, where variables are numbered from one and negative numbers denote negated variables.
+	 * Headers and comments are processed on the way.
+	 * @return false, if a reset line or the end of the file was reached instead.
+	 */
+	bool next_clause(std::vector<long long>& literals);
+};
+
+}
@@ -0,0 +1,78 @@
+#include "MappedFile.h"
+
+#include <carl-logging/carl-logging.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CARL_IO_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace carl::io {
+
+MappedFile::MappedFile(const std::string& filename) {
+#ifdef CARL_IO_USE_MMAP
+	int fd = ::open(filename.c_str(), O_RDONLY);
+	if (fd >= 0) {
+		struct stat st;
+		if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+			void* data = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			if (data != MAP_FAILED) {
+				::madvise(data, static_cast<std::size_t>(st.st_size), MADV_SEQUENTIAL);
+				mData = static_cast<const char*>(data);
+				mSize = static_cast<std::size_t>(st.st_size);
+				mMapped = true;
+				mOpen = true;
+			}
+		}
+		::close(fd);
+		if (mMapped) return;
+	}
+#endif
+	std::ifstream in(filename, std::ios::binary);
+	if (!in) {
+		CARL_LOG_ERROR("carl.io", "Could not open file " << filename);
+		return;
+	}
+	mBuffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+	mData = mBuffer.data();
+	mSize = mBuffer.size();
+	mOpen = true;
+}
+
+MappedFile::~MappedFile() {
+#ifdef CARL_IO_USE_MMAP
+	if (mMapped) {
+		::munmap(const_cast<char*>(mData), mSize);
+	}
+#endif
+}
+
+std::size_t MappedScanner::line() const {
+	return static_cast<std::size_t>(std::count(mBegin, mPos, '\n')) + 1;
+}
+
+std::string_view MappedScanner::read_identifier() {
+	auto is_alpha = [](char c){ return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); };
+	const char* start = mPos;
+	if (mPos == mEnd || !is_alpha(*mPos)) return std::string_view();
+	while (mPos != mEnd && (is_alpha(*mPos) || is_digit(*mPos) || *mPos == '_')) ++mPos;
+	return std::string_view(start, static_cast<std::size_t>(mPos - start));
+}
+
+std::string_view MappedScanner::read_line() {
+	const char* start = mPos;
+	while (mPos != mEnd && *mPos != '\n') ++mPos;
+	const char* stop = mPos;
+	if (mPos != mEnd) ++mPos;
+	if (stop != start && *(stop - 1) == '\r') --stop;
+	return std::string_view(start, static_cast<std::size_t>(stop - start));
+}
+
+}
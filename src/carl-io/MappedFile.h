@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace carl::io {
+
+/**
+ * Read-only view of a whole file.
+ *
+ * The file is mapped into memory if the platform supports it, such that parsers can work on its contents without copying.
+ * Otherwise, or if mapping fails (e.g. for pipes), the file is read into a buffer.
+ */
+class MappedFile {
+private:
+	const char* mData = nullptr;
+	std::size_t mSize = 0;
+	/// Whether mData was obtained from mmap.
+	bool mMapped = false;
+	/// Whether the file could be opened.
+	bool mOpen = false;
+	/// Contents of the file, if it was not mapped.
+	std::string mBuffer;
+public:
+	/// Maps the given file.
+	explicit MappedFile(const std::string& filename);
+	~MappedFile();
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	/// Checks whether the file could be opened.
+	bool is_open() const {
+		return mOpen;
+	}
+	/// Returns the first character of the file.
+	const char* begin() const {
+		return mData;
+	}
+	/// Returns the past-the-end character of the file.
+	const char* end() const {
+		return mData + mSize;
+	}
+	/// Returns the size of the file in bytes.
+	std::size_t size() const {
+		return mSize;
+	}
+	/// Returns the contents of the file.
+	std::string_view view() const {
+		return std::string_view(mData, mSize);
+	}
+};
+
+/**
+ * Tokenizer working directly on a character buffer, e.g. a MappedFile.
+ * No method allocates memory, words are returned as views into the buffer.
+ */
+class MappedScanner {
+private:
+	const char* mBegin;
+	const char* mPos;
+	const char* mEnd;
+
+	static bool is_digit(char c) {
+		return static_cast<unsigned char>(c - '0') < 10;
+	}
+public:
+	MappedScanner(const char* begin, const char* end): mBegin(begin), mPos(begin), mEnd(end) {}
+	explicit MappedScanner(const MappedFile& file): MappedScanner(file.begin(), file.end()) {}
+
+	/// Checks whether the whole buffer was consumed.
+	bool at_end() const {
+		return mPos == mEnd;
+	}
+	/// Returns the next character, or '\0' at the end.
+	char peek() const {
+		return mPos == mEnd ? '\0' : *mPos;
+	}
+	/// Returns the number of consumed characters.
+	std::size_t offset() const {
+		return static_cast<std::size_t>(mPos - mBegin);
+	}
+	/// Returns the line number (starting with one) of the current position.
+	std::size_t line() const;
+	/// Returns the current position.
+	const char* position() const {
+		return mPos;
+	}
+	/// Continues at the given position, which must be within the buffer.
+	void seek(const char* pos) {
+		assert(mBegin <= pos && pos <= mEnd);
+		mPos = pos;
+	}
+
+	/// Skips spaces, tabs and line breaks.
+	void skip_space() {
+		while (mPos != mEnd && (*mPos == ' ' || *mPos == '\n' || *mPos == '\t' || *mPos == '\r')) ++mPos;
+	}
+	/// Skips spaces and tabs.
+	void skip_blank() {
+		while (mPos != mEnd && (*mPos == ' ' || *mPos == '\t' || *mPos == '\r')) ++mPos;
+	}
+	/// Skips the rest of the current line, including the line break.
+	void skip_line() {
+		while (mPos != mEnd && *mPos != '\n') ++mPos;
+		if (mPos != mEnd) ++mPos;
+	}
+	/// Consumes the given string, if the input starts with it.
+	bool consume(std::string_view s) {
+		if (static_cast<std::size_t>(mEnd - mPos) < s.size() || std::string_view(mPos, s.size()) != s) return false;
+		mPos += s.size();
+		return true;
+	}
+	/// Consumes and returns the longest sequence of characters satisfying the given predicate.
+	template<typename F>
+	std::string_view read_while(F&& pred) {
+		const char* start = mPos;
+		while (mPos != mEnd && pred(*mPos)) ++mPos;
+		return std::string_view(start, static_cast<std::size_t>(mPos - start));
+	}
+	/// Consumes and returns a word of letters, digits and underscores starting with a letter. Returns an empty view if there is none.
+	std::string_view read_identifier();
+	/// Consumes and returns the rest of the current line without the line break.
+	std::string_view read_line();
+
+	/**
+	 * Consumes an integer with an optional sign.
+	 * Returns false and consumes nothing if there is no integer or it does not fit into T.
+	 */
+	template<typename T>
+	bool read_integer(T& res) {
+		const char* p = mPos;
+		bool negative = false;
+		if (p != mEnd && (*p == '-' || *p == '+')) {
+			negative = (*p == '-');
+			++p;
+		}
+		if (p == mEnd || !is_digit(*p)) return false;
+		using U = std::make_unsigned_t<T>;
+		constexpr U max = static_cast<U>(std::numeric_limits<T>::max());
+		const U limit = negative ? U(max + 1) : max;
+		U value = 0;
+		for (; p != mEnd && is_digit(*p); ++p) {
+			U digit = static_cast<U>(*p - '0');
+			if (value > (limit - digit) / 10) return false;
+			value = static_cast<U>(value * 10 + digit);
+		}
+		res = static_cast<T>(negative ? U(U(0) - value) : value);
+		mPos = p;
+		return true;
+	}
+};
+
+}
@@ -8,6 +8,7 @@
 #include <fstream>
 #include <map>
 #include <optional>
+#include <string>
 #include <tuple>
 #include <vector>
 
@@ -26,12 +27,17 @@ struct OPBFile {
 };
 
 std::optional<OPBFile> parseOPBFile(std::ifstream& in);
+/**
+ * Parses the given OPB file from a memory-mapped buffer using an OPBReader.
+ * @return std::nullopt, if the file could not be opened or parsed.
+ */
+std::optional<OPBFile> parseOPBFile(const std::string& filename);
 
 template<typename Pol>
 class OPBImporter {
 private:
 	using Number = typename UnderlyingNumberType<Pol>::type;
-	std::ifstream mIn;
+	std::string mFilename;
 
 	std::map<carl::Variable, carl::Variable> variableCache; // maps old int variables to bool
 
@@ -54,13 +60,11 @@ private:
 
 public:
 	explicit OPBImporter(const std::string& filename):
-		mIn(filename)
+		mFilename(filename)
 	{}
 	
 	std::optional<std::pair<Formula<Pol>,Pol>> parse() {
-		if (!mIn.is_open()) return std::nullopt;
-
-		auto file = parseOPBFile(mIn);
+		auto file = parseOPBFile(mFilename);
 		if (!file) return std::nullopt;
 		Formulas<Pol> constraints;
 		for (const auto& cons: file->constraints) {
@@ -0,0 +1,89 @@
+#include "OPBReader.h"
+
+#include <carl-logging/carl-logging.h>
+
+namespace carl::io {
+
+OPBReader::OPBReader(const std::string& filename):
+	mFile(filename),
+	mScanner(mFile)
+{
+	skip();
+	if (mScanner.consume("min:")) {
+		if (!parse_polynomial(mObjective)) return;
+		skip();
+		if (!mScanner.consume(";")) fail("\";\"");
+	}
+}
+
+void OPBReader::skip() {
+	while (true) {
+		mScanner.skip_space();
+		if (mScanner.peek() != '*') return;
+		mScanner.skip_line();
+	}
+}
+
+bool OPBReader::fail(const char* expected) {
+	CARL_LOG_ERROR("carl.io.opb", "Failed to parse OPB line " << mScanner.line() << ": expected " << expected << " before \"" << mScanner.read_line() << "\".");
+	mFailed = true;
+	return false;
+}
+
+bool OPBReader::parse_polynomial(OPBPolynomial& poly) {
+	poly.clear();
+	while (true) {
+		skip();
+		int coeff = 0;
+		if (!mScanner.read_integer(coeff)) break;
+		skip();
+		auto name = mScanner.read_identifier();
+		if (name.empty()) return fail("variable");
+		auto it = mVariables.find(name);
+		if (it == mVariables.end()) {
+			it = mVariables.emplace(name, fresh_integer_variable(std::string(name))).first;
+		}
+		poly.emplace_back(coeff, it->second);
+	}
+	if (poly.empty()) return fail("term");
+	return true;
+}
+
+bool OPBReader::parse_relation(Relation& rel) {
+	skip();
+	if (mScanner.consume(">=")) rel = Relation::GEQ;
+	else if (mScanner.consume("<=")) rel = Relation::LEQ;
+	else if (mScanner.consume("!=")) rel = Relation::NEQ;
+	else if (mScanner.consume("=")) rel = Relation::EQ;
+	else if (mScanner.consume(">")) rel = Relation::GREATER;
+	else if (mScanner.consume("<")) rel = Relation::LESS;
+	else return fail("relation");
+	return true;
+}
+
+bool OPBReader::next(OPBConstraint& constraint) {
+	if (mFailed) return false;
+	skip();
+	if (mScanner.at_end()) return false;
+	if (!parse_polynomial(std::get<0>(constraint))) return false;
+	if (!parse_relation(std::get<1>(constraint))) return false;
+	skip();
+	if (!mScanner.read_integer(std::get<2>(constraint))) return fail("integer");
+	skip();
+	if (!mScanner.consume(";")) return fail("\";\"");
+	return true;
+}
+
+std::optional<OPBFile> parseOPBFile(const std::string& filename) {
+	OPBReader reader(filename);
+	if (!reader.is_open() || reader.failed()) return std::nullopt;
+	OPBFile res(reader.objective());
+	OPBConstraint cons;
+	while (reader.next(cons)) {
+		res.constraints.push_back(cons);
+	}
+	if (reader.failed()) return std::nullopt;
+	return res;
+}
+
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "MappedFile.h"
+#include "OPBImporter.h"
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace carl::io {
+
+/**
+ * Streaming reader for the OPB format working on a memory-mapped file.
+ *
+ * Accepts the same input as parseOPBFile(std::ifstream&): an optional objective "min: <terms> ;" followed by constraints "<terms> <relation> <integer> ;", where every term is an integer followed by a variable name.
+ * Lines starting with "*" are comments.
+ * Constraints are returned one by one, variable names are looked up as views into the mapped file.
+ */
+class OPBReader {
+private:
+	MappedFile mFile;
+	MappedScanner mScanner;
+	std::unordered_map<std::string_view, Variable> mVariables;
+	OPBPolynomial mObjective;
+	/// Set if the input could not be parsed.
+	bool mFailed = false;
+
+	void skip();
+	bool fail(const char* expected);
+	bool parse_polynomial(OPBPolynomial& poly);
+	bool parse_relation(Relation& rel);
+public:
+	/// Maps the given file and reads the objective.
+	explicit OPBReader(const std::string& filename);
+
+	/// Checks whether the file could be opened.
+	bool is_open() const {
+		return mFile.is_open();
+	}
+	/// Checks whether the input could not be parsed.
+	bool failed() const {
+		return mFailed;
+	}
+	/// Returns the size of the file in bytes.
+	std::size_t bytes() const {
+		return mFile.size();
+	}
+	/// Returns the objective, which is empty if there is none.
+	const OPBPolynomial& objective() const {
+		return mObjective;
+	}
+	/**
+	 * Reads the next constraint.
+	 * @return false, if the end of the file was reached or the input could not be parsed.
+	 */
+	bool next(OPBConstraint& constraint);
+};
+
+}
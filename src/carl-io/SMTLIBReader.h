@@ -0,0 +1,570 @@
+#pragma once
+
+#include "MappedFile.h"
+
+#include <carl-formula/formula/Formula.h>
+#include <carl-logging/carl-logging.h>
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace carl::io {
+
+/**
+ * Incremental reader for SMT-LIB2 scripts over Bool, Real and Int.
+ *
+ * Commands are read one at a time by next(), directly from a memory-mapped file or from a buffer filled from a stream.
+ * Supported are declare-fun and declare-const (without arguments), define-fun, assert, push, pop, check-sat and exit; other commands are skipped.
+ * Terms may use let, annotations, the boolean connectives, ite, arithmetic and comparisons.
+ *
+ * Formulas are built directly via the pools. let and nullary define-fun bindings refer to the already built formula or polynomial, hence shared subterms are never expanded again.
+ * Arithmetic ite terms are replaced by fresh variables whose definitions are added to the assertion containing them.
+ * If a nullary define-fun introduces such definitions, they are asserted on the current level and the command is reported as an assertion.
+ * Functions with arguments are expanded in the scope of their definition.
+ * Terms are parsed with an explicit stack, such that deeply nested terms do not exhaust the call stack.
+ * Symbols are stored as views into the input, hence the input is kept alive as long as the reader.
+ */
+template<typename Pol>
+class SMTLIBReader {
+public:
+	enum class CommandType { Assert, Push, Pop, CheckSat, Exit, Other };
+	/// A command that was read.
+	struct Command {
+		CommandType type;
+		/// The name of the command.
+		std::string_view name;
+		/// The asserted formula for assert, or the definitions of fresh variables for a define-fun that introduces them.
+		Formula<Pol> formula;
+		/// The number of levels for push and pop.
+		std::size_t levels = 0;
+	};
+private:
+	using Number = typename UnderlyingNumberType<Pol>::type;
+	using Value = std::variant<Formula<Pol>, Pol>;
+	/// A function defined with arguments, which is expanded by parsing its body for every application.
+	struct Function {
+		std::vector<std::string_view> params;
+		const char* body;
+		/// Size of mTrail when the function was defined, the body only sees the bindings up to here and the parameters.
+		std::size_t scope;
+	};
+	using Symbol = std::variant<Formula<Pol>, Pol, Function>;
+
+	enum class FrameType { Apply, LetBindings, LetBody, Annotation, Call };
+	/// An open subterm while parsing a term.
+	struct Frame {
+		FrameType type;
+		/// The function symbol for Apply.
+		std::string_view head;
+		/// The parsed arguments for Apply.
+		std::vector<Value> args;
+		/// The parsed bindings for LetBindings.
+		std::vector<std::pair<std::string_view, Value>> bindings;
+		/// The name of the binding that is currently parsed for LetBindings.
+		std::string_view binding;
+		/// Size of mTrail before the bindings of LetBody or Call.
+		std::size_t mark = 0;
+		/// The position to continue at after the function body for Call.
+		const char* ret = nullptr;
+		/// The bindings that are not visible in the function body for Call, which are restored afterwards.
+		std::vector<std::pair<std::string_view, Symbol>> hidden;
+	};
+
+	std::optional<MappedFile> mFile;
+	std::string mBuffer;
+	MappedScanner mScanner;
+
+	/// The bindings of every symbol, the innermost comes last.
+	std::unordered_map<std::string_view, std::vector<Symbol>> mSymbols;
+	/// The symbols in the order they were bound.
+	std::vector<std::string_view> mTrail;
+	/// Sizes of mTrail at every push.
+	std::vector<std::size_t> mTrailMarks;
+	/// Assertions of every push level.
+	std::vector<Formulas<Pol>> mAssertions = std::vector<Formulas<Pol>>(1);
+	/// Definitions of fresh variables introduced for ite terms by the current command.
+	Formulas<Pol> mDefinitions;
+	bool mFailed = false;
+	bool mExited = false;
+
+	std::nullopt_t fail(const std::string& msg) {
+		CARL_LOG_ERROR("carl.io.smtlib", "Failed to parse SMT-LIB in line " << mScanner.line() << ": " << msg << " before \"" << mScanner.read_line() << "\".");
+		mFailed = true;
+		return std::nullopt;
+	}
+
+	static bool is_symbol_char(char c) {
+		return !(c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '(' || c == ')' || c == '|' || c == '"' || c == ';');
+	}
+	/// Skips whitespace and comments.
+	void skip() {
+		while (true) {
+			mScanner.skip_space();
+			if (mScanner.peek() != ';') return;
+			mScanner.skip_line();
+		}
+	}
+	bool expect(std::string_view s) {
+		skip();
+		if (mScanner.consume(s)) return true;
+		fail("expected \"" + std::string(s) + "\"");
+		return false;
+	}
+	/// Reads a simple or quoted symbol, or a keyword.
+	std::string_view read_symbol() {
+		skip();
+		if (mScanner.consume("|")) {
+			auto res = mScanner.read_while([](char c){ return c != '|'; });
+			mScanner.consume("|");
+			return res;
+		}
+		return mScanner.read_while(is_symbol_char);
+	}
+	/// Skips a single token that is not a parenthesis.
+	void skip_token() {
+		if (mScanner.consume("\"")) {
+			// Quotes are escaped by doubling them.
+			do {
+				mScanner.read_while([](char c){ return c != '"'; });
+			} while (mScanner.consume("\"") && mScanner.consume("\""));
+		} else if (mScanner.peek() == '|') {
+			read_symbol();
+		} else {
+			mScanner.read_while(is_symbol_char);
+		}
+	}
+	/// Skips everything up to and including the closing parenthesis of the current expression.
+	bool skip_to_close() {
+		std::size_t depth = 0;
+		while (true) {
+			skip();
+			if (mScanner.at_end()) {
+				fail("expected \")\"");
+				return false;
+			}
+			if (mScanner.consume("(")) ++depth;
+			else if (mScanner.consume(")")) {
+				if (depth == 0) return true;
+				--depth;
+			}
+			else skip_token();
+		}
+	}
+	/// Skips a term.
+	bool skip_term() {
+		skip();
+		if (mScanner.consume("(")) return skip_to_close();
+		skip_token();
+		return true;
+	}
+
+	void bind(std::string_view name, Symbol&& s) {
+		mSymbols[name].push_back(std::move(s));
+		mTrail.push_back(name);
+	}
+	/// Removes all bindings after the given size of mTrail.
+	void unbind(std::size_t mark) {
+		while (mTrail.size() > mark) {
+			auto it = mSymbols.find(mTrail.back());
+			it->second.pop_back();
+			if (it->second.empty()) mSymbols.erase(it);
+			mTrail.pop_back();
+		}
+	}
+	/// Removes all bindings after the given size of mTrail and returns them, such that restore() can bind them again.
+	std::vector<std::pair<std::string_view, Symbol>> hide(std::size_t mark) {
+		std::vector<std::pair<std::string_view, Symbol>> hidden;
+		while (mTrail.size() > mark) {
+			auto it = mSymbols.find(mTrail.back());
+			hidden.emplace_back(it->first, std::move(it->second.back()));
+			it->second.pop_back();
+			if (it->second.empty()) mSymbols.erase(it);
+			mTrail.pop_back();
+		}
+		return hidden;
+	}
+	void restore(std::vector<std::pair<std::string_view, Symbol>>& hidden) {
+		for (auto it = hidden.rbegin(); it != hidden.rend(); ++it) {
+			bind(it->first, std::move(it->second));
+		}
+		hidden.clear();
+	}
+	const Symbol* lookup(std::string_view name) const {
+		auto it = mSymbols.find(name);
+		if (it == mSymbols.end()) return nullptr;
+		return &it->second.back();
+	}
+
+	bool declare(std::string_view name) {
+		auto sort = read_symbol();
+		if (sort == "Bool") bind(name, Formula<Pol>(fresh_boolean_variable(std::string(name))));
+		else if (sort == "Real") bind(name, Pol(fresh_real_variable(std::string(name))));
+		else if (sort == "Int") bind(name, Pol(fresh_integer_variable(std::string(name))));
+		else {
+			fail("unsupported sort \"" + std::string(sort) + "\"");
+			return false;
+		}
+		return true;
+	}
+
+	std::optional<Value> parse_atom() {
+		if (static_cast<unsigned char>(mScanner.peek() - '0') < 10) {
+			auto token = mScanner.read_while([](char c){ return static_cast<unsigned char>(c - '0') < 10 || c == '.'; });
+			Number n;
+			if (!try_parse(std::string(token), n)) return fail("invalid number \"" + std::string(token) + "\"");
+			return Value(Pol(n));
+		}
+		auto name = read_symbol();
+		if (name.empty()) return fail("expected term");
+		if (const Symbol* s = lookup(name)) {
+			if (const auto* f = std::get_if<Formula<Pol>>(s)) return Value(*f);
+			if (const auto* p = std::get_if<Pol>(s)) return Value(*p);
+			return fail("function \"" + std::string(name) + "\" without arguments");
+		}
+		if (name == "true") return Value(Formula<Pol>(TRUE));
+		if (name == "false") return Value(Formula<Pol>(FALSE));
+		return fail("unknown symbol \"" + std::string(name) + "\"");
+	}
+
+	std::optional<Value> apply(std::string_view head, std::vector<Value>& args) {
+		bool polys = std::all_of(args.begin(), args.end(), [](const auto& v){ return std::holds_alternative<Pol>(v); });
+		bool formulas = std::all_of(args.begin(), args.end(), [](const auto& v){ return std::holds_alternative<Formula<Pol>>(v); });
+		auto poly = [&args](std::size_t i) -> Pol& { return std::get<Pol>(args[i]); };
+		auto formula = [&args](std::size_t i) -> Formula<Pol>& { return std::get<Formula<Pol>>(args[i]); };
+		auto all_formulas = [&args]() {
+			Formulas<Pol> res;
+			res.reserve(args.size());
+			for (auto& a: args) res.push_back(std::move(std::get<Formula<Pol>>(a)));
+			return res;
+		};
+		auto chain = [&](Relation rel) {
+			Formulas<Pol> res;
+			for (std::size_t i = 1; i < args.size(); ++i) {
+				res.emplace_back(poly(i-1) - poly(i), rel);
+			}
+			return Value(Formula<Pol>(AND, std::move(res)));
+		};
+		if (args.empty()) return fail("no arguments for \"" + std::string(head) + "\"");
+		if (polys) {
+			if (head == "+" || head == "-" || head == "*") {
+				if (head == "-" && args.size() == 1) return Value(-poly(0));
+				Pol res = std::move(poly(0));
+				for (std::size_t i = 1; i < args.size(); ++i) {
+					if (head == "+") res += poly(i);
+					else if (head == "-") res -= poly(i);
+					else res *= poly(i);
+				}
+				return Value(std::move(res));
+			}
+			if (head == "/") {
+				Pol res = std::move(poly(0));
+				for (std::size_t i = 1; i < args.size(); ++i) {
+					if (!poly(i).is_constant() || is_zero(poly(i))) return fail("division by a non-constant term");
+					res *= Number(1) / poly(i).constant_part();
+				}
+				return Value(std::move(res));
+			}
+			if (head == "to_real" && args.size() == 1) return Value(std::move(poly(0)));
+			if (args.size() < 2) return fail("too few arguments for \"" + std::string(head) + "\"");
+			if (head == "<=") return chain(Relation::LEQ);
+			if (head == "<") return chain(Relation::LESS);
+			if (head == ">=") return chain(Relation::GEQ);
+			if (head == ">") return chain(Relation::GREATER);
+			if (head == "=") return chain(Relation::EQ);
+			if (head == "distinct") {
+				Formulas<Pol> res;
+				for (std::size_t i = 0; i < args.size(); ++i) {
+					for (std::size_t j = i + 1; j < args.size(); ++j) {
+						res.emplace_back(poly(i) - poly(j), Relation::NEQ);
+					}
+				}
+				return Value(Formula<Pol>(AND, std::move(res)));
+			}
+		}
+		if (formulas) {
+			if (head == "not" && args.size() == 1) return Value(Formula<Pol>(NOT, formula(0)));
+			if (head == "and") return Value(Formula<Pol>(AND, all_formulas()));
+			if (head == "or") return Value(Formula<Pol>(OR, all_formulas()));
+			if (head == "xor") return Value(Formula<Pol>(XOR, all_formulas()));
+			if (head == "=>") {
+				Formula<Pol> res = formula(args.size() - 1);
+				for (std::size_t i = args.size() - 1; i > 0; --i) {
+					res = Formula<Pol>(IMPLIES, formula(i-1), res);
+				}
+				return Value(std::move(res));
+			}
+			if (head == "=" && args.size() >= 2) {
+				Formulas<Pol> res;
+				for (std::size_t i = 1; i < args.size(); ++i) {
+					res.emplace_back(IFF, Formulas<Pol>({ formula(i-1), formula(i) }));
+				}
+				return Value(Formula<Pol>(AND, std::move(res)));
+			}
+			if (head == "distinct" && args.size() == 2) return Value(Formula<Pol>(XOR, all_formulas()));
+		}
+		if (head == "ite" && args.size() == 3 && std::holds_alternative<Formula<Pol>>(args[0])) {
+			if (std::holds_alternative<Formula<Pol>>(args[1]) && std::holds_alternative<Formula<Pol>>(args[2])) {
+				return Value(Formula<Pol>(ITE, formula(0), formula(1), formula(2)));
+			}
+			if (std::holds_alternative<Pol>(args[1]) && std::holds_alternative<Pol>(args[2])) {
+				// The fresh variable equals one of the branches, hence it is an integer if both branches are.
+				Pol v(poly(1).integer_valued() && poly(2).integer_valued() ? fresh_integer_variable() : fresh_real_variable());
+				mDefinitions.emplace_back(ITE, formula(0), Formula<Pol>(v - poly(1), Relation::EQ), Formula<Pol>(v - poly(2), Relation::EQ));
+				return Value(std::move(v));
+			}
+		}
+		return fail("unsupported application of \"" + std::string(head) + "\"");
+	}
+
+	/// Parses a term without recursion.
+	std::optional<Value> parse_term() {
+		std::vector<Frame> stack;
+		std::optional<Value> result;
+		bool need_term = true;
+		while (true) {
+			if (result) {
+				if (stack.empty()) return result;
+				Frame& f = stack.back();
+				switch (f.type) {
+					case FrameType::Apply:
+						f.args.push_back(std::move(*result));
+						break;
+					case FrameType::LetBindings:
+						f.bindings.emplace_back(f.binding, std::move(*result));
+						if (!expect(")")) return std::nullopt;
+						break;
+					case FrameType::LetBody:
+						if (!expect(")")) return std::nullopt;
+						unbind(f.mark);
+						stack.pop_back();
+						continue;
+					case FrameType::Annotation:
+						if (!skip_to_close()) return std::nullopt;
+						stack.pop_back();
+						continue;
+					case FrameType::Call:
+						mScanner.seek(f.ret);
+						unbind(f.mark);
+						restore(f.hidden);
+						stack.pop_back();
+						continue;
+				}
+				result.reset();
+				need_term = false;
+			}
+			if (!need_term) {
+				Frame& f = stack.back();
+				skip();
+				if (f.type == FrameType::Apply) {
+					if (mScanner.consume(")")) {
+						const Symbol* s = lookup(f.head);
+						if (const auto* fun = (s == nullptr ? nullptr : std::get_if<Function>(s))) {
+							if (fun->params.size() != f.args.size()) return fail("wrong number of arguments for \"" + std::string(f.head) + "\"");
+							auto params = fun->params;
+							const char* body = fun->body;
+							// The body is parsed in the scope of the definition, hence later bindings like those of an enclosing let are hidden.
+							auto hidden = hide(fun->scope);
+							Frame call{ FrameType::Call, f.head, {}, {}, {}, mTrail.size(), mScanner.position(), std::move(hidden) };
+							for (std::size_t i = 0; i < f.args.size(); ++i) {
+								std::string_view param = params[i];
+								std::visit([this, param](auto&& v){ bind(param, Symbol(std::move(v))); }, std::move(f.args[i]));
+							}
+							stack.back() = std::move(call);
+							mScanner.seek(body);
+							need_term = true;
+							continue;
+						}
+						result = apply(f.head, f.args);
+						if (!result) return std::nullopt;
+						stack.pop_back();
+						continue;
+					}
+					need_term = true;
+				} else if (f.type == FrameType::LetBindings) {
+					if (mScanner.consume(")")) {
+						f.mark = mTrail.size();
+						for (auto& b: f.bindings) {
+							std::visit([this, &b](auto&& v){ bind(b.first, Symbol(std::move(v))); }, std::move(b.second));
+						}
+						f.bindings.clear();
+						f.type = FrameType::LetBody;
+						need_term = true;
+						continue;
+					}
+					if (!expect("(")) return std::nullopt;
+					f.binding = read_symbol();
+					if (f.binding.empty()) return fail("expected symbol");
+					need_term = true;
+					continue;
+				}
+			}
+			need_term = false;
+			skip();
+			if (mScanner.consume("(")) {
+				auto head = read_symbol();
+				if (head.empty()) return fail("expected function symbol");
+				if (head == "let") {
+					if (!expect("(")) return std::nullopt;
+					stack.push_back(Frame{ FrameType::LetBindings, head, {}, {}, {}, 0, nullptr, {} });
+				} else if (head == "!") {
+					stack.push_back(Frame{ FrameType::Annotation, head, {}, {}, {}, 0, nullptr, {} });
+					need_term = true;
+				} else {
+					stack.push_back(Frame{ FrameType::Apply, head, {}, {}, {}, 0, nullptr, {} });
+				}
+				continue;
+			}
+			result = parse_atom();
+			if (!result) return std::nullopt;
+		}
+	}
+
+	std::optional<Formula<Pol>> parse_formula() {
+		auto v = parse_term();
+		if (!v) return std::nullopt;
+		if (!std::holds_alternative<Formula<Pol>>(*v)) return fail("expected boolean term");
+		return std::get<Formula<Pol>>(std::move(*v));
+	}
+
+	std::size_t read_levels() {
+		skip();
+		std::size_t levels = 1;
+		mScanner.read_integer(levels);
+		return levels;
+	}
+
+	bool define_fun(std::string_view name) {
+		if (!expect("(")) return false;
+		std::vector<std::string_view> params;
+		while (true) {
+			skip();
+			if (mScanner.consume(")")) break;
+			if (!expect("(")) return false;
+			params.push_back(read_symbol());
+			read_symbol();
+			if (!expect(")")) return false;
+		}
+		read_symbol();
+		if (params.empty()) {
+			auto v = parse_term();
+			if (!v) return false;
+			std::visit([this, name](auto&& val){ bind(name, Symbol(std::move(val))); }, std::move(*v));
+			return true;
+		}
+		skip();
+		Function fun{ std::move(params), mScanner.position(), mTrail.size() };
+		if (!skip_term()) return false;
+		bind(name, Symbol(std::move(fun)));
+		return true;
+	}
+
+public:
+	/// Reads from the given file, which is mapped into memory.
+	explicit SMTLIBReader(const std::string& filename):
+		mFile(std::in_place, filename),
+		mScanner(*mFile)
+	{
+		if (!mFile->is_open()) mFailed = true;
+	}
+	/// Reads from the given stream, which is read into a buffer.
+	explicit SMTLIBReader(std::istream& in):
+		mBuffer(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()),
+		mScanner(mBuffer.data(), mBuffer.data() + mBuffer.size())
+	{}
+	SMTLIBReader(const SMTLIBReader&) = delete;
+	SMTLIBReader& operator=(const SMTLIBReader&) = delete;
+
+	/// Checks whether the input could not be read or parsed.
+	bool failed() const {
+		return mFailed;
+	}
+	/// Returns the current number of push levels.
+	std::size_t level() const {
+		return mAssertions.size() - 1;
+	}
+	/// Returns the conjunction of all assertions on the current assertion stack.
+	Formula<Pol> formula() const {
+		Formulas<Pol> res;
+		for (const auto& level: mAssertions) {
+			res.insert(res.end(), level.begin(), level.end());
+		}
+		return Formula<Pol>(AND, std::move(res));
+	}
+
+	/**
+	 * Reads and executes the next command.
+	 * @return std::nullopt, if the end of the input or an exit command was reached, or the input could not be parsed.
+	 */
+	std::optional<Command> next() {
+		if (mFailed || mExited) return std::nullopt;
+		skip();
+		if (mScanner.at_end()) return std::nullopt;
+		if (!expect("(")) return std::nullopt;
+		Command cmd{ CommandType::Other, read_symbol(), Formula<Pol>(TRUE), 0 };
+		if (cmd.name == "assert") {
+			auto f = parse_formula();
+			if (!f) return std::nullopt;
+			if (!mDefinitions.empty()) {
+				mDefinitions.push_back(std::move(*f));
+				f = Formula<Pol>(AND, std::move(mDefinitions));
+				mDefinitions.clear();
+			}
+			mAssertions.back().push_back(*f);
+			cmd.type = CommandType::Assert;
+			cmd.formula = std::move(*f);
+		} else if (cmd.name == "declare-fun") {
+			auto name = read_symbol();
+			if (!expect("(")) return std::nullopt;
+			skip();
+			if (!mScanner.consume(")")) return fail("functions with arguments are not supported");
+			if (!declare(name)) return std::nullopt;
+		} else if (cmd.name == "declare-const") {
+			if (!declare(read_symbol())) return std::nullopt;
+		} else if (cmd.name == "define-fun") {
+			if (!define_fun(read_symbol())) return std::nullopt;
+			if (!mDefinitions.empty()) {
+				// The defined symbol may be used after the next assertion was popped, hence the definitions belong to the current level.
+				cmd.type = CommandType::Assert;
+				cmd.formula = Formula<Pol>(AND, std::move(mDefinitions));
+				mDefinitions.clear();
+				mAssertions.back().push_back(cmd.formula);
+			}
+		} else if (cmd.name == "push") {
+			cmd.type = CommandType::Push;
+			cmd.levels = read_levels();
+			for (std::size_t i = 0; i < cmd.levels; ++i) {
+				mTrailMarks.push_back(mTrail.size());
+				mAssertions.emplace_back();
+			}
+		} else if (cmd.name == "pop") {
+			cmd.type = CommandType::Pop;
+			cmd.levels = read_levels();
+			if (cmd.levels > level()) return fail("pop below the first level");
+			for (std::size_t i = 0; i < cmd.levels; ++i) {
+				unbind(mTrailMarks.back());
+				mTrailMarks.pop_back();
+				mAssertions.pop_back();
+			}
+		} else if (cmd.name == "check-sat") {
+			cmd.type = CommandType::CheckSat;
+		} else if (cmd.name == "exit") {
+			cmd.type = CommandType::Exit;
+			mExited = true;
+		} else {
+			CARL_LOG_DEBUG("carl.io.smtlib", "Skipping command " << cmd.name);
+			if (!skip_to_close()) return std::nullopt;
+			return cmd;
+		}
+		if (!expect(")")) return std::nullopt;
+		return cmd;
+	}
+};
+
+}
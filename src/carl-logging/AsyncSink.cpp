@@ -0,0 +1,80 @@
+#include "AsyncSink.h"
+
+#include <cassert>
+
+namespace carl::logging {
+
+AsyncSink::AsyncSink(std::shared_ptr<Sink> target, std::size_t capacity, Overflow overflow):
+	mTarget(std::move(target)),
+	mBuffer(capacity),
+	mOverflow(overflow)
+{
+	assert(capacity > 0);
+	mWriter = std::thread([this](){ run(); });
+}
+
+AsyncSink::~AsyncSink() {
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStop = true;
+	}
+	mChanged.notify_all();
+	mWriter.join();
+}
+
+void AsyncSink::commit() {
+	std::string record = mRecord.str();
+	mRecord.str(std::string());
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		if (mSize == mBuffer.size()) {
+			if (mOverflow == Overflow::Drop) {
+				++mDropped;
+				return;
+			}
+			mChanged.wait(lock, [this](){ return mSize < mBuffer.size(); });
+		}
+		mBuffer[(mHead + mSize) % mBuffer.size()] = std::move(record);
+		++mSize;
+	}
+	mChanged.notify_all();
+}
+
+void AsyncSink::flush() {
+	std::unique_lock<std::mutex> lock(mMutex);
+	mChanged.wait(lock, [this](){ return mSize == 0 && !mWriting; });
+}
+
+void AsyncSink::run() {
+	std::vector<std::string> batch;
+	while (true) {
+		std::size_t dropped = 0;
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mWriting = false;
+			mChanged.notify_all();
+			mChanged.wait(lock, [this](){ return mSize > 0 || mStop; });
+			if (mSize == 0) return;
+			// Take all queued messages, such that producers are not blocked while writing.
+			batch.clear();
+			for (; mSize > 0; --mSize) {
+				batch.push_back(std::move(mBuffer[mHead]));
+				mHead = (mHead + 1) % mBuffer.size();
+			}
+			std::swap(dropped, mDropped);
+			mWriting = true;
+		}
+		mChanged.notify_all();
+		for (const auto& record: batch) {
+			mTarget->log() << record;
+			mTarget->commit();
+		}
+		if (dropped > 0) {
+			mTarget->log() << "[" << dropped << " log messages dropped]" << std::endl;
+			mTarget->commit();
+		}
+		mTarget->log().flush();
+	}
+}
+
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Sink.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace carl::logging {
+
+/**
+ * Logging sink that hands complete log messages to a background thread, which writes them to another sink.
+ *
+ * Messages are queued in a ring buffer of fixed capacity, hence a logging thread only waits for I/O if the buffer is full and the overflow policy is Block.
+ * With the policy Drop, messages are discarded instead and the number of discarded messages is reported in the log.
+ * log() and commit() are called by the Logger while holding its lock, hence the message that is currently written needs no further synchronization.
+ */
+class AsyncSink final: public Sink {
+public:
+	/// What to do with a message if the buffer is full.
+	enum class Overflow { Block, Drop };
+private:
+	/// The sink that messages are written to.
+	std::shared_ptr<Sink> mTarget;
+	/// The message that is currently written.
+	std::ostringstream mRecord;
+	/// Ring buffer of messages that are not yet written.
+	std::vector<std::string> mBuffer;
+	/// Index of the oldest message in mBuffer.
+	std::size_t mHead = 0;
+	/// Number of messages in mBuffer.
+	std::size_t mSize = 0;
+	Overflow mOverflow;
+	/// Number of dropped messages not yet reported.
+	std::size_t mDropped = 0;
+	/// Whether the writer is currently writing messages.
+	bool mWriting = false;
+	bool mStop = false;
+	std::mutex mMutex;
+	std::condition_variable mChanged;
+	std::thread mWriter;
+
+	void run();
+public:
+	/**
+	 * Create an AsyncSink writing to the given sink.
+	 * @param target Sink to write to.
+	 * @param capacity Maximal number of queued messages.
+	 * @param overflow What to do with messages if capacity messages are queued.
+	 */
+	explicit AsyncSink(std::shared_ptr<Sink> target, std::size_t capacity = 4096, Overflow overflow = Overflow::Block);
+	/// Writes all queued messages and stops the background thread.
+	~AsyncSink() override;
+	AsyncSink(const AsyncSink&) = delete;
+	AsyncSink& operator=(const AsyncSink&) = delete;
+
+	std::ostream& log() noexcept override { return mRecord; }
+	/// Queues the message written to log().
+	void commit() override;
+	/// Waits until all queued messages have been written.
+	void flush();
+};
+
+}
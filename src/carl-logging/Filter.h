@@ -1,11 +1,13 @@
 #pragma once
 
 #include "LogLevel.h"
+#include "logging.h"
 
 #include <cassert>
 #include <iostream>
 #include <map>
 #include <string>
+#include <string_view>
 
 namespace carl::logging {
 
@@ -13,8 +15,8 @@ namespace carl::logging {
  * This class checks if some log message shall be forwarded to some sink.
  */
 class Filter {
-	/// Mapping from channels to (minimal) log levels.
-	std::map<std::string, LogLevel> mData = {
+	/// Mapping from channels to (minimal) log levels. The comparator allows lookups without constructing strings.
+	std::map<std::string, LogLevel, std::less<>> mData = {
 		std::make_pair(std::string(""), LogLevel::LVL_DEFAULT)
 	};
 public:
@@ -33,28 +35,36 @@ public:
 	 */
 	Filter& operator()(const std::string& channel, LogLevel level) {
 		mData[channel] = level;
+		configuration_generation.fetch_add(1, std::memory_order_acq_rel);
 		return *this;
 	}
 	/**
-	 * Checks if the given log level is sufficient for the log message to be forwarded.
+	 * Returns the minimal log level for the given channel, which is inherited from the closest parent channel that has a rule.
 	 * @param channel Channel name.
-	 * @param level LogLevel.
-	 * @return If the message shall be forwarded.
+	 * @return Minimal LogLevel.
 	 */
-	bool check(const std::string& channel, LogLevel level) const noexcept {
-		auto tmp = channel;
-		auto it = mData.find(tmp);
-		while (!tmp.empty() && it == mData.end()) {
-			auto n = tmp.rfind('.');
-			tmp = (n == std::string::npos) ? "" : tmp.substr(0, n);
-			it = mData.find(tmp);
+	LogLevel level(std::string_view channel) const noexcept {
+		auto original = channel;
+		auto it = mData.find(channel);
+		while (!channel.empty() && it == mData.end()) {
+			auto n = channel.rfind('.');
+			channel = (n == std::string_view::npos) ? std::string_view() : channel.substr(0, n);
+			it = mData.find(channel);
 		}
 		if (it == mData.end()) {
-			std::cout << "Did not find something for \"" << channel << "\"" << std::endl;
-			return true;
+			std::cout << "Did not find something for \"" << original << "\"" << std::endl;
+			return LogLevel::LVL_ALL;
 		}
-		assert(it != mData.end());
-		return level >= it->second;
+		return it->second;
+	}
+	/**
+	 * Checks if the given log level is sufficient for the log message to be forwarded.
+	 * @param channel Channel name.
+	 * @param level LogLevel.
+	 * @return If the message shall be forwarded.
+	 */
+	bool check(std::string_view channel, LogLevel level) const noexcept {
+		return level >= this->level(channel);
 	}
 	/**
 	 * Streaming operator for a Filter.
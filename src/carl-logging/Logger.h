@@ -5,10 +5,12 @@
 #include "logging_utils.h"
 #include "config.h"
 
+#include "AsyncSink.h"
 #include "Filter.h"
 #include "Formatter.h"
 #include "Sink.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <fstream>
@@ -31,6 +33,7 @@ namespace carl {
  * 
  * A Sink represents a logging output like a terminal or a log file.
  * This implementation provides a FileSink and a StreamSink, but the basic Sink class can be extended as necessary.
+ * An AsyncSink wraps another Sink and writes to it from a background thread, such that logging threads do not wait for I/O.
  * 
  * A Channel is a string that identifies the context of the log message, usually something like the class name where the log message is emitted.
  * Channels are organized hierarchically where the levels are separated by dots. For example, `carl` is considered the parent of `carl.core`.
@@ -65,6 +68,7 @@ namespace carl {
  * <li>`CARLLOG_ASSERT(channel, condition, msg)` checks the condition and if it fails calls `CARLLOG_FATAL(channel, msg)` and asserts the condition.</li>
  * </ul>
  * Any message (`msg` or `args`) can be an arbitrary expression that one would stream to an `std::ostream` like `stream << (msg);`. No final newline is needed.
+ * Every logging statement caches whether its channel is visible in a CallSite, which is only refreshed when some Filter or Sink changes.
  */
 namespace logging {
 
@@ -96,6 +100,7 @@ public:
 	void configure(const std::string& id, std::shared_ptr<Sink> sink) {
 		std::lock_guard<std::mutex> lock(mMutex);
 		mData[id] = std::make_tuple(std::move(sink), Filter(), std::make_shared<Formatter>());
+		configuration_generation.fetch_add(1, std::memory_order_acq_rel);
 	}
 	/**
 	 * Installs a FileSink.
@@ -160,12 +165,18 @@ public:
 	 * @param channel Channel name.
 	 */
 	bool visible(LogLevel level, const std::string& channel) const noexcept {
+		return level >= threshold(channel);
+	}
+	/**
+	 * Returns the smallest LogLevel that is visible for some sink.
+	 * @param channel Channel name.
+	 */
+	LogLevel threshold(std::string_view channel) const noexcept {
+		LogLevel res = LogLevel::LVL_OFF;
 		for (const auto& t: mData) {
-			if (std::get<1>(t.second).check(channel, level)) {
-				return true;
-			}
+			res = std::min(res, std::get<1>(t.second).level(channel));
 		}
-		return false;
+		return res;
 	}
 	/**
 	 * Logs a message.
@@ -181,6 +192,7 @@ public:
 			std::get<2>(t.second)->prefix(std::get<0>(t.second)->log(), channel, level, info);
 			std::get<0>(t.second)->log() << ss.str();
 			std::get<2>(t.second)->suffix(std::get<0>(t.second)->log());
+			std::get<0>(t.second)->commit();
 		}
 	}
 };
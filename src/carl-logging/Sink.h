@@ -10,12 +10,18 @@ namespace carl::logging {
  */
 class Sink {
 public:
+	virtual ~Sink() = default;
 	/**
 	 * Abstract logging interface.
 	 * The intended usage is to write any log output to the output stream returned by this function.
 	 * @return Output stream.
 	 */
 	virtual std::ostream& log() noexcept = 0;
+	/**
+	 * Called after a complete log message has been written to log().
+	 * Sinks that buffer messages can hand them on here.
+	 */
+	virtual void commit() {}
 };
 /**
  * Logging sink that wraps an arbitrary `std::ostream`.
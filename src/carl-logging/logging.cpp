@@ -4,10 +4,16 @@
 
 namespace carl::logging {
 
+std::atomic<std::size_t> configuration_generation = 1;
+
 bool visible(LogLevel level, const std::string& channel) noexcept {
 	return Logger::getInstance().visible(level, channel);
 }
 
+LogLevel threshold(std::string_view channel) noexcept {
+	return Logger::getInstance().threshold(channel);
+}
+
 void log(LogLevel level, const std::string& channel, const std::stringstream& ss, const RecordInfo& info) {
 	Logger::getInstance().log(level, channel, ss, info);
 }
@@ -2,8 +2,10 @@
 
 #include "LogLevel.h"
 
+#include <atomic>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 namespace carl::logging {
 
@@ -21,6 +23,54 @@ struct RecordInfo {
 
 bool visible(LogLevel level, const std::string& channel) noexcept;
 void log(LogLevel level, const std::string& channel, const std::stringstream& ss, const RecordInfo& info);
+/// Returns the smallest LogLevel that is visible for the given channel on some sink.
+LogLevel threshold(std::string_view channel) noexcept;
+
+/**
+ * Incremented whenever a filter or a sink changes.
+ * Starts at one, such that a CallSite that never resolved its channel is outdated.
+ */
+extern std::atomic<std::size_t> configuration_generation;
+
+/**
+ * Caches the visibility of the log messages of a single logging statement.
+ * 
+ * The threshold of the channel is only resolved by the Logger if the configuration changed since the last call, which is detected by comparing with configuration_generation.
+ * Otherwise, checking the visibility is a comparison of two LogLevels.
+ * Only string literals are cached, keyed on their address, as their content never changes.
+ * Any other channel, for example a std::string or a pointer to a buffer that may be reused, is resolved on every call.
+ */
+class CallSite {
+	std::atomic<std::size_t> mGeneration = 0;
+	std::atomic<LogLevel> mThreshold = LogLevel::LVL_OFF;
+	std::atomic<const char*> mChannel = nullptr;
+public:
+	/**
+	 * Checks whether a log message would be visible for some sink, using the cache.
+	 * @param level LogLevel.
+	 * @param channel Channel name, which must be a string literal.
+	 */
+	template<std::size_t N>
+	bool visible(LogLevel level, const char (&channel)[N]) noexcept {
+		std::size_t generation = configuration_generation.load(std::memory_order_acquire);
+		if (mGeneration.load(std::memory_order_acquire) == generation && mChannel.load(std::memory_order_relaxed) == channel) {
+			return level >= mThreshold.load(std::memory_order_relaxed);
+		}
+		LogLevel t = threshold(channel);
+		mThreshold.store(t, std::memory_order_relaxed);
+		mChannel.store(channel, std::memory_order_relaxed);
+		mGeneration.store(generation, std::memory_order_release);
+		return level >= t;
+	}
+	/**
+	 * Checks whether a log message would be visible for some sink, without using the cache.
+	 * @param level LogLevel.
+	 * @param channel Channel name.
+	 */
+	bool visible(LogLevel level, std::string_view channel) noexcept {
+		return level >= threshold(channel);
+	}
+};
 
 }
 
@@ -32,15 +82,17 @@ void log(LogLevel level, const std::string& channel, const std::stringstream& ss
 #define __CARL_LOG_RECORD ::carl::logging::RecordInfo{__FILE__, __func__, __LINE__}
 /// Create a record info without function name.
 #define __CARL_LOG_RECORD_NOFUNC ::carl::logging::RecordInfo{__FILE__, "", __LINE__}
-/// Basic logging macro.
+/// Basic logging macro. The visibility is cached per statement.
 #define __CARL_LOG(level, channel, expr) { \
-	if (::carl::logging::visible(level, channel)) { \
+	static ::carl::logging::CallSite __carl_log_site; \
+	if (__carl_log_site.visible(level, channel)) { \
 		std::stringstream __ss; __ss << expr; ::carl::logging::log(level, channel, __ss, __CARL_LOG_RECORD); \
 	}}
 
-/// Basic logging macro without function name.
+/// Basic logging macro without function name. The visibility is cached per statement.
 #define __CARL_LOG_NOFUNC(level, channel, expr) { \
-	if (::carl::logging::visible(level, channel)) { \
+	static ::carl::logging::CallSite __carl_log_site; \
+	if (__carl_log_site.visible(level, channel)) { \
 		std::stringstream __ss; __ss << expr; ::carl::logging::log(level, channel, __ss, __CARL_LOG_RECORD_NOFUNC); \
 	}}
 
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Value.h"
+
+#include <atomic>
+#include <map>
+#include <string>
+
+namespace carl::statistics {
+
+/**
+ * Counts events.
+ * Increments are lock-free and may be done concurrently from several threads.
+ */
+class Counter {
+    std::atomic<std::size_t> m_count = 0;
+
+public:
+    void inc(std::size_t n = 1) {
+        m_count.fetch_add(n, std::memory_order_relaxed);
+    }
+    std::size_t count() const {
+        return m_count.load(std::memory_order_relaxed);
+    }
+
+    /// Adds the count of another counter.
+    void merge(const Counter& other) {
+        inc(other.count());
+    }
+
+    void collect(std::map<std::string, Value>& data, const std::string& key) const {
+        data.emplace(key, count());
+    }
+};
+
+}
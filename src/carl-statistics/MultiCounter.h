@@ -1,29 +1,54 @@
 #pragma once
 
+#include "Serialization.h"
+#include "Value.h"
+
 #include <boost/container/flat_map.hpp>
 
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+
 namespace carl::statistics {
 
+/**
+ * Counts events per key.
+ * Increments lock a mutex, use Sharded<MultiCounter<T>> if several threads increment frequently.
+ */
 template<typename T>
 class MultiCounter {
     boost::container::flat_map<T,std::size_t> m_data;
     std::size_t m_total = 0;
+    mutable std::mutex m_mutex;
 
 public:
     void inc(const T& key, std::size_t inc) {
+        std::lock_guard<std::mutex> lock(m_mutex);
         m_data.try_emplace(key).first->second += inc;
         m_total += inc;
     }
 
-    void collect(std::map<std::string, std::string>& data, const std::string& key) const {
+    /// Adds the counts of another counter.
+    void merge(const MultiCounter& other) {
+        if (&other == this) return;
+        std::scoped_lock lock(m_mutex, other.m_mutex);
+        for (const auto& [k,v] : other.m_data) {
+            m_data.try_emplace(k).first->second += v;
+        }
+        m_total += other.m_total;
+    }
+
+    void collect(std::map<std::string, Value>& data, const std::string& key) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
         std::stringstream ss;
 		for (const auto& [k,v] : m_data) {
             serialize(ss, k);
 			ss << "=" << v << ";";
 		}
         data.emplace(key, ss.str());
-        data.emplace(key + ".total", std::to_string(m_total));
+        data.emplace(key + ".total", m_total);
     }
 };
 
-}
\ No newline at end of file
+}
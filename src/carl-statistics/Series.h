@@ -1,28 +1,66 @@
 #pragma once
 
+#include "Value.h"
+
+#include <atomic>
+#include <limits>
+#include <map>
+#include <string>
+
 namespace carl::statistics {
 
+/**
+ * Accumulates count, sum, minimum and maximum of a series of numbers.
+ * Adding values is lock-free and may be done concurrently from several threads.
+ */
 class Series {
-    std::size_t m_count = 0;
-    std::size_t m_sum = 0;
-    std::size_t m_min = 0;
-    std::size_t m_max = 0;
+    std::atomic<std::size_t> m_count = 0;
+    std::atomic<std::size_t> m_sum = 0;
+    std::atomic<std::size_t> m_min = std::numeric_limits<std::size_t>::max();
+    std::atomic<std::size_t> m_max = 0;
+
+    void add(std::size_t count, std::size_t sum, std::size_t min, std::size_t max) {
+        m_count.fetch_add(count, std::memory_order_relaxed);
+        m_sum.fetch_add(sum, std::memory_order_relaxed);
+        std::size_t cur = m_min.load(std::memory_order_relaxed);
+        while (min < cur && !m_min.compare_exchange_weak(cur, min, std::memory_order_relaxed));
+        cur = m_max.load(std::memory_order_relaxed);
+        while (max > cur && !m_max.compare_exchange_weak(cur, max, std::memory_order_relaxed));
+    }
 
 public:
     void add(std::size_t n) {
-        m_sum += n;
-        m_min = m_count == 0 ? n : std::min(m_min, n);
-        m_max = m_count == 0 ? n : std::max(m_max, n);
-        m_count++;
+        add(1, n, n, n);
+    }
+
+    /// Adds all values of another series.
+    void merge(const Series& other) {
+        if (other.count() == 0) return;
+        add(other.count(), other.sum(), other.min(), other.max());
+    }
+
+    std::size_t count() const {
+        return m_count.load(std::memory_order_relaxed);
+    }
+    std::size_t sum() const {
+        return m_sum.load(std::memory_order_relaxed);
+    }
+    /// Returns the minimum, or zero if the series is empty.
+    std::size_t min() const {
+        return count() == 0 ? 0 : m_min.load(std::memory_order_relaxed);
+    }
+    /// Returns the maximum, or zero if the series is empty.
+    std::size_t max() const {
+        return m_max.load(std::memory_order_relaxed);
     }
 
-    void collect(std::map<std::string, std::string>& data, const std::string& key) const {
-        data.emplace(key+".count", std::to_string(m_count));
-        data.emplace(key+".sum",   std::to_string(m_sum));
-        data.emplace(key+".min",   std::to_string(m_min));
-        data.emplace(key+".max",   std::to_string(m_max));
-        data.emplace(key+".avg",   std::to_string((float)m_sum/(float)m_count));
+    void collect(std::map<std::string, Value>& data, const std::string& key) const {
+        data.emplace(key+".count", count());
+        data.emplace(key+".sum",   sum());
+        data.emplace(key+".min",   min());
+        data.emplace(key+".max",   max());
+        data.emplace(key+".avg",   static_cast<double>(sum())/static_cast<double>(count()));
     }
 };
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Value.h"
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <string>
+
+namespace carl::statistics {
+
+/// Returns a small number identifying the calling thread, assigned in the order in which threads ask for it.
+inline std::size_t thread_index() {
+	static std::atomic<std::size_t> next = 0;
+	thread_local std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+	return index;
+}
+
+/**
+ * Distributes a statistic over several shards to avoid contention if many threads update it.
+ *
+ * Every thread updates the shard local() selected by its thread_index(), each shard lives in its own cache line.
+ * Threads may share a shard, hence T must be safe for concurrent updates itself, like Counter, Series or Timer::finish(start).
+ * The shards are merged into a single value when collected.
+ * T must be default constructible and provide merge() and collect().
+ */
+template<typename T, std::size_t N = 16>
+class Sharded {
+	struct alignas(64) Shard {
+		T value;
+	};
+	std::array<Shard, N> mShards;
+public:
+	/// Returns the shard of the calling thread.
+	T& local() {
+		return mShards[thread_index() % N].value;
+	}
+	/// Merges all shards into the given value.
+	void merge_into(T& res) const {
+		for (const auto& s: mShards) res.merge(s.value);
+	}
+	void collect(std::map<std::string, Value>& data, const std::string& key) const {
+		T res;
+		merge_into(res);
+		res.collect(data, key);
+	}
+};
+
+}
@@ -4,12 +4,16 @@
 #include <sstream>
 #include <algorithm>
 #include <cassert>
+#include <type_traits>
 
 #include "StatisticsCollector.h"
 #include "Serialization.h"
+#include "Value.h"
 #include "Timing.h"
+#include "Counter.h"
 #include "Series.h"
 #include "MultiCounter.h"
+#include "Sharded.h"
 
 namespace carl {
 namespace statistics {
@@ -17,7 +21,7 @@ namespace statistics {
 class Statistics {
 private:
 	std::string mName;
-	std::map<std::string, std::string> mCollected;
+	std::map<std::string, Value> mCollected;
 	bool has_illegal_chars(const std::string& val) const {
 		return std::find_if(val.begin(), val.end(), [](char c) {
 				return c == ':' || c == '(' || c == ')' || std::isspace(static_cast<unsigned char>(c));
@@ -36,6 +40,10 @@ protected:
 		value.collect(mCollected, key);
 	}
 
+	void addKeyValuePair(const std::string& key, const Counter& value) {
+		value.collect(mCollected, key);
+	}
+
 	void addKeyValuePair(const std::string& key, const Series& value) {
 		value.collect(mCollected, key);
 	}
@@ -45,11 +53,25 @@ protected:
 		value.collect(mCollected, key);
 	}
 
+	template<typename T, std::size_t N>
+	void addKeyValuePair(const std::string& key, const Sharded<T,N>& value) {
+		value.collect(mCollected, key);
+	}
+
+	/// Numbers are stored with their type, everything else is serialized to a string.
 	template<typename T>
 	void addKeyValuePair(const std::string& key, const T& value) {
-		std::stringstream ss;
-		serialize(ss, value);
-		mCollected.emplace(key, ss.str());
+		if constexpr (std::is_floating_point_v<T>) {
+			mCollected.emplace(key, static_cast<double>(value));
+		} else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+			mCollected.emplace(key, static_cast<std::int64_t>(value));
+		} else if constexpr (std::is_integral_v<T>) {
+			mCollected.emplace(key, static_cast<std::size_t>(value));
+		} else {
+			std::stringstream ss;
+			serialize(ss, value);
+			mCollected.emplace(key, ss.str());
+		}
 	}
 
 public:
@@ -6,6 +6,7 @@ namespace carl {
 namespace statistics {
 
 void StatisticsCollector::collect() {
+	std::lock_guard<std::mutex> lock(mMutex);
 	for (auto& s: mStatistics) {
 		if (s->enabled()) {
 			s->collect();
@@ -3,6 +3,7 @@
 #include <carl-common/memory/Singleton.h>
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -14,9 +15,12 @@ class Statistics;
 class StatisticsCollector: public carl::Singleton<StatisticsCollector> {
 private:
 	std::vector<std::unique_ptr<Statistics>> mStatistics;
+	std::mutex mMutex;
 public:
+	/// Creates and registers a new statistics object, may be called concurrently.
 	template<typename T>
 	T& get(const std::string& name) {
+		std::lock_guard<std::mutex> lock(mMutex);
 		auto& ptr = mStatistics.emplace_back(std::make_unique<T>());
 		ptr->set_name(name);
 		return static_cast<T&>(*ptr);
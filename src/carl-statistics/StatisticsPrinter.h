@@ -3,16 +3,21 @@
 #include "Statistics.h"
 #include "StatisticsCollector.h"
 
+#include <cmath>
 #include <fstream>
 #include <iostream>
 #include <iomanip>
+#include <type_traits>
+#include <variant>
 
 namespace carl {
 namespace statistics {
 
 enum class StatisticsOutputFormat {
 	SMTLIB,
-	XML
+	XML,
+	JSON,
+	CSV
 };
 
 template<StatisticsOutputFormat SOF>
@@ -22,7 +27,7 @@ template<StatisticsOutputFormat SOF>
 std::ostream& operator<<(std::ostream& os, StatisticsPrinter<SOF>);
 
 template<>
-std::ostream& operator<<(std::ostream& os, StatisticsPrinter<StatisticsOutputFormat::SMTLIB>) {
+inline std::ostream& operator<<(std::ostream& os, StatisticsPrinter<StatisticsOutputFormat::SMTLIB>) {
 	for (const auto& s: StatisticsCollector::getInstance().statistics()) {
 		if (s->collected().empty()) continue;
 		os << "(:" << s->name() << " (" << std::endl;
@@ -31,7 +36,8 @@ std::ostream& operator<<(std::ostream& os, StatisticsPrinter<StatisticsOutputFor
 			max_width = std::max(max_width, kv.first.size());
 		}
 		for (const auto& kv: s->collected()) {
-			os << "\t:" << std::setw(static_cast<int>(max_width)) << std::left << kv.first << " " << kv.second << std::endl;
+			os << "\t:" << std::setw(static_cast<int>(max_width)) << std::left << kv.first << " ";
+			print(os, kv.second) << std::endl;
 		}
 		os << "))" << std::endl;
 	}
@@ -39,7 +45,7 @@ std::ostream& operator<<(std::ostream& os, StatisticsPrinter<StatisticsOutputFor
 }
 
 template<>
-std::ostream& operator<<(std::ostream& os, StatisticsPrinter<StatisticsOutputFormat::XML>) {
+inline std::ostream& operator<<(std::ostream& os, StatisticsPrinter<StatisticsOutputFormat::XML>) {
 	for (const auto& s: StatisticsCollector::getInstance().statistics()) {
 		if (s->collected().empty()) continue;
 		std::string name = s->name();
@@ -47,21 +53,114 @@ std::ostream& operator<<(std::ostream& os, StatisticsPrinter<StatisticsOutputFor
 		std::replace(name.begin(), name.end(), '>', ')');
 		os << "\t<module name=\"" << name << "\">\n"; 
 		for (const auto& kv: s->collected()) {
-			os << "\t\t<stat name=\"" << kv.first << "\" value=\"" << kv.second << "\" />\n";
+			os << "\t\t<stat name=\"" << kv.first << "\" value=\"";
+			print(os, kv.second) << "\" />\n";
 		}
 		os << "\t</module>\n"; 
 	}
 	return os;
 }
 
-auto statistics_as_smtlib() {
+namespace detail {
+	/// Writes a string as JSON string literal.
+	inline void write_json_string(std::ostream& os, const std::string& s) {
+		os << '"';
+		for (char c: s) {
+			switch (c) {
+				case '"': os << "\\\""; break;
+				case '\\': os << "\\\\"; break;
+				case '\n': os << "\\n"; break;
+				case '\t': os << "\\t"; break;
+				default: os << c;
+			}
+		}
+		os << '"';
+	}
+	/// Writes a string as CSV field, quoted only if necessary.
+	inline void write_csv_field(std::ostream& os, const std::string& s) {
+		if (s.find_first_of(",\"\n") == std::string::npos) {
+			os << s;
+			return;
+		}
+		os << '"';
+		for (char c: s) {
+			if (c == '"') os << '"';
+			os << c;
+		}
+		os << '"';
+	}
+}
+
+/**
+ * Writes a single JSON object with one object per statistics module.
+ * Numbers are written as JSON numbers, all other values as strings.
+ */
+template<>
+inline std::ostream& operator<<(std::ostream& os, StatisticsPrinter<StatisticsOutputFormat::JSON>) {
+	os << "{";
+	bool first_module = true;
+	for (const auto& s: StatisticsCollector::getInstance().statistics()) {
+		if (s->collected().empty()) continue;
+		os << (first_module ? "\n\t" : ",\n\t");
+		detail::write_json_string(os, s->name());
+		os << ": {";
+		bool first = true;
+		for (const auto& kv: s->collected()) {
+			os << (first ? "\n\t\t" : ",\n\t\t");
+			detail::write_json_string(os, kv.first);
+			os << ": ";
+			std::visit([&os](const auto& v) {
+				if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::string>) detail::write_json_string(os, v);
+				else if constexpr (std::is_floating_point_v<std::decay_t<decltype(v)>>) {
+					// JSON has no representation for nan or infinity.
+					if (std::isfinite(v)) os << v; else os << "null";
+				}
+				else os << v;
+			}, kv.second);
+			first = false;
+		}
+		os << "\n\t}";
+		first_module = false;
+	}
+	os << "\n}" << std::endl;
+	return os;
+}
+
+/**
+ * Writes one line per value with the columns module, key, type and value.
+ * The type is one of unsigned, signed, double or string.
+ */
+template<>
+inline std::ostream& operator<<(std::ostream& os, StatisticsPrinter<StatisticsOutputFormat::CSV>) {
+	static const char* types[] = { "unsigned", "signed", "double", "string" };
+	os << "module,key,type,value\n";
+	for (const auto& s: StatisticsCollector::getInstance().statistics()) {
+		for (const auto& kv: s->collected()) {
+			detail::write_csv_field(os, s->name());
+			os << ",";
+			detail::write_csv_field(os, kv.first);
+			os << "," << types[kv.second.index()] << ",";
+			detail::write_csv_field(os, to_string(kv.second));
+			os << "\n";
+		}
+	}
+	return os;
+}
+
+inline auto statistics_as_smtlib() {
 	return StatisticsPrinter<StatisticsOutputFormat::SMTLIB>();
 }
-auto statistics_as_xml() {
+inline auto statistics_as_xml() {
 	return StatisticsPrinter<StatisticsOutputFormat::XML>();
 }
+inline auto statistics_as_json() {
+	return StatisticsPrinter<StatisticsOutputFormat::JSON>();
+}
+inline auto statistics_as_csv() {
+	return StatisticsPrinter<StatisticsOutputFormat::CSV>();
+}
 
-void statistics_to_xml_file(const std::string& filename) {
+inline void statistics_to_xml_file(const std::string& filename) {
 	std::ofstream file;
 	file.open(filename, std::ios::out);
 	file << "<runtimestats>" << std::endl;
@@ -70,6 +169,16 @@ void statistics_to_xml_file(const std::string& filename) {
 	file.close();
 }
 
+inline void statistics_to_json_file(const std::string& filename) {
+	std::ofstream file(filename, std::ios::out);
+	file << statistics_as_json();
+}
+
+inline void statistics_to_csv_file(const std::string& filename) {
+	std::ofstream file(filename, std::ios::out);
+	file << statistics_as_csv();
+}
+
 
 }
 }
\ No newline at end of file
@@ -1,6 +1,11 @@
 #pragma once
 
+#include "Value.h"
+
+#include <atomic>
 #include <chrono>
+#include <map>
+#include <string>
 
 namespace carl {
 namespace statistics {
@@ -27,9 +32,15 @@ inline auto zero() {
 }
 } // namespace timing
 
+/**
+ * Accumulates the number and the overall duration of timed sections.
+ *
+ * start() and finish(start) may be used concurrently from several threads.
+ * start_this() and finish() keep a single running section and are meant for a single thread.
+ */
 class Timer {
-    std::size_t m_count = 0;
-    timing::duration m_overall = timing::zero();
+    std::atomic<std::size_t> m_count = 0;
+    std::atomic<timing::duration::rep> m_overall = 0;
     timing::time_point m_current_start = timing::time_point::min();
 
 public:
@@ -37,8 +48,8 @@ public:
         return timing::now();
     }
     void finish(timing::time_point start) {
-        ++m_count;
-        m_overall += timing::since(start);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_overall.fetch_add(timing::since(start).count(), std::memory_order_relaxed);
     }
     void start_this() {
         m_current_start = start();
@@ -55,21 +66,27 @@ public:
         return false;
     }
     auto count() const {
-        return m_count;
+        return m_count.load(std::memory_order_relaxed);
+    }
+    auto overall_us() const {
+        return m_overall.load(std::memory_order_relaxed);
     }
     auto overall_ms() const {
-        return m_overall.count()/1000;
+        return overall_us()/1000;
     }
-    auto overall_us() const {
-        return m_overall.count();
+
+    /// Adds the sections of another timer, a running section of the other timer is ignored.
+    void merge(const Timer& other) {
+        m_count.fetch_add(other.count(), std::memory_order_relaxed);
+        m_overall.fetch_add(other.overall_us(), std::memory_order_relaxed);
     }
 
-    void collect(std::map<std::string, std::string>& data, const std::string& key) {
+    void collect(std::map<std::string, Value>& data, const std::string& key) {
         bool active_at_timeout = check_finish();
-        data.emplace(key + ".count", std::to_string(count()));
-        data.emplace(key + ".overall_ms", std::to_string(overall_ms()));
-        data.emplace(key + ".overall_µs", std::to_string(overall_us()));
-        data.emplace(key + ".active_at_timeout", active_at_timeout ? "1" : "0");
+        data.emplace(key + ".count", count());
+        data.emplace(key + ".overall_ms", overall_ms());
+        data.emplace(key + ".overall_µs", overall_us());
+        data.emplace(key + ".active_at_timeout", std::size_t(active_at_timeout ? 1 : 0));
     }
 };
 
@@ -0,0 +1,80 @@
+#include "Tracing.h"
+
+#include <fstream>
+
+namespace carl::statistics::tracing {
+
+namespace {
+	/// Writes a string as JSON string literal.
+	void write_json_string(std::ostream& os, const char* s) {
+		os << '"';
+		for (; *s != '\0'; ++s) {
+			switch (*s) {
+				case '"': os << "\\\""; break;
+				case '\\': os << "\\\\"; break;
+				case '\n': os << "\\n"; break;
+				case '\t': os << "\\t"; break;
+				default: os << *s;
+			}
+		}
+		os << '"';
+	}
+	/// Writes nanoseconds as microseconds with three decimal places.
+	void write_microseconds(std::ostream& os, std::uint64_t ns) {
+		auto frac = ns % 1000;
+		os << ns / 1000 << '.' << static_cast<char>('0' + frac / 100) << static_cast<char>('0' + frac / 10 % 10) << static_cast<char>('0' + frac % 10);
+	}
+}
+
+std::size_t Tracer::size() const {
+	std::lock_guard<std::mutex> lock(mMutex);
+	std::size_t res = 0;
+	for (const auto& b: mBuffers) res += b->size();
+	return res;
+}
+
+std::size_t Tracer::dropped() const {
+	std::lock_guard<std::mutex> lock(mMutex);
+	std::size_t res = 0;
+	for (const auto& b: mBuffers) res += b->dropped();
+	return res;
+}
+
+void Tracer::clear() {
+	std::lock_guard<std::mutex> lock(mMutex);
+	for (auto& b: mBuffers) b->clear();
+}
+
+void Tracer::write_chrome_trace(std::ostream& os) const {
+	std::lock_guard<std::mutex> lock(mMutex);
+	os << "{\"traceEvents\":[";
+	bool first = true;
+	std::size_t dropped = 0;
+	for (const auto& b: mBuffers) {
+		dropped += b->dropped();
+		std::size_t size = b->size();
+		for (std::size_t i = 0; i < size; ++i) {
+			const Event& e = (*b)[i];
+			os << (first ? "\n" : ",\n") << "{\"name\":";
+			write_json_string(os, e.name);
+			os << ",\"cat\":";
+			write_json_string(os, e.category);
+			os << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << b->thread() << ",\"ts\":";
+			write_microseconds(os, e.begin);
+			os << ",\"dur\":";
+			write_microseconds(os, e.end - e.begin);
+			os << "}";
+			first = false;
+		}
+	}
+	os << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped\":" << dropped << "}}\n";
+}
+
+bool Tracer::write_chrome_trace(const std::string& filename) const {
+	std::ofstream out(filename);
+	if (!out) return false;
+	write_chrome_trace(out);
+	return static_cast<bool>(out);
+}
+
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <carl-common/memory/Singleton.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace carl::statistics::tracing {
+
+/// The point in time all timestamps of a trace are relative to.
+inline const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+/// Return the nanoseconds since the epoch.
+inline std::uint64_t now() {
+	return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count());
+}
+
+/**
+ * A single completed span.
+ * Category and name are not copied and must be string literals.
+ */
+struct Event {
+	const char* category;
+	const char* name;
+	std::uint64_t begin;
+	std::uint64_t end;
+};
+
+/**
+ * Stores the events of a single thread.
+ *
+ * Only the owning thread writes, hence recording an event needs no lock.
+ * Events are stored in chunks that are never moved, such that other threads can read all events up to size() while new events are recorded.
+ * Once all chunks are full, further events are dropped and counted.
+ */
+class ThreadBuffer {
+public:
+	static constexpr std::size_t chunk_size = 1 << 12;
+	static constexpr std::size_t max_chunks = 1 << 10;
+private:
+	std::size_t mThread;
+	std::array<std::atomic<Event*>, max_chunks> mChunks {};
+	std::atomic<std::size_t> mSize = 0;
+	std::atomic<std::size_t> mDropped = 0;
+public:
+	explicit ThreadBuffer(std::size_t thread): mThread(thread) {}
+	~ThreadBuffer() {
+		for (auto& c: mChunks) delete[] c.load();
+	}
+	ThreadBuffer(const ThreadBuffer&) = delete;
+	ThreadBuffer& operator=(const ThreadBuffer&) = delete;
+
+	/// Records an event, must only be called from the owning thread.
+	void record(const char* category, const char* name, std::uint64_t begin, std::uint64_t end) {
+		std::size_t n = mSize.load(std::memory_order_relaxed);
+		std::size_t chunk = n / chunk_size;
+		if (chunk >= max_chunks) {
+			mDropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		Event* c = mChunks[chunk].load(std::memory_order_relaxed);
+		if (c == nullptr) {
+			c = new Event[chunk_size];
+			mChunks[chunk].store(c, std::memory_order_release);
+		}
+		c[n % chunk_size] = Event{ category, name, begin, end };
+		mSize.store(n + 1, std::memory_order_release);
+	}
+	/// Forgets all events, must not be called while the owning thread records events.
+	void clear() {
+		mSize.store(0, std::memory_order_release);
+		mDropped.store(0, std::memory_order_relaxed);
+	}
+
+	std::size_t thread() const {
+		return mThread;
+	}
+	std::size_t size() const {
+		return mSize.load(std::memory_order_acquire);
+	}
+	std::size_t dropped() const {
+		return mDropped.load(std::memory_order_relaxed);
+	}
+	/// Returns the i'th event, requires i < size().
+	const Event& operator[](std::size_t i) const {
+		return mChunks[i / chunk_size].load(std::memory_order_acquire)[i % chunk_size];
+	}
+};
+
+/**
+ * Owns the buffers of all threads that recorded a span.
+ * Buffers are kept after their thread terminated, such that the trace can be exported at the end.
+ */
+class Tracer: public carl::Singleton<Tracer> {
+	friend carl::Singleton<Tracer>;
+private:
+	mutable std::mutex mMutex;
+	std::vector<std::shared_ptr<ThreadBuffer>> mBuffers;
+	std::atomic<bool> mEnabled = true;
+
+	Tracer() = default;
+
+	std::shared_ptr<ThreadBuffer> add_thread() {
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mBuffers.emplace_back(std::make_shared<ThreadBuffer>(mBuffers.size()));
+	}
+public:
+	/// Returns the buffer of the calling thread.
+	ThreadBuffer& local() {
+		static thread_local std::shared_ptr<ThreadBuffer> buffer = add_thread();
+		return *buffer;
+	}
+
+	bool enabled() const {
+		return mEnabled.load(std::memory_order_relaxed);
+	}
+	/// Starts or stops recording new spans.
+	void set_enabled(bool enabled) {
+		mEnabled.store(enabled, std::memory_order_relaxed);
+	}
+
+	/// Returns the number of recorded events over all threads.
+	std::size_t size() const;
+	/// Returns the number of dropped events over all threads.
+	std::size_t dropped() const;
+	/// Forgets all events, must not be called while spans are recorded.
+	void clear();
+
+	/**
+	 * Writes all events in the Chrome trace event format, that can be loaded into chrome://tracing or Perfetto.
+	 * Every span is a complete event, timestamps and durations are given in microseconds with nanosecond precision.
+	 */
+	void write_chrome_trace(std::ostream& os) const;
+	/// Writes all events in the Chrome trace event format to the given file, returns false if the file could not be written.
+	bool write_chrome_trace(const std::string& filename) const;
+};
+
+/**
+ * Records the time from its construction to its destruction as a single event in the buffer of the current thread.
+ * Category and name must be string literals.
+ */
+class Span {
+	const char* mCategory;
+	const char* mName;
+	std::uint64_t mBegin;
+	bool mActive;
+public:
+	Span(const char* category, const char* name):
+		mCategory(category), mName(name), mBegin(0), mActive(Tracer::getInstance().enabled())
+	{
+		if (mActive) mBegin = now();
+	}
+	~Span() {
+		if (mActive) {
+			std::uint64_t end = now();
+			Tracer::getInstance().local().record(mCategory, mName, mBegin, end);
+		}
+	}
+	Span(const Span&) = delete;
+	Span(Span&&) = delete;
+	Span& operator=(const Span&) = delete;
+	Span& operator=(Span&&) = delete;
+};
+
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <variant>
+
+namespace carl::statistics {
+
+/**
+ * A single collected value.
+ * Numbers keep their type, such that they can be exported without parsing them again.
+ */
+using Value = std::variant<std::size_t, std::int64_t, double, std::string>;
+
+/// Writes the value as is, i.e. strings are not quoted.
+inline std::ostream& print(std::ostream& os, const Value& value) {
+	std::visit([&os](const auto& v) { os << v; }, value);
+	return os;
+}
+
+/// Converts the value to a string as written by print().
+inline std::string to_string(const Value& value) {
+	std::ostringstream ss;
+	print(ss, value);
+	return ss.str();
+}
+
+}
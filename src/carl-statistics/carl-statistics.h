@@ -14,6 +14,7 @@
 
 #include "config.h"
 #include "Statistics.h"
+#include "Tracing.h"
 
 namespace carl {
 namespace statistics {
@@ -30,6 +31,14 @@ namespace statistics {
     #define CARL_TIME_FINISH(timer, start)
 #endif
 
+#define __CARL_TRACE_CONCAT(a, b) a##b
+#define __CARL_TRACE_NAME(line) __CARL_TRACE_CONCAT(__carl_trace_span_, line)
+#ifdef CARL_DEVOPTION_Tracing
+    #define CARL_TRACE_SPAN(category, name) ::carl::statistics::tracing::Span __CARL_TRACE_NAME(__LINE__)(category, name)
+#else
+    #define CARL_TRACE_SPAN(category, name)
+#endif
+
 
 }
 }
\ No newline at end of file
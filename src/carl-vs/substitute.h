@@ -3,6 +3,7 @@
 #include <bitset>
 #include <vector>
 #include <carl-formula/arithmetic/Constraint.h>
+#include <carl-arith/vs/Substitution.h>
 
 #include "term.h"
 #include "zeros.h"
@@ -34,6 +35,8 @@ namespace carl::vs::detail {
     struct Substitution {
         const Variable& m_variable;
         const Term<Poly>& m_term;
+        /// Powers of the square root expression, shared by all constraints this substitution is applied to.
+        mutable std::optional<SqrtExPowers<Poly>> m_powers;
         Substitution(const Variable& variable, const Term<Poly>& term) : m_variable(variable), m_term(term) {}
         const carl::Variable& variable() const {
             return m_variable;
@@ -41,6 +44,10 @@ namespace carl::vs::detail {
         const Term<Poly>& term() const {
             return m_term;
         }
+        SqrtExPowers<Poly>& powers() const {
+            if (!m_powers) m_powers.emplace(m_term.sqrt_ex());
+            return *m_powers;
+        }
     };
     template<class Poly>
     inline std::ostream& operator<<(std::ostream& os, const Substitution<Poly>& s) {
@@ -366,17 +373,17 @@ namespace carl::vs {
     /**
      * Applies a substitution to a constraint.
      * @param cons   The constraint to substitute in.
-     * @param subs   The substitution to apply.
+     * @param subs   The substitution to apply. The powers of its square root expression are cached in it, hence it should be reused for all constraints.
      * @return std::nullopt, if the upper limit in the number of combinations in the result of the substitution is exceeded.
      *                 Note, that this hinders a combinatorial blow up.
      *          Thr substitution result, otherwise.
      */
     template<typename Poly>
-    inline std::optional<CaseDistinction<Poly>> substitute(const Constraint<Poly>& cons, const Variable var, const Term<Poly>& term) {
+    inline std::optional<CaseDistinction<Poly>> substitute(const Constraint<Poly>& cons, const detail::Substitution<Poly>& subs) {
         CaseDistinction<Poly> subres;
         carl::Variables dummy_vars; // we do not make use of this feature here
         detail::EvalDoubleIntervalMap dummy_map; // we do not make use of this feature here
-        if (!detail::substitute(cons, detail::Substitution<Poly>(var, term), subres, false, dummy_vars, dummy_map)) {
+        if (!detail::substitute(cons, subs, subres, false, dummy_vars, dummy_map)) {
             return std::nullopt;
         } else {
             // return subres;
@@ -388,6 +395,19 @@ namespace carl::vs {
         }
     }
 
+    /**
+     * Applies a substitution to a constraint.
+     * @param cons   The constraint to substitute in.
+     * @param var    The variable to substitute.
+     * @param term   The term to substitute by.
+     * @return std::nullopt, if the upper limit in the number of combinations in the result of the substitution is exceeded.
+     *          The substitution result, otherwise.
+     */
+    template<typename Poly>
+    inline std::optional<CaseDistinction<Poly>> substitute(const Constraint<Poly>& cons, const Variable var, const Term<Poly>& term) {
+        return substitute(cons, detail::Substitution<Poly>(var, term));
+    }
+
     /**
      * Applies a substitution to a variable comparison.
      * @param varcomp   The variable comparison to substitute in.
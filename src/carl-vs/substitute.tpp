@@ -156,10 +156,31 @@ namespace carl::vs::detail
         }
     }
 
+    /**
+     * Caches the results of splitProducts for single constraints across calls, such that constraints reoccurring in different branches
+     * are factorized and split into sign combinations only once. Entries are keyed by the constraint, i.e. by its id in the constraint pool,
+     * and keep the constraint alive. There is one cache per thread.
+     */
+    template<typename Poly>
+    struct SplitProductsCache {
+        /// The caches are cleared once they contain more entries.
+        static constexpr std::size_t max_size = 4096;
+        std::map<const Constraint<Poly>, CaseDistinction<Poly>> results[2];
+
+        static std::map<const Constraint<Poly>, CaseDistinction<Poly>>& get( bool _onlyNeq )
+        {
+            thread_local SplitProductsCache cache;
+            auto& res = cache.results[_onlyNeq ? 1 : 0];
+            if( res.size() > max_size )
+                res.clear();
+            return res;
+        }
+    };
+
     template<typename Poly>
     bool splitProducts( CaseDistinction<Poly>& _toSimplify, bool _onlyNeq )
     {
-        std::map<const Constraint<Poly>, CaseDistinction<Poly>> result_cache;
+        auto& result_cache = SplitProductsCache<Poly>::get( _onlyNeq );
         bool result = true;
         size_t toSimpSize = _toSimplify.size();
         for( size_t pos = 0; pos < toSimpSize; )
@@ -616,7 +637,7 @@ namespace carl::vs::detail
             {
                 return false;
             }
-            carl::SqrtEx sub = carl::substitute( _cons.lhs(), _subs.variable(), _subs.term().sqrt_ex() );
+            carl::SqrtEx sub = carl::substitute( _cons.lhs(), _subs.variable(), _subs.powers() );
             #ifdef VS_DEBUG_SUBSTITUTION
             std::cout << "Result of common substitution:" << sub << std::endl;
             #endif
@@ -1001,9 +1022,11 @@ namespace carl::vs::detail
         assert( _cons.variables().has( _subs.variable() ) );
         // Create a substitution formed by the given one without an addition of epsilon.
         auto term = Term<Poly>::normal(_subs.term().sqrt_ex());
+        // All substitutions below share the powers of the square root expression.
+        Substitution<Poly> subs(_subs.variable(), term);
         // Call the method substituteNormal with the constraint f(x)~0 and the substitution [x -> t],  where the parameter relation is ~.
         Constraint<Poly> firstCaseInequality = Constraint<Poly>( _cons.lhs(), _relation );
-        if( !substituteNormal( firstCaseInequality, {_subs.variable(), term}, _result, _accordingPaper, _conflictingVariables, _solutionSpace ) )
+        if( !substituteNormal( firstCaseInequality, subs, _result, _accordingPaper, _conflictingVariables, _solutionSpace ) )
             return false;
         // Create a vector to store the results of each single substitution.
         std::vector<CaseDistinction<Poly>> substitutionResultsVector;
@@ -1026,10 +1049,10 @@ namespace carl::vs::detail
             Constraint<Poly> inequality = Constraint<Poly>( deriv, _relation );
             // Apply the substitution (without epsilon) to the new constraints.
             substitutionResultsVector.emplace_back();
-            if( !substituteNormal( equation, {_subs.variable(), term}, substitutionResultsVector.back(), _accordingPaper, _conflictingVariables, _solutionSpace ) )
+            if( !substituteNormal( equation, subs, substitutionResultsVector.back(), _accordingPaper, _conflictingVariables, _solutionSpace ) )
                 return false;
             substitutionResultsVector.emplace_back();
-            if( !substituteNormal( inequality, {_subs.variable(), term}, substitutionResultsVector.back(), _accordingPaper, _conflictingVariables, _solutionSpace ) )
+            if( !substituteNormal( inequality, subs, substitutionResultsVector.back(), _accordingPaper, _conflictingVariables, _solutionSpace ) )
                 return false;
             if( !combine( substitutionResultsVector, _result ) )
                 return false;
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "substitute.h"
+
+#include <carl-common/config.h>
+#include <carl-common/parallel/ThreadPool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <optional>
+#include <vector>
+
+namespace carl::vs {
+
+    /**
+     * The results of substituting several test candidates into a conjunction of constraints.
+     */
+    template<typename Poly>
+    struct CandidateResults {
+        /// The case distinction per candidate. std::nullopt, if the number of combinations was exceeded or the candidate was skipped.
+        std::vector<std::optional<CaseDistinction<Poly>>> cases;
+        /// The first candidate yielding a trivially satisfiable case, i.e. an empty conjunction. No results are reported for later candidates.
+        std::optional<std::size_t> satisfiable;
+    };
+
+    /**
+     * Applies a substitution to all constraints of a conjunction and combines the results to a single case distinction.
+     * @return std::nullopt, if the upper limit in the number of combinations is exceeded.
+     *          The simplified case distinction, otherwise.
+     */
+    template<typename Poly>
+    inline std::optional<CaseDistinction<Poly>> substitute(const ConstraintConjunction<Poly>& constraints, const Variable var, const Term<Poly>& term) {
+        detail::Substitution<Poly> subs(var, term);
+        std::vector<CaseDistinction<Poly>> subresults;
+        subresults.reserve(constraints.size());
+        for (const auto& cons : constraints) {
+            auto subres = substitute(cons, subs);
+            if (!subres) return std::nullopt;
+            subresults.push_back(std::move(*subres));
+        }
+        CaseDistinction<Poly> result;
+        if (!detail::combine(subresults, result)) return std::nullopt;
+        detail::simplify(result);
+        return result;
+    }
+
+    /**
+     * Substitutes every test candidate for the given variable into the given conjunction of constraints.
+     *
+     * If THREAD_SAFE is defined, the candidates are distributed over num_threads threads of the ThreadPool (the hardware concurrency if zero).
+     * An exception thrown while substituting some candidate is rethrown in the calling thread.
+     * As soon as some candidate yields a trivially satisfiable case, the remaining candidates after it are cancelled.
+     * The result does not depend on the number of threads: all candidates up to the first satisfiable one are reported, in the order of the candidates.
+     */
+    template<typename Poly>
+    inline CandidateResults<Poly> substitute_candidates(const ConstraintConjunction<Poly>& constraints, const Variable var, const std::vector<Term<Poly>>& candidates, std::size_t num_threads = 0) {
+        CandidateResults<Poly> res;
+        res.cases.resize(candidates.size());
+        std::atomic<std::size_t> first_sat(candidates.size());
+        auto task = [&](std::size_t i) {
+            // Candidates after a satisfiable one are not needed anymore.
+            if (i > first_sat.load()) return;
+            res.cases[i] = substitute(constraints, var, candidates[i]);
+            if (!res.cases[i]) return;
+            bool sat = std::any_of(res.cases[i]->begin(), res.cases[i]->end(), [](const auto& conj) { return conj.empty(); });
+            if (!sat) return;
+            std::size_t cur = first_sat.load();
+            while (i < cur && !first_sat.compare_exchange_weak(cur, i));
+            CARL_LOG_DEBUG("carl.vs", "Candidate " << candidates[i] << " yields a trivially satisfiable case");
+        };
+#ifndef THREAD_SAFE
+        // The polynomial and constraint pools are not synchronized.
+        num_threads = 1;
+#endif
+        ThreadPool::getInstance().run(candidates.size(), num_threads, task);
+        if (first_sat.load() < candidates.size()) {
+            res.satisfiable = first_sat.load();
+            for (std::size_t i = *res.satisfiable + 1; i < candidates.size(); ++i) res.cases[i] = std::nullopt;
+        }
+        return res;
+    }
+
+}
@@ -55,7 +55,7 @@ public:
 		return m_type == TermType::PLUS_INFINITY;
 	}
 
-	const SqrtEx<Poly> sqrt_ex() const {
+	const SqrtEx<Poly>& sqrt_ex() const {
 		return *m_sqrt_ex;
 	}
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <carl-arith/extended/VariableComparison.h>
 #include <carl-arith/vs/SqrtEx.h>
 #include <optional>
 #include <vector>
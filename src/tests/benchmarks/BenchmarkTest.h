@@ -19,15 +19,21 @@ namespace carl
 class BenchmarkTest : public ::testing::Test {
 protected:
     
-	BenchmarkTest(): file({
-		"CArL"
+	BenchmarkTest(): file(backends()), memory(backends()) {
+	}
+	static std::vector<std::string> backends() {
+		return {
+			"CArL"
 #ifdef USE_COCOA
-		,"CoCoA"
+			,"CoCoA"
 #endif
 #ifdef USE_GINAC
-		,"GiNaC"
+			,"GiNaC"
+#endif
+#ifdef USE_LIBPOLY
+			,"LibPoly"
 #endif
-    }) {
+		};
 	}
 	~BenchmarkTest() {
 		auto info = ::testing::UnitTest::GetInstance()->current_test_info();
@@ -55,12 +61,24 @@ protected:
 			std::ofstream out(ss.str(), std::ios_base::out);
 			file.writeTable(out);
 		}
+		if (!memory.empty()) {
+			std::stringstream ss;
+			ss << "benchmarks/benchmark_" << info->name() << "_memory_table.tex";
+			std::ofstream out(ss.str(), std::ios_base::out);
+			memory.writeTable(out);
+			std::cout << "Fastest backend:" << std::endl;
+			file.writeBest(std::cout);
+			std::cout << "Least memory (KiB):" << std::endl;
+			memory.writeBest(std::cout);
+		}
 	}
 	virtual void SetUp() {
 	}
 	virtual void TearDown() {
 	}
 	BenchmarkFile<std::size_t> file;
+	/// Peak memory usage in KiB, filled by benchmarks that compare backends.
+	BenchmarkFile<std::size_t> memory;
 };
 
 }
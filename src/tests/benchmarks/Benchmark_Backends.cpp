@@ -0,0 +1,280 @@
+#include "gtest/gtest.h"
+
+#include "framework/Benchmark.h"
+#include <carl-arith/groebner/groebner.h>
+#include <carl-arith/poly/umvpoly/MultivariatePolynomial.h>
+#include <carl-arith/poly/umvpoly/functions/Factorization_univariate.h>
+#include <carl-arith/poly/umvpoly/functions/GCD.h>
+#include <carl-arith/poly/umvpoly/functions/Resultant.h>
+#include <carl-arith/ran/ran.h>
+#ifdef USE_LIBPOLY
+#include <carl-arith/poly/libpoly/Functions.h>
+#endif
+#include "BenchmarkTest.h"
+#include "framework/BenchmarkGenerator.h"
+
+#include <carl-common/config.h>
+
+/**
+ * Runs the same workloads through all available backends: MultivariatePolynomial (CArL), LPPolynomial (LibPoly), CoCoAAdaptor (CoCoA) and GiNaC.
+ * Every backend gets converted inputs, only the operation itself is measured.
+ * The runtime and the peak memory usage are reported per backend, together with the best backend for every size.
+ * Operations that a backend does not provide (or only provides via another backend) are skipped for this backend.
+ */
+
+using namespace carl;
+
+namespace carl {
+namespace {
+
+	//##### Generator
+	/// Two polynomials with a nontrivial common factor.
+	template<typename C>
+	struct CommonFactorGenerator: public BaseGenerator {
+		typedef std::tuple<CMP<C>,CMP<C>> type;
+		CommonFactorGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			auto common = g.newMP<C>(bi.degree / 2);
+			auto p1 = g.newMP<C>(bi.degree - bi.degree / 2);
+			auto p2 = g.newMP<C>(bi.degree - bi.degree / 2);
+			return std::make_tuple(common * p1, common * p2);
+		}
+	};
+	/// Two polynomials in the last variable, which is the main variable for libpoly.
+	template<typename C>
+	struct MainVariableResultantGenerator: public BaseGenerator {
+		typedef std::tuple<CUMP<C>,CUMP<C>> type;
+		MainVariableResultantGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			auto v = bi.variables.back();
+			auto p1 = carl::to_univariate_polynomial(g.newMP<C>(), v);
+			auto p2 = carl::to_univariate_polynomial(g.newMP<C>(), v);
+			return std::make_tuple(p1, p2);
+		}
+	};
+	/// A univariate polynomial with bi.degree integral roots (possibly repeated) and an irreducible quadratic factor.
+	template<typename C>
+	struct RootsGenerator: public BaseGenerator {
+		typedef std::tuple<CMP<C>> type;
+		RootsGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			CMP<C> x(bi.variables.front());
+			CMP<C> res = x * x + CMP<C>(g.geomDist<C>());
+			for (std::size_t i = 0; i < bi.degree; i++) {
+				res *= x - CMP<C>(C(static_cast<long>(g.uniDist(4 * bi.degree + 1)) - 2 * static_cast<long>(bi.degree)));
+			}
+			return std::make_tuple(res);
+		}
+	};
+	/// As many random polynomials as there are variables.
+	template<typename C>
+	struct IdealGenerator: public BaseGenerator {
+		typedef std::tuple<std::vector<CMP<C>>> type;
+		IdealGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			std::vector<CMP<C>> res;
+			for (std::size_t i = 0; i < bi.variables.size(); i++) {
+				res.emplace_back(g.newMP<C>());
+			}
+			return std::make_tuple(res);
+		}
+	};
+
+	//##### Executor
+	struct BackendGCDExecutor {
+		template<typename Coeff>
+		CMP<Coeff> operator()(const std::tuple<CMP<Coeff>,CMP<Coeff>>& args) {
+			return carl::gcd(std::get<0>(args), std::get<1>(args));
+		}
+		#ifdef USE_LIBPOLY
+		LPP operator()(const std::tuple<LPP,LPP>& args) {
+			return carl::gcd(std::get<0>(args), std::get<1>(args));
+		}
+		#endif
+		#ifdef USE_COCOA
+		CoMP operator()(const std::tuple<CoMP,CoMP>& args) {
+			return cocoawrapper::gcd(std::get<0>(args), std::get<1>(args));
+		}
+		#endif
+		#ifdef USE_GINAC
+		GMP operator()(const std::tuple<GMP,GMP>& args) {
+			return GiNaC::expand(GiNaC::gcd(std::get<0>(args), std::get<1>(args)));
+		}
+		#endif
+	};
+	struct BackendResultantExecutor {
+		template<typename Coeff>
+		CUMP<Coeff> operator()(const std::tuple<CUMP<Coeff>,CUMP<Coeff>>& args) {
+			return carl::resultant(std::get<0>(args), std::get<1>(args));
+		}
+		#ifdef USE_LIBPOLY
+		LPP operator()(const std::tuple<LPP,LPP>& args) {
+			return carl::resultant(std::get<0>(args), std::get<1>(args));
+		}
+		#endif
+		#ifdef USE_GINAC
+		GMP operator()(const std::tuple<GMP,GMP,GVAR>& args) {
+			return GiNaC::expand(GiNaC::resultant(std::get<0>(args), std::get<1>(args), std::get<2>(args)));
+		}
+		#endif
+	};
+	/// Returns the number of distinct nonconstant factors.
+	struct BackendFactorizationExecutor {
+		template<typename Coeff>
+		std::size_t operator()(const std::tuple<CMP<Coeff>>& args) {
+			auto factors = carl::factorization(carl::to_univariate_polynomial(std::get<0>(args)));
+			return static_cast<std::size_t>(std::count_if(factors.begin(), factors.end(),
+				[](const auto& f) { return !carl::is_constant(f.first); }
+			));
+		}
+		#if defined(USE_LIBPOLY) && defined(USE_COCOA)
+		std::size_t operator()(const std::tuple<LPP>& args) {
+			auto factors = carl::factorization(std::get<0>(args), false);
+			return static_cast<std::size_t>(std::count_if(factors.begin(), factors.end(),
+				[](const auto& f) { return !carl::is_constant(f.first); }
+			));
+		}
+		#endif
+		#ifdef USE_COCOA
+		std::size_t operator()(const std::tuple<CoMP>& args) {
+			return cocoawrapper::factor(std::get<0>(args)).myFactors().size();
+		}
+		#endif
+		#ifdef USE_GINAC
+		std::size_t operator()(const std::tuple<GMP>& args) {
+			GMP res = GiNaC::factor(std::get<0>(args));
+			if (!GiNaC::is_a<GiNaC::mul>(res)) return GiNaC::is_a<GiNaC::numeric>(res) ? 0 : 1;
+			std::size_t count = 0;
+			for (const auto& f: res) {
+				if (!GiNaC::is_a<GiNaC::numeric>(f)) count++;
+			}
+			return count;
+		}
+		#endif
+	};
+	/// Returns the number of real roots.
+	struct BackendRealRootsExecutor {
+		template<typename Coeff>
+		std::size_t operator()(const std::tuple<CMP<Coeff>>& args) {
+			return carl::real_roots(carl::to_univariate_polynomial(std::get<0>(args)), carl::Interval<Coeff>::unbounded_interval()).roots().size();
+		}
+		#ifdef USE_LIBPOLY
+		std::size_t operator()(const std::tuple<LPP>& args) {
+			return carl::real_roots(std::get<0>(args)).roots().size();
+		}
+		#endif
+	};
+	/// Returns the size of the Groebner basis. The backends use different monomial orderings, hence the sizes may differ.
+	struct BackendGroebnerExecutor {
+		template<typename Coeff>
+		std::size_t operator()(const std::tuple<std::vector<CMP<Coeff>>>& args) {
+			carl::GBProcedure<CMP<Coeff>, carl::Buchberger, carl::StdAdding> gb;
+			for (const auto& p: std::get<0>(args)) gb.addPolynomial(p);
+			gb.reduceInput();
+			gb.calculate();
+			return gb.getIdeal().nrGenerators();
+		}
+		#if defined(USE_LIBPOLY) && defined(USE_COCOA)
+		std::size_t operator()(const std::tuple<std::vector<LPP>>& args) {
+			return carl::groebner_basis(std::get<0>(args)).size();
+		}
+		#endif
+		#ifdef USE_COCOA
+		std::size_t operator()(const std::tuple<std::vector<CoMP>>& args) {
+			return cocoawrapper::ReducedGBasis(std::get<0>(args)).size();
+		}
+		#endif
+	};
+}
+}
+
+typedef mpq_class Coeff;
+
+TEST_F(BenchmarkTest, BackendGCD)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 3);
+	bi.n = 10;
+	for (bi.degree = 4; bi.degree < 9; bi.degree++) {
+		Benchmark<CommonFactorGenerator<Coeff>, BackendGCDExecutor, CMP<Coeff>> bench(bi, "CArL");
+		#ifdef USE_LIBPOLY
+		bench.compare<LPP, TupleConverter<LPP,LPP>>("LibPoly");
+		#endif
+		#ifdef USE_COCOA
+		bench.compare<CoMP, TupleConverter<CoMP,CoMP>>("CoCoA");
+		#endif
+		#ifdef USE_GINAC
+		bench.compare<GMP, TupleConverter<GMP,GMP>>("GiNaC");
+		#endif
+		file.push(bench.result(), bi.degree);
+		memory.push(bench.memoryResult(), bi.degree);
+	}
+}
+
+TEST_F(BenchmarkTest, BackendResultant)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 3);
+	bi.n = 10;
+	for (bi.degree = 4; bi.degree < 7; bi.degree++) {
+		Benchmark<MainVariableResultantGenerator<Coeff>, BackendResultantExecutor, CUMP<Coeff>> bench(bi, "CArL");
+		#ifdef USE_LIBPOLY
+		bench.compare<LPP, TupleConverter<LPP,LPP>>("LibPoly");
+		#endif
+		#ifdef USE_GINAC
+		bench.compare<GMP, ResultantConverter<GMP,GVAR>>("GiNaC");
+		#endif
+		file.push(bench.result(), bi.degree);
+		memory.push(bench.memoryResult(), bi.degree);
+	}
+}
+
+TEST_F(BenchmarkTest, BackendFactorization)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 1);
+	bi.n = 10;
+	for (bi.degree = 4; bi.degree < 13; bi.degree += 4) {
+		Benchmark<RootsGenerator<Coeff>, BackendFactorizationExecutor, std::size_t> bench(bi, "CArL");
+		#if defined(USE_LIBPOLY) && defined(USE_COCOA)
+		bench.compare<std::size_t, TupleConverter<LPP>>("LibPoly");
+		#endif
+		#ifdef USE_COCOA
+		bench.compare<std::size_t, TupleConverter<CoMP>>("CoCoA");
+		#endif
+		#ifdef USE_GINAC
+		bench.compare<std::size_t, TupleConverter<GMP>>("GiNaC");
+		#endif
+		file.push(bench.result(), bi.degree);
+		memory.push(bench.memoryResult(), bi.degree);
+	}
+}
+
+TEST_F(BenchmarkTest, BackendRealRoots)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 1);
+	bi.n = 10;
+	bi.compareResults = true;
+	for (bi.degree = 4; bi.degree < 17; bi.degree += 4) {
+		Benchmark<RootsGenerator<Coeff>, BackendRealRootsExecutor, std::size_t> bench(bi, "CArL");
+		#ifdef USE_LIBPOLY
+		bench.compare<std::size_t, TupleConverter<LPP>>("LibPoly");
+		#endif
+		file.push(bench.result(), bi.degree);
+		memory.push(bench.memoryResult(), bi.degree);
+	}
+}
+
+TEST_F(BenchmarkTest, BackendGroebner)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 3);
+	bi.n = 5;
+	for (bi.degree = 3; bi.degree < 6; bi.degree++) {
+		Benchmark<IdealGenerator<Coeff>, BackendGroebnerExecutor, std::size_t> bench(bi, "CArL");
+		#if defined(USE_LIBPOLY) && defined(USE_COCOA)
+		bench.compare<std::size_t, TupleConverter<std::vector<LPP>>>("LibPoly");
+		#endif
+		#ifdef USE_COCOA
+		bench.compare<std::size_t, TupleConverter<std::vector<CoMP>>>("CoCoA");
+		#endif
+		file.push(bench.result(), bi.degree);
+		memory.push(bench.memoryResult(), bi.degree);
+	}
+}
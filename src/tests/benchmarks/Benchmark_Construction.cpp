@@ -234,21 +234,6 @@ namespace carl {
 		}
         #endif
 	};
-
-	//##### Converter
-	template<typename P, typename V>
-	struct ResultantConverter: public BaseConverter {
-	public:
-		typedef std::tuple<P, P, V> type;
-		ResultantConverter(const CIPtr& ci): BaseConverter(ci) {}
-		template<typename Coeff>
-		type operator()(const std::tuple<CUMP<Coeff>, CUMP<Coeff>>& t) {
-			auto p1 = Conversion::template convert<P>(std::get<0>(t), ci);
-			auto p2 = Conversion::template convert<P>(std::get<1>(t), ci);
-			auto v = Conversion::template convert<V>(std::get<0>(t).main_var(), ci);
-			return std::make_tuple(p1, p2, v);
-		}
-	};
 }
 
 TEST_F(BenchmarkTest, ReleaseCheck)
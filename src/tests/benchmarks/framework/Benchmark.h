@@ -19,6 +19,7 @@
 
 #include "BenchmarkConversions.h"
 #include "BenchmarkGenerator.h"
+#include "BenchmarkMemory.h"
 #include "BenchmarkOutput.h" 
 
 namespace carl {
@@ -97,6 +98,9 @@ protected:
 	bool operator()(const bool lhs, const bool rhs) {
 		return lhs == rhs;
 	}
+	bool operator()(const std::size_t lhs, const std::size_t rhs) {
+		return lhs == rhs;
+	}
 	#ifdef USE_COCOA
 	bool operator()(const CoMP& lhs, const CoMP& rhs) {
 		return lhs == rhs;
@@ -107,6 +111,11 @@ protected:
 		return lhs == rhs;
 	}
     #endif
+	#ifdef USE_LIBPOLY
+	bool operator()(const LPP& lhs, const LPP& rhs) {
+		return lhs == rhs;
+	}
+	#endif
 public:
 	BenchmarkResultComparator(const std::string& lname, const std::string& rname, const CIPtr& ci): ci(ci), names(lname, rname) {}
 	template<typename T2>
@@ -135,24 +144,27 @@ private:
 	std::vector<Result> results;
 	Executor executor;
 	BenchmarkResult runtimes;
+	BenchmarkResult memory;
 	std::string name;
 
+	/// Runs the executor on all samples, stores the runtime in ms and the peak memory usage in KiB.
 	template<typename R, typename Src>
-	std::size_t runSamples(std::vector<R>& res, const Src& src) {
+	void runSamples(std::vector<R>& res, const Src& src, const std::string& name) {
+		MemoryTracker::reset();
 		carl::Timer timer;
 		for (const auto& cur: src) {
 			res.emplace_back(executor(cur));
 		}
-		return timer.passed();
+		runtimes[name] = timer.passed();
+		memory[name] = MemoryTracker::peak() / 1024;
+		std::cout << runtimes[name] << " ms, " << memory[name] << " KiB" << std::endl;
 	}
 public:
 	Benchmark(const BenchmarkInformation& bi, const std::string& name): ci(new ConversionInformation(bi.variables)), reference(bi, ci), bi(bi), name(name) {
 		results.reserve(reference.size());
 		std::cout << "Reference " << name << " ... ";
 		std::cout.flush();
-		std::size_t time = runSamples(results, reference);
-		runtimes[name] = time;
-		std::cout << time << " ms" << std::endl;
+		runSamples(results, reference, name);
 	}
 	template<typename R, typename Converter>
 	void compare(const std::string& name) {
@@ -161,9 +173,7 @@ public:
 		BenchmarkConverter<Converter> benchmarks(reference);
 		std::cout << "Comparing " << name << " ... ";
 		std::cout.flush();
-		std::size_t time = runSamples(res, benchmarks);
-		runtimes[name] = time;
-		std::cout << time << " ms" << std::endl;
+		runSamples(res, benchmarks, name);
 		
 		if (bi.compareResults) {
 			BenchmarkResultComparator<R> c(name, this->name, ci);
@@ -176,6 +186,9 @@ public:
 	BenchmarkResult result() const {
 		return runtimes;
 	}
+	BenchmarkResult memoryResult() const {
+		return memory;
+	}
 	CIPtr& getCI() {
 		return ci;
 	}
@@ -9,6 +9,10 @@
 #ifdef USE_GINAC
 #include <carl-arith/converter/GiNaCConverter.h>
 #endif
+#ifdef USE_LIBPOLY
+#include <carl-arith/poly/Conversion.h>
+#include <carl-arith/poly/libpoly/LPPolynomial.h>
+#endif
 #include <carl-arith/poly/umvpoly/MultivariatePolynomial.h>
 #include <carl-common/util/tuple_util.h>
 
@@ -20,6 +24,7 @@ namespace carl {
  * Information needed for all of the convert methods below.
  */
 struct ConversionInformation {
+	std::vector<Variable> variables;
 	CArLConverter carl;
 	#ifdef USE_COCOA
 	CoCoAAdaptor<CMP<mpq_class>> cocoa;
@@ -28,10 +33,18 @@ struct ConversionInformation {
 	std::map<carl::Variable, GiNaC::ex> ginacVariables;
 	GiNaCConverter ginac;
     #endif
+	#ifdef USE_LIBPOLY
+	/// The variables are ordered as given, hence the last variable is the main variable of the libpoly polynomials.
+	LPContext lp;
+	#endif
 	
 	ConversionInformation(const std::vector<Variable>& vars)
+	: variables(vars)
 	#ifdef USE_COCOA
-	: cocoa(vars) 
+	, cocoa(vars)
+	#endif
+	#ifdef USE_LIBPOLY
+	, lp(vars)
 	#endif
 	{}
 };
@@ -68,6 +81,10 @@ template<>
 inline CoMP Conversion::convert<CoMP, CMP<mpq_class>>(const CMP<mpq_class>& m, const CIPtr& ci) {
 	return ci->cocoa.convert(m);
 }
+template<>
+inline std::vector<CoMP> Conversion::convert<std::vector<CoMP>, std::vector<CMP<mpq_class>>>(const std::vector<CMP<mpq_class>>& m, const CIPtr& ci) {
+	return ci->cocoa.convert(m);
+}
 //template<>
 //inline CoVAR Conversion::convert<CoVAR, carl::Variable>(const carl::Variable& v, const CIPtr& ci) {
 //	return ci->cocoa.convert(v);
@@ -101,10 +118,33 @@ inline GMP Conversion::convert<GMP, CUMP<cln::cl_RA>>(const CUMP<cln::cl_RA>& m,
 }
 #endif
 
+#ifdef USE_LIBPOLY
+template<>
+inline LPP Conversion::convert<LPP, CMP<mpq_class>>(const CMP<mpq_class>& m, const CIPtr& ci) {
+	return carl::convert<LPP>(ci->lp, m);
+}
+template<>
+inline LPP Conversion::convert<LPP, CUMP<mpq_class>>(const CUMP<mpq_class>& m, const CIPtr& ci) {
+	return carl::convert<LPP>(ci->lp, CMP<mpq_class>(m));
+}
+template<>
+inline std::vector<LPP> Conversion::convert<std::vector<LPP>, std::vector<CMP<mpq_class>>>(const std::vector<CMP<mpq_class>>& m, const CIPtr& ci) {
+	std::vector<LPP> res;
+	for (const auto& p: m) {
+		res.emplace_back(carl::convert<LPP>(ci->lp, p));
+	}
+	return res;
+}
+#endif
+
 template<>
 inline unsigned Conversion::convert(const unsigned& n, const CIPtr&) {
 	return n;
 }
+template<>
+inline std::size_t Conversion::convert(const std::size_t& n, const CIPtr&) {
+	return n;
+}
 
 struct BaseConverter {
 public:
@@ -130,4 +170,21 @@ public:
 	}
 };
 
+/**
+ * Converts two univariate polynomials and their main variable, as needed for the resultant.
+ */
+template<typename P, typename V>
+struct ResultantConverter: public BaseConverter {
+public:
+	typedef std::tuple<P, P, V> type;
+	ResultantConverter(const CIPtr& ci): BaseConverter(ci) {}
+	template<typename Coeff>
+	type operator()(const std::tuple<CUMP<Coeff>, CUMP<Coeff>>& t) {
+		auto p1 = Conversion::template convert<P>(std::get<0>(t), ci);
+		auto p2 = Conversion::template convert<P>(std::get<1>(t), ci);
+		auto v = Conversion::template convert<V>(std::get<0>(t).main_var(), ci);
+		return std::make_tuple(p1, p2, v);
+	}
+};
+
 }
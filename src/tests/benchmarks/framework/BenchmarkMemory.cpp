@@ -0,0 +1,118 @@
+#include "BenchmarkMemory.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#include <gmp.h>
+
+namespace carl {
+
+namespace {
+	std::atomic<std::int64_t> current_usage{0};
+	std::atomic<std::int64_t> peak_usage{0};
+	std::atomic<std::int64_t> base_usage{0};
+	std::atomic<std::size_t> allocated_bytes{0};
+
+	void track_allocation(std::size_t n) {
+		std::int64_t cur = current_usage.fetch_add(static_cast<std::int64_t>(n), std::memory_order_relaxed) + static_cast<std::int64_t>(n);
+		allocated_bytes.fetch_add(n, std::memory_order_relaxed);
+		std::int64_t peak = peak_usage.load(std::memory_order_relaxed);
+		while (cur > peak && !peak_usage.compare_exchange_weak(peak, cur, std::memory_order_relaxed)) {}
+	}
+	void track_deallocation(std::size_t n) {
+		current_usage.fetch_sub(static_cast<std::int64_t>(n), std::memory_order_relaxed);
+	}
+
+	/// Every block from operator new is prefixed by its size, as operator delete does not always know it.
+	constexpr std::size_t header_size = alignof(std::max_align_t);
+
+	void* tracked_malloc(std::size_t n) {
+		void* block = std::malloc(n + header_size);
+		if (block == nullptr) return nullptr;
+		*static_cast<std::size_t*>(block) = n;
+		track_allocation(n);
+		return static_cast<char*>(block) + header_size;
+	}
+	void tracked_free(void* p) {
+		if (p == nullptr) return;
+		void* block = static_cast<char*>(p) - header_size;
+		track_deallocation(*static_cast<std::size_t*>(block));
+		std::free(block);
+	}
+
+	// GMP passes the sizes itself. Blocks allocated before the functions below were installed are freed correctly, but make the usage drop below the base.
+	void* gmp_allocate(std::size_t n) {
+		void* p = std::malloc(n);
+		if (p == nullptr) std::abort();
+		track_allocation(n);
+		return p;
+	}
+	void* gmp_reallocate(void* p, std::size_t old_size, std::size_t new_size) {
+		void* res = std::realloc(p, new_size);
+		if (res == nullptr) std::abort();
+		track_deallocation(old_size);
+		track_allocation(new_size);
+		return res;
+	}
+	void gmp_free(void* p, std::size_t n) {
+		track_deallocation(n);
+		std::free(p);
+	}
+
+	struct GMPMemoryFunctions {
+		GMPMemoryFunctions() {
+			mp_set_memory_functions(&gmp_allocate, &gmp_reallocate, &gmp_free);
+		}
+	} gmp_memory_functions;
+}
+
+void MemoryTracker::reset() {
+	std::int64_t cur = current_usage.load();
+	base_usage = cur;
+	peak_usage = cur;
+	allocated_bytes = 0;
+}
+std::size_t MemoryTracker::allocated() {
+	return allocated_bytes.load();
+}
+std::size_t MemoryTracker::peak() {
+	std::int64_t res = peak_usage.load() - base_usage.load();
+	return res > 0 ? static_cast<std::size_t>(res) : 0;
+}
+
+}
+
+void* operator new(std::size_t n) {
+	void* p = carl::tracked_malloc(n);
+	if (p == nullptr) throw std::bad_alloc();
+	return p;
+}
+void* operator new[](std::size_t n) {
+	return ::operator new(n);
+}
+void* operator new(std::size_t n, const std::nothrow_t&) noexcept {
+	return carl::tracked_malloc(n);
+}
+void* operator new[](std::size_t n, const std::nothrow_t&) noexcept {
+	return carl::tracked_malloc(n);
+}
+void operator delete(void* p) noexcept {
+	carl::tracked_free(p);
+}
+void operator delete[](void* p) noexcept {
+	carl::tracked_free(p);
+}
+void operator delete(void* p, std::size_t) noexcept {
+	carl::tracked_free(p);
+}
+void operator delete[](void* p, std::size_t) noexcept {
+	carl::tracked_free(p);
+}
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+	carl::tracked_free(p);
+}
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+	carl::tracked_free(p);
+}
@@ -0,0 +1,27 @@
+/**
+ * @file BenchmarkMemory.h
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace carl {
+
+/**
+ * Measures the memory used by a benchmark.
+ *
+ * All memory obtained via the global operator new or by GMP is accounted for.
+ * The accounting is implemented in BenchmarkMemory.cpp, which replaces the global allocation functions and installs its own GMP memory functions.
+ */
+class MemoryTracker {
+public:
+	/// Starts a new measurement.
+	static void reset();
+	/// Number of bytes allocated since the last reset.
+	static std::size_t allocated();
+	/// Maximum number of bytes in use at the same time since the last reset, not counting memory that was already in use at the reset.
+	static std::size_t peak();
+};
+
+}
@@ -7,6 +7,8 @@
 
 #include <carl-common/util/streamingOperators.h>
 
+#include <algorithm>
+
 namespace carl {
 
 typedef std::map<std::string, std::size_t> BenchmarkResult;
@@ -19,13 +21,28 @@ private:
 	static std::vector<std::string> tikzColors;
 	static std::vector<std::string> tikzMarks;
 public:
-	BenchmarkFile(const std::initializer_list<std::string>& init) {
+	BenchmarkFile(const std::vector<std::string>& init) {
 		for (const auto& name: init) names[name] = false;
 	}
 	void push(const BenchmarkResult& res, Identifier... identifier) {
 		data.emplace_back(std::make_tuple(identifier...), res);
 		for (const auto& it: res) names[it.first] = true;
 	}
+	bool empty() const {
+		return data.empty();
+	}
+	/// Writes the name with the smallest value for every row, for example the fastest backend.
+	void writeBest(std::ostream& os) {
+		for (const auto& res: data) {
+			auto best = std::min_element(res.second.begin(), res.second.end(),
+				[](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; }
+			);
+			if (best == res.second.end()) continue;
+			if (sizeof...(Identifier) == 1) os << std::get<0>(res.first);
+			else os << res.first;
+			os << "\t" << best->first << " (" << best->second << ")" << std::endl;
+		}
+	}
 	void writeMain(std::ostream& os, const std::string& benchmark) {
 		os << "\\input{benchmark_" << benchmark << "_table.tex" << "}" << std::endl;
 		os << "\\input{benchmark_" << benchmark << "_plot.tex" << "}" << std::endl;
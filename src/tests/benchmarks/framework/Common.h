@@ -5,6 +5,11 @@
 
 #pragma once
 
+#include <carl-common/config.h>
+#ifdef USE_LIBPOLY
+#include <carl-arith/poly/libpoly/LPPolynomial.h>
+#endif
+
 namespace carl {
 
 template<typename Coeff>
@@ -15,6 +20,9 @@ typedef CoCoA::RingElem CoMP;
 #ifdef USE_GINAC
 typedef GiNaC::ex GMP;
 #endif
+#ifdef USE_LIBPOLY
+typedef carl::LPPolynomial LPP;
+#endif
 
 
 template<typename Coeff>
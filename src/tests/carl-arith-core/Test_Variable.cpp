@@ -2,6 +2,7 @@
 
 #include <carl-arith/core/Variable.h>
 #include <carl-arith/core/VariablePool.h>
+#include <carl-arith/core/Variables.h>
 
 #include "../util.h"
 
@@ -27,3 +28,20 @@ TEST(Variable, Comparison)
 	list.push_back(v1);
 	list.push_back(v0);
 }
+
+TEST(VariableSignature, Sorted)
+{
+	carl::Variable x = carl::fresh_real_variable("x");
+	carl::Variable y = carl::fresh_real_variable("y");
+	carl::Variable z = carl::fresh_real_variable("z");
+	carl::carlVariables vars;
+	vars.add(z);
+	vars.add(x);
+	vars.add(y);
+	vars.add(x);
+	const carl::VariableSignature sig(std::move(vars));
+	EXPECT_EQ(3u, sig.size());
+	EXPECT_TRUE(std::is_sorted(sig.begin(), sig.end()));
+	EXPECT_TRUE(sig.has(x));
+	EXPECT_EQ(sig.variables(), carl::carlVariables({x, y, z}));
+}
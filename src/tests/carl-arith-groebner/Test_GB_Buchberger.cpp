@@ -76,3 +76,86 @@ TEST(GB_Buchberger, T1_ReasonSets)
     EXPECT_EQ(x,gb2object.getIdeal().getGenerator(0));
     EXPECT_EQ(y,gb2object.getIdeal().getGenerator(1));
 }
+
+namespace {
+/// The cyclic 4-roots problem.
+std::vector<MultivariatePolynomial<Rational>> cyclic4() {
+	std::vector<Variable> v;
+	for (std::size_t i = 0; i < 4; ++i) v.push_back(fresh_real_variable("c" + std::to_string(i)));
+	std::vector<MultivariatePolynomial<Rational>> res;
+	for (std::size_t d = 1; d < 4; ++d) {
+		MultivariatePolynomial<Rational> p;
+		for (std::size_t i = 0; i < 4; ++i) {
+			MultivariatePolynomial<Rational> t(Rational(1));
+			for (std::size_t j = 0; j < d; ++j) t *= v[(i + j) % 4];
+			p += t;
+		}
+		res.push_back(p);
+	}
+	res.push_back(MultivariatePolynomial<Rational>(v[0]) * v[1] * v[2] * v[3] - Rational(1));
+	return res;
+}
+
+std::vector<MultivariatePolynomial<Rational>> computeGB(const std::vector<MultivariatePolynomial<Rational>>& input, const GBSettings& settings) {
+	GBProcedure<MultivariatePolynomial<Rational>, Buchberger, StdAdding> gb;
+	gb.setSettings(settings);
+	for (const auto& p: input) gb.addPolynomial(p);
+	gb.reduceInput();
+	gb.calculate();
+	auto res = gb.getBasisPolynomials();
+	std::sort(res.begin(), res.end(), MultivariatePolynomial<Rational>::compareByLeadingTerm);
+	return res;
+}
+}
+
+TEST(GB_Buchberger, Settings)
+{
+	auto input = cyclic4();
+	auto reference = computeGB(input, GBSettings());
+	for (auto selection: {GBSelectionStrategy::Normal, GBSelectionStrategy::Sugar, GBSelectionStrategy::Degree}) {
+		for (bool product: {true, false}) {
+			for (bool chain: {true, false}) {
+				GBSettings settings;
+				settings.selection = selection;
+				settings.productCriterion = product;
+				settings.chainCriterion = chain;
+				EXPECT_EQ(reference, computeGB(input, settings)) << selection << " " << product << " " << chain;
+			}
+		}
+	}
+}
+
+TEST(GB_Buchberger, Statistics)
+{
+	// The statistics are shared with other tests, hence we only look at differences.
+	auto& stats = *BuchbergerStats::getInstance();
+	auto input = cyclic4();
+	std::size_t created = stats.pairsCreated.count();
+	computeGB(input, GBSettings());
+	EXPECT_EQ(stats.pairsCreated.count(), created);
+
+	std::size_t removed = stats.pairsRemovedProduct.count() + stats.pairsRemovedChain.count() + stats.pairsRemovedGebauerMoeller.count();
+	std::size_t reduced = stats.pairsReduced.count();
+	std::size_t zero = stats.zeroReductions.count();
+	std::size_t steps = stats.reductionSteps.count();
+	std::size_t updates = stats.timeUpdate.count();
+	std::size_t interreductions = stats.timeInterreduction.count();
+	stats.set_enabled(true);
+	GBSettings settings;
+	computeGB(input, settings);
+	std::size_t withCriteria = stats.pairsReduced.count() - reduced;
+	EXPECT_GT(stats.pairsCreated.count(), created);
+	EXPECT_GT(stats.pairsRemovedProduct.count() + stats.pairsRemovedChain.count() + stats.pairsRemovedGebauerMoeller.count(), removed);
+	EXPECT_GT(stats.zeroReductions.count(), zero);
+	EXPECT_GT(stats.reductionSteps.count(), steps);
+	EXPECT_EQ(stats.degree.max(), 6);
+	EXPECT_GT(stats.timeUpdate.count(), updates);
+	EXPECT_EQ(stats.timeInterreduction.count(), interreductions + 1);
+
+	settings.productCriterion = false;
+	settings.chainCriterion = false;
+	reduced = stats.pairsReduced.count();
+	computeGB(input, settings);
+	stats.set_enabled(false);
+	EXPECT_GT(stats.pairsReduced.count() - reduced, withCriteria);
+}
@@ -0,0 +1,114 @@
+#include "gtest/gtest.h"
+
+#include <carl-arith/groebner/groebner.h>
+
+#include "../Common.h"
+
+
+using namespace carl;
+
+namespace {
+/// The cyclic 4-roots problem.
+std::vector<MultivariatePolynomial<Rational>> cyclic4() {
+	std::vector<Variable> v;
+	for (std::size_t i = 0; i < 4; ++i) v.push_back(fresh_real_variable("c" + std::to_string(i)));
+	std::vector<MultivariatePolynomial<Rational>> res;
+	for (std::size_t d = 1; d < 4; ++d) {
+		MultivariatePolynomial<Rational> p;
+		for (std::size_t i = 0; i < 4; ++i) {
+			MultivariatePolynomial<Rational> t(Rational(1));
+			for (std::size_t j = 0; j < d; ++j) t *= v[(i + j) % 4];
+			p += t;
+		}
+		res.push_back(p);
+	}
+	res.push_back(MultivariatePolynomial<Rational>(v[0]) * v[1] * v[2] * v[3] - Rational(1));
+	return res;
+}
+
+template<template<typename, template<typename> class> class Procedure>
+std::vector<MultivariatePolynomial<Rational>> computeGB(const std::vector<MultivariatePolynomial<Rational>>& input) {
+	GBProcedure<MultivariatePolynomial<Rational>, Procedure, StdAdding> gb;
+	for (const auto& p: input) gb.addPolynomial(p);
+	gb.reduceInput();
+	gb.calculate();
+	auto res = gb.getBasisPolynomials();
+	std::sort(res.begin(), res.end(), MultivariatePolynomial<Rational>::compareByLeadingTerm);
+	return res;
+}
+}
+
+TEST(GB_Signature, T1)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+
+	MultivariatePolynomial<Rational> f1({(Rational)1*x*x*x, (Rational)-2*x*y});
+	MultivariatePolynomial<Rational> f2({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x});
+	MultivariatePolynomial<Rational> F1({(Rational)1*x*x});
+	MultivariatePolynomial<Rational> F2({(Rational)1*y*y, (Rational)-1*(Rational)1/(Rational)2*x});
+	MultivariatePolynomial<Rational> F3({(Rational)1*x*y});
+	GBProcedure<MultivariatePolynomial<Rational>, SignatureGB, StdAdding> gbobject;
+	gbobject.addPolynomial(f1);
+	gbobject.addPolynomial(f2);
+	gbobject.calculate();
+	ASSERT_EQ(3, gbobject.getIdeal().nrGenerators());
+	EXPECT_EQ(F1, gbobject.getIdeal().getGenerator(0));
+	EXPECT_EQ(F3, gbobject.getIdeal().getGenerator(1));
+	EXPECT_EQ(F2, gbobject.getIdeal().getGenerator(2));
+}
+
+TEST(GB_Signature, SameAsBuchberger)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	MultivariatePolynomial<Rational> px(x);
+	MultivariatePolynomial<Rational> py(y);
+	MultivariatePolynomial<Rational> pz(z);
+
+	std::vector<std::vector<MultivariatePolynomial<Rational>>> inputs = {
+		cyclic4(),
+		{ px*px + py*py + pz*pz - Rational(1), px*py - pz, py*pz - px },
+		{ px*px*py - Rational(2)*py*pz + px, px*py*py - pz*pz, px*pz - py*py*py },
+		{ px - py, px*px - Rational(1), px*py - Rational(2) },
+	};
+	for (const auto& input: inputs) {
+		EXPECT_EQ(computeGB<Buchberger>(input), computeGB<SignatureGB>(input));
+	}
+}
+
+TEST(GB_Signature, Incremental)
+{
+	auto input = cyclic4();
+	GBProcedure<MultivariatePolynomial<Rational>, SignatureGB, StdAdding> gb;
+	gb.addPolynomial(input[0]);
+	gb.addPolynomial(input[1]);
+	gb.reduceInput();
+	gb.calculate();
+	gb.addPolynomial(input[2]);
+	gb.addPolynomial(input[3]);
+	gb.reduceInput();
+	gb.calculate();
+	auto res = gb.getBasisPolynomials();
+	std::sort(res.begin(), res.end(), MultivariatePolynomial<Rational>::compareByLeadingTerm);
+	EXPECT_EQ(computeGB<Buchberger>(input), res);
+}
+
+TEST(GB_Signature, Statistics)
+{
+	// The statistics are shared with other tests, hence we only look at differences.
+	auto& stats = *BuchbergerStats::getInstance();
+	auto input = cyclic4();
+	stats.set_enabled(true);
+	std::size_t zero = stats.zeroReductions.count();
+	computeGB<Buchberger>(input);
+	std::size_t buchbergerZero = stats.zeroReductions.count() - zero;
+	std::size_t avoided = stats.getNrZeroReductionsAvoided();
+	zero = stats.zeroReductions.count();
+	computeGB<SignatureGB>(input);
+	std::size_t signatureZero = stats.zeroReductions.count() - zero;
+	stats.set_enabled(false);
+	EXPECT_GT(stats.getNrZeroReductionsAvoided(), avoided);
+	EXPECT_LT(signatureZero, buchbergerZero);
+}
@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include <carl-arith/groebner/Reductor.h>
+#include <carl-arith/groebner/ReductorGeobucket.h>
 #include <carl-common/meta/platform.h>
 
 #include "../Common.h"
@@ -50,3 +51,27 @@ TEST(Reductor, Reduction)
     fres = reductor4.fullReduce();
     EXPECT_EQ((Rational)-1 * z, fres);
 }
+
+TEST(Reductor, Geobucket)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	using Poly = MultivariatePolynomial<Rational>;
+	Ideal<Poly> ideal;
+	ideal.addGenerator(Poly(x) * x + Poly(z) * y - Rational(1));
+	ideal.addGenerator(Poly(y) * y - Poly(x) * z + Poly(z));
+	ideal.addGenerator(Poly(x) * z * z + Poly(y));
+
+	Poly f = Poly(x) * x * y * y + Poly(x) * x * x * z + Poly(y) * y * z * z - Poly(x) * y + Rational(3);
+	Reductor<Poly, Poly> heap(ideal, f);
+	Reductor<Poly, Poly, ReductorGeobucket> geobucket(ideal, f);
+	Poly expected = heap.fullReduce();
+	EXPECT_EQ(expected, geobucket.fullReduce());
+	EXPECT_EQ(heap.reductionSteps(), geobucket.reductionSteps());
+
+	Poly g = Poly(x) * y * ideal.getGenerator(2) - Poly(z) * ideal.getGenerator(0);
+	Reductor<Poly, Poly> heap2(ideal, g);
+	Reductor<Poly, Poly, ReductorGeobucket> geobucket2(ideal, g);
+	EXPECT_EQ(heap2.fullReduce(), geobucket2.fullReduce());
+}
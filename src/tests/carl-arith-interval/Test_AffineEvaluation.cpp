@@ -0,0 +1,57 @@
+#include "gtest/gtest.h"
+#include <carl-arith/core/VariablePool.h>
+#include <carl-arith/poly/umvpoly/functions/AffineEvaluation.h>
+#include <carl-arith/poly/umvpoly/functions/Evaluation.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+TEST(AffineEvaluation, Dependency)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	std::map<Variable, Interval<double>> map = {{x, Interval<double>(1.0, 1.5)}, {y, Interval<double>(-0.25, 0.25)}};
+	// x - x*y - x is exactly -x*y, interval evaluation cannot see this.
+	Poly p = Poly(x) * x - Poly(x) * y - Rational(2) * x;
+	auto naive = evaluate(p, map);
+	auto affine = evaluate_affine(p, map);
+	EXPECT_LT(affine.diameter(), naive.diameter());
+	EXPECT_EQ(set_intersection(naive, affine), evaluate_tight(p, map));
+
+	// All values in the box must be enclosed.
+	for (double xv: {1.0, 1.1, 1.25, 1.4, 1.5}) {
+		for (double yv: {-0.25, -0.1, 0.0, 0.2, 0.25}) {
+			std::map<Variable, Rational> point = {{x, carl::rationalize<Rational>(xv)}, {y, carl::rationalize<Rational>(yv)}};
+			double value = carl::to_double(carl::evaluate(p, point));
+			EXPECT_TRUE(affine.contains(value)) << value << " not in " << affine;
+		}
+	}
+}
+
+TEST(AffineEvaluation, Rounding)
+{
+	Variable x = fresh_real_variable("x");
+	// Coefficients that are not representable as doubles must be enclosed.
+	Poly p = Rational(1, 3) * Poly(x) + Rational(1, 10);
+	std::map<Variable, Interval<double>> map = {{x, Interval<double>(3.0)}};
+	auto res = evaluate_affine(p, map);
+	EXPECT_LE(res.lower(), 1.1);
+	EXPECT_GE(res.upper(), 1.1);
+	EXPECT_LT(res.diameter(), 1e-12);
+	EXPECT_TRUE(res.contains(1.1));
+}
+
+TEST(AffineEvaluation, Special)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Poly p = Poly(x) * y + Rational(1);
+	EXPECT_EQ(Interval<double>(0), evaluate_affine(Poly(), std::map<Variable, Interval<double>>()));
+	std::map<Variable, Interval<double>> unbounded = {{x, Interval<double>(0.0, BoundType::WEAK, 0.0, BoundType::INFTY)}, {y, Interval<double>(1.0, 2.0)}};
+	EXPECT_EQ(evaluate(p, unbounded), evaluate_affine(p, unbounded));
+	std::map<Variable, Interval<double>> empty = {{x, Interval<double>::empty_interval()}, {y, Interval<double>(1.0, 2.0)}};
+	EXPECT_TRUE(evaluate_affine(p, empty).is_empty());
+}
@@ -0,0 +1,95 @@
+#include "gtest/gtest.h"
+
+#include <carl-arith/interval/FastDoubleInterval.h>
+
+#include <cmath>
+#include <limits>
+
+using namespace carl;
+
+using FDI = FastDoubleInterval;
+
+TEST(FastDoubleInterval, Constructor)
+{
+	EXPECT_TRUE(FDI(1.0, -1.0).is_empty());
+	EXPECT_TRUE(FDI(1.0, BoundType::STRICT, 1.0, BoundType::WEAK).is_empty());
+	EXPECT_EQ(FDI::empty_interval(), FDI(2.0, BoundType::STRICT, 1.0, BoundType::STRICT));
+	EXPECT_TRUE(FDI(1.0).is_point_interval());
+	EXPECT_TRUE(FDI().is_zero());
+	EXPECT_TRUE(FDI(0.0, BoundType::INFTY, 0.0, BoundType::INFTY).is_unbounded());
+
+	FDI half(1.0, BoundType::STRICT, 0.0, BoundType::INFTY);
+	EXPECT_EQ(BoundType::STRICT, half.lower_bound_type());
+	EXPECT_EQ(BoundType::INFTY, half.upper_bound_type());
+	EXPECT_FALSE(half.contains(1.0));
+	EXPECT_TRUE(half.contains(1e300));
+}
+
+TEST(FastDoubleInterval, Conversion)
+{
+	for (const auto& i: {Interval<double>(-1.0, 2.0), Interval<double>(-1.0, BoundType::STRICT, 2.0, BoundType::INFTY), Interval<double>(0.5, BoundType::INFTY, 0.5, BoundType::STRICT), Interval<double>::unbounded_interval(), Interval<double>::empty_interval()}) {
+		EXPECT_EQ(i, FDI(i).to_interval());
+	}
+}
+
+TEST(FastDoubleInterval, Arithmetic)
+{
+	FDI a(-1.0, 2.0);
+	FDI b(3.0, BoundType::STRICT, 4.0, BoundType::WEAK);
+	EXPECT_EQ(FDI(2.0, BoundType::STRICT, 6.0, BoundType::WEAK), a + b);
+	EXPECT_EQ(FDI(-5.0, BoundType::WEAK, -1.0, BoundType::STRICT), a - b);
+	EXPECT_EQ(FDI(-4.0, 8.0), a * b);
+	EXPECT_EQ(FDI(0.0, 4.0), pow(a, 2));
+	EXPECT_EQ(FDI(-1.0, 8.0), pow(a, 3));
+	EXPECT_EQ(FDI(9.0, BoundType::STRICT, 16.0, BoundType::WEAK), pow(b, 2));
+	EXPECT_EQ(FDI::unbounded_interval(), b / a);
+	EXPECT_EQ(FDI(-1.0/3, BoundType::STRICT, 2.0/3, BoundType::STRICT).lower_bound_type(), (a / b).lower_bound_type());
+	EXPECT_TRUE((a / b).contains(FDI(-1.0/3, 2.0/3)));
+
+	// Zero times an unbounded interval is zero.
+	EXPECT_EQ(FDI(0.0), FDI(0.0) * FDI::unbounded_interval());
+	EXPECT_EQ(FDI(0.0, BoundType::WEAK, 0.0, BoundType::INFTY), FDI(0.0, 1.0) * FDI(1.0, BoundType::WEAK, 0.0, BoundType::INFTY));
+}
+
+TEST(FastDoubleInterval, Rounding)
+{
+	// 0.1 + 0.2 is not exact, the result must contain both neighbours of the rounded value.
+	FDI sum = FDI(0.1) + FDI(0.2);
+	EXPECT_FALSE(sum.is_point_interval());
+	EXPECT_TRUE(sum.contains(0.1 + 0.2));
+	EXPECT_LT(sum.lower(), 0.1 + 0.2);
+	FDI third = FDI(1.0) / FDI(3.0);
+	EXPECT_LT(third.lower(), third.upper());
+	EXPECT_EQ(std::nextafter(third.lower(), 1.0), third.upper());
+	// Exact results stay exact.
+	EXPECT_EQ(FDI(0.75), FDI(3.0) / FDI(4.0));
+	EXPECT_EQ(FDI(12.0), FDI(3.0) * FDI(4.0));
+	// Overflow is rounded towards the largest double for lower bounds.
+	FDI huge = FDI(1e200) * FDI(1e200);
+	EXPECT_EQ(std::numeric_limits<double>::max(), huge.lower());
+	EXPECT_EQ(BoundType::INFTY, huge.upper_bound_type());
+	// Operands beyond 2^996, where the rounding error of the product may not be computable.
+	double big = std::ldexp(1.0 + std::ldexp(1.0, -52), 1000);
+	double factor = 1.0 + std::ldexp(1.0, -52);
+	FDI product = FDI(big) * FDI(factor);
+	EXPECT_LT(product.lower(), product.upper());
+	EXPECT_LE(product.lower(), big * factor);
+	// The exact product is 2^1000 * (1 + 2^-51 + 2^-104), which is larger than the rounded product.
+	EXPECT_GT(product.upper(), big * factor);
+	FDI negated = FDI(-big) * FDI(factor);
+	EXPECT_LT(negated.lower(), -(big * factor));
+	EXPECT_GE(negated.upper(), -(big * factor));
+}
+
+TEST(FastDoubleInterval, SetTheory)
+{
+	FDI a(-1.0, 2.0);
+	FDI b(1.0, BoundType::STRICT, 3.0, BoundType::WEAK);
+	EXPECT_EQ(FDI(1.0, BoundType::STRICT, 2.0, BoundType::WEAK), a.intersect(b));
+	EXPECT_EQ(FDI(-1.0, 3.0), a.convex_hull(b));
+	EXPECT_TRUE(a.intersect(FDI(5.0, 6.0)).is_empty());
+	EXPECT_TRUE(a.contains(FDI(0.0, 1.0)));
+	EXPECT_FALSE(b.contains(FDI(1.0, 2.0)));
+	EXPECT_EQ(3.0, a.diameter());
+	EXPECT_EQ(0.5, a.center());
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include <carl-arith/core/VariablePool.h>
+#include <carl-arith/intervalcontraction/Propagator.h>
+
+#include "../number_types.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+using Constr = BasicConstraint<Poly>;
+
+TEST(HC4, Contract)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	std::map<Variable, std::size_t> index;
+	// x^2 + y - 4 = 0
+	contractor::HC4<Poly> hc4(Constr(Poly(x)*x + y - Rational(4), Relation::EQ), index);
+	ASSERT_EQ(2u, index.size());
+	std::vector<Interval<double>> box(2);
+	box[index[x]] = Interval<double>(1.0, 10.0);
+	box[index[y]] = Interval<double>(-5.0, 5.0);
+	std::vector<std::size_t> changed;
+	EXPECT_TRUE(hc4.contract(box, changed));
+	// x^2 = 4 - y in [-1, 9], hence x in [1, 3], y = 4 - x^2 in [-5, 3]
+	EXPECT_EQ(2u, changed.size());
+	EXPECT_TRUE(Interval<double>(1.0, 3.0).contains(box[index[x]]));
+	EXPECT_TRUE(box[index[x]].contains(Interval<double>(1.0, 2.99)));
+	EXPECT_TRUE(box[index[y]].upper() <= 3.0 + 1e-9);
+
+	// x^2 + y - 4 = 0 has no solution with y > 4 and x >= 1
+	box[index[x]] = Interval<double>(1.0, 10.0);
+	box[index[y]] = Interval<double>(4.5, 5.0);
+	EXPECT_FALSE(hc4.contract(box, changed));
+}
+
+TEST(HC4, Disequality)
+{
+	Variable x = fresh_real_variable("x");
+	std::map<Variable, std::size_t> index;
+	contractor::HC4<Poly> hc4(Constr(Poly(x) - Rational(1), Relation::NEQ), index);
+	std::vector<Interval<double>> box = { Interval<double>(1.0) };
+	std::vector<std::size_t> changed;
+	EXPECT_FALSE(hc4.contract(box, changed));
+	box[0] = Interval<double>(0.0, 2.0);
+	EXPECT_TRUE(hc4.contract(box, changed));
+	EXPECT_TRUE(changed.empty());
+}
+
+TEST(HC4, SharedHorner)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	std::map<Variable, std::size_t> index;
+	Poly p = Poly(x)*x*y + Rational(2)*x - y;
+	contractor::HC4<Poly> lower(Constr(p, Relation::GEQ), index);
+	contractor::HC4<Poly> upper(Constr(p, Relation::LEQ), index);
+	// Both contractors use the same Horner form, which stays in the pool while they exist.
+	ASSERT_NE(nullptr, lower.horner());
+	EXPECT_EQ(lower.horner(), upper.horner());
+	EXPECT_EQ(lower.horner(), horner_form<double>(p));
+	contractor::HC4<Poly> constant(Constr(Poly(Rational(1)), Relation::GEQ), index);
+	EXPECT_EQ(nullptr, constant.horner());
+}
+
+TEST(Propagator, Propagate)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_integer_variable("z");
+	contractor::Propagator<Poly> prop;
+	// y = x^2, x + y <= 2, z = 2*y
+	prop.add(Constr(Poly(y) - Poly(x)*x, Relation::EQ));
+	prop.add(Constr(Poly(x) + y - Rational(2), Relation::LEQ));
+	prop.add(Constr(Poly(z) - Rational(2)*y, Relation::EQ));
+	EXPECT_EQ(3u, prop.size());
+	EXPECT_EQ(3u, prop.variables().size());
+
+	std::map<Variable, Interval<double>> box = {
+		{x, Interval<double>(0.0, 10.0)},
+		{y, Interval<double>(0.0, 10.0)},
+		{z, Interval<double>(-100.0, 100.0)}
+	};
+	EXPECT_EQ(contractor::PropagationResult::CONTRACTED, prop.propagate(box));
+	// y <= 2 implies x <= sqrt(2) and z in {0, ..., 4}
+	EXPECT_LE(box[x].upper(), 1.4143);
+	EXPECT_LE(box[y].upper(), 2.0001);
+	EXPECT_TRUE(Interval<double>(0.0, 4.0).contains(box[z]));
+	EXPECT_GT(prop.revisions(), 0u);
+	// Propagation eventually reaches a fixed point.
+	auto res = contractor::PropagationResult::CONTRACTED;
+	for (std::size_t i = 0; i < 100 && res == contractor::PropagationResult::CONTRACTED; ++i) {
+		res = prop.propagate(box);
+	}
+	EXPECT_EQ(contractor::PropagationResult::UNCHANGED, res);
+
+	box[x] = Interval<double>(3.0, 4.0);
+	EXPECT_EQ(contractor::PropagationResult::EMPTY, prop.propagate(box));
+}
+
+TEST(Propagator, UnboundedUnchanged)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	contractor::Propagator<Poly> prop;
+	// y + x^2 y <= 1 contracts y, but leaves x unbounded.
+	prop.add(Constr(Poly(y) + Poly(x)*x*y - Rational(1), Relation::LEQ));
+	prop.add(Constr(Poly(x) - z, Relation::LEQ));
+	std::map<Variable, Interval<double>> box = {{y, Interval<double>(0.0, 10.0)}};
+	EXPECT_EQ(contractor::PropagationResult::CONTRACTED, prop.propagate(box));
+	EXPECT_EQ(Interval<double>(0.0, 1.0), box[y]);
+	EXPECT_EQ(Interval<double>::unbounded_interval(), box[x]);
+	// The unchanged interval of x does not schedule the second constraint again.
+	EXPECT_EQ(2u, prop.revisions());
+}
+
+TEST(Propagator, Split)
+{
+	Variable x = fresh_real_variable("x");
+	Variable n = fresh_integer_variable("n");
+	contractor::Propagator<Poly> prop;
+	prop.add(Constr(Poly(x)*x - Rational(2), Relation::EQ));
+	prop.add(Constr(Poly(n) - x, Relation::LEQ));
+	auto box = prop.to_box({{x, Interval<double>(-2.0, 2.0)}, {n, Interval<double>(-3.0, 3.0)}});
+	EXPECT_EQ(contractor::PropagationResult::CONTRACTED, prop.propagate(box));
+	std::size_t ix = prop.variables()[0] == x ? 0 : 1;
+	std::size_t in = 1 - ix;
+	// n in [-3, 1] is wider than x in [-sqrt(2), sqrt(2)]
+	EXPECT_EQ(in, prop.split_variable(box));
+
+	std::vector<Interval<double>> left, right;
+	ASSERT_TRUE(prop.split(box, ix, left, right));
+	// Propagating both halves isolates the two roots of x^2 - 2.
+	EXPECT_NE(contractor::PropagationResult::EMPTY, prop.propagate(left));
+	EXPECT_NE(contractor::PropagationResult::EMPTY, prop.propagate(right));
+	EXPECT_TRUE(left[ix].contains(-std::sqrt(2.0)));
+	EXPECT_LT(left[ix].diameter(), 1e-9);
+	EXPECT_EQ(Interval<double>(-3.0, -2.0), left[in]);
+	EXPECT_TRUE(right[ix].contains(std::sqrt(2.0)));
+	EXPECT_LT(right[ix].diameter(), 1e-9);
+	EXPECT_EQ(Interval<double>(-3.0, 1.0), right[in]);
+}
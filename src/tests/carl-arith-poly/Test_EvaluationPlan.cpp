@@ -0,0 +1,120 @@
+#include "gtest/gtest.h"
+
+#include <carl-arith/poly/umvpoly/MultivariatePolynomial.h>
+#include <carl-arith/poly/umvpoly/functions/Evaluation.h>
+#include <carl-arith/poly/umvpoly/functions/EvaluationPlan.h>
+#include <carl-arith/poly/umvpoly/functions/IntervalBatchEvaluation.h>
+#include <carl-arith/poly/umvpoly/functions/IntervalEvaluation.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+TEST(EvaluationPlan, Rational)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	Poly p = Rational(3)*x*x*x*y + Rational(-2)*x*y*y + Rational(5)*x*x + z*z*z*z + Rational(7);
+	EvaluationPlan<Rational> plan(p, {x, y, z});
+	for (int i = -3; i <= 3; ++i) {
+		std::map<Variable, Rational> point = {{x, Rational(i)}, {y, Rational(i+1)/2}, {z, Rational(2-i)}};
+		EXPECT_EQ(carl::evaluate(p, point), plan.evaluate(point));
+		EXPECT_EQ(carl::evaluate(p, point), plan.evaluate(std::vector<Rational>({point[x], point[y], point[z]})));
+	}
+	EvaluationPlan<Rational> reversed(p, {z, y, x});
+	std::map<Variable, Rational> point = {{x, Rational(2)}, {y, Rational(-1)}, {z, Rational(1)/3}};
+	EXPECT_EQ(carl::evaluate(p, point), reversed.evaluate(point));
+
+	EXPECT_EQ(Rational(0), EvaluationPlan<Rational>(Poly()).evaluate(std::vector<Rational>()));
+	EXPECT_EQ(Rational(4), EvaluationPlan<Rational>(Poly(Rational(4))).evaluate(std::vector<Rational>()));
+	EXPECT_EQ(Rational(-2), EvaluationPlan<Rational>(Poly(x)).evaluate(std::vector<Rational>({Rational(-2)})));
+}
+
+TEST(EvaluationPlan, Batch)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Poly p = Rational(Rational(1)/2)*x*x*y - Rational(3)*y*y + x + Rational(1);
+	EvaluationPlan<double> plan(p, {x, y});
+	std::vector<std::vector<double>> columns(2);
+	for (int i = 0; i < 100; ++i) {
+		columns[0].push_back(0.25 * i - 10);
+		columns[1].push_back(3 - 0.5 * i);
+	}
+	auto results = plan.evaluate_batch(columns);
+	ASSERT_EQ(results.size(), 100u);
+	for (std::size_t i = 0; i < 100; ++i) {
+		double xv = columns[0][i];
+		double yv = columns[1][i];
+		EXPECT_DOUBLE_EQ(0.5*xv*xv*yv - 3*yv*yv + xv + 1, results[i]);
+		EXPECT_DOUBLE_EQ(results[i], plan.evaluate(std::vector<double>({xv, yv})));
+	}
+}
+
+TEST(EvaluationPlan, Interval)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Poly p = Rational(Rational(1)/3)*x*x + x*y - Rational(2);
+	EvaluationPlan<Interval<double>> plan(p, {x, y});
+	std::map<Variable, Interval<double>> box = {{x, Interval<double>(-1.0, 2.0)}, {y, Interval<double>(0.5, 1.0)}};
+	auto res = plan.evaluate(box);
+	// The range of p over the box is [-8/3, 4/3].
+	EXPECT_TRUE(res.contains(Interval<double>(-2.66, 1.33)));
+	std::vector<std::vector<Interval<double>>> columns = {{box[x], Interval<double>(0.0)}, {box[y], Interval<double>(1.0)}};
+	auto results = plan.evaluate_batch(columns);
+	EXPECT_EQ(res, results[0]);
+	EXPECT_TRUE(results[1].contains(-2.0));
+}
+
+TEST(EvaluationPlan, IntervalBatch)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Poly p = Rational(Rational(1)/3)*x*x*x + x*y*y - Rational(2)*y + Rational(1);
+	IntervalBatchEvaluator eval(p, {x, y});
+	std::vector<std::map<Variable, Interval<double>>> boxes;
+	for (int i = -5; i <= 5; ++i) {
+		boxes.push_back({{x, Interval<double>(0.3 * i - 0.1, 0.3 * i + 0.7)}, {y, Interval<double>(-0.5 * i - 1, 2.5)}});
+	}
+	boxes.push_back({{x, Interval<double>(0.0)}, {y, Interval<double>(-1.0, 1.0)}});
+	boxes.push_back({{x, Interval<double>(1.0, BoundType::WEAK, 0.0, BoundType::INFTY)}, {y, Interval<double>(1.0)}});
+	auto results = eval.evaluate(boxes);
+	ASSERT_EQ(results.size(), boxes.size());
+	for (std::size_t i = 0; i < boxes.size(); ++i) {
+		// Both are valid enclosures over the same plan, but may differ by rounding.
+		auto reference = EvaluationPlan<Interval<double>>(p, {x, y}).evaluate(boxes[i]);
+		EXPECT_EQ(reference.lower_bound_type(), results[i].lower_bound_type());
+		EXPECT_EQ(reference.upper_bound_type(), results[i].upper_bound_type());
+		if (reference.lower_bound_type() != BoundType::INFTY) EXPECT_NEAR(reference.lower(), results[i].lower(), 1e-9);
+		if (reference.upper_bound_type() != BoundType::INFTY) EXPECT_NEAR(reference.upper(), results[i].upper(), 1e-9);
+		// Sample points of the box must be contained in the result.
+		for (double t: {0.0, 0.5, 1.0}) {
+			if (boxes[i][x].upper_bound_type() == BoundType::INFTY) continue;
+			double xv = boxes[i][x].lower() + t * (boxes[i][x].upper() - boxes[i][x].lower());
+			double yv = boxes[i][y].lower() + t * (boxes[i][y].upper() - boxes[i][y].lower());
+			EXPECT_TRUE(results[i].contains(xv*xv*xv/3 + xv*yv*yv - 2*yv + 1));
+		}
+	}
+	EXPECT_EQ(BoundType::INFTY, results.back().upper_bound_type());
+	EXPECT_EQ(results[3], eval.evaluate(boxes[3]));
+
+	std::vector<IntervalBatchEvaluator> evals = {eval, IntervalBatchEvaluator(Poly(x) * x), IntervalBatchEvaluator(Poly(Rational(3)))};
+	auto multi = IntervalBatchEvaluator::evaluate(evals, boxes[0]);
+	ASSERT_EQ(multi.size(), 3u);
+	EXPECT_EQ(results[0], multi[0]);
+	EXPECT_TRUE(multi[1].contains(Interval<double>(0.65, 2.55)));
+	EXPECT_GE(multi[1].lower(), 0.0);
+	EXPECT_TRUE(multi[2].contains(3.0));
+
+	// Inexact operations are rounded outwards, exact ones are not widened.
+	auto sum = IntervalBatchEvaluator(Poly(x) + y).evaluate({{x, Interval<double>(0.1)}, {y, Interval<double>(0.2)}});
+	EXPECT_LT(sum.lower(), 0.1 + 0.2);
+	EXPECT_GT(sum.upper(), sum.lower());
+	EXPECT_TRUE(sum.contains(0.1 + 0.2));
+	auto product = IntervalBatchEvaluator(Poly(x) * y).evaluate({{x, Interval<double>(3.0)}, {y, Interval<double>(-4.0)}});
+	EXPECT_EQ(Interval<double>(-12.0), product);
+}
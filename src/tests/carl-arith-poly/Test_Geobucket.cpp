@@ -0,0 +1,67 @@
+#include "gtest/gtest.h"
+#include <carl-arith/poly/umvpoly/Geobucket.h>
+#include <carl-arith/poly/umvpoly/MultivariatePolynomial.h>
+#include <carl-arith/poly/umvpoly/functions/Division.h>
+#include <carl-arith/poly/umvpoly/functions/Remainder.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+TEST(Geobucket, Accumulate)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Poly p = Poly(x) * x + Poly(x) * y + Poly(y) + Rational(3);
+	Poly q = Poly(y) * y - Poly(x) + Rational(1);
+
+	Geobucket<Poly> bucket;
+	EXPECT_TRUE(bucket.empty());
+	Poly sum;
+	for (std::size_t i = 0; i < 20; ++i) {
+		Term<Rational> factor(Rational(i % 3) - 1, (i % 2 == 0) ? createMonomial(x, 1) : createMonomial(y, 2));
+		bucket.add(factor, (i % 2 == 0) ? p : q);
+		sum += factor * ((i % 2 == 0) ? p : q);
+		bucket.add(p);
+		sum += p;
+	}
+	ASSERT_FALSE(bucket.empty());
+	EXPECT_EQ(sum.lterm(), bucket.lterm());
+	bucket.strip_lterm();
+	sum.strip_lterm();
+	EXPECT_EQ(sum, bucket.to_polynomial());
+	EXPECT_TRUE(bucket.empty());
+}
+
+TEST(Geobucket, Cancellation)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Poly p = Poly(x) * y + Poly(x) + Rational(1);
+
+	Geobucket<Poly> bucket(p);
+	bucket.add(Term<Rational>(Rational(2)), p);
+	bucket.add(Term<Rational>(Rational(-3)), p);
+	EXPECT_TRUE(bucket.empty());
+	EXPECT_TRUE(is_zero(bucket.to_polynomial()));
+
+	bucket.add(p);
+	bucket.add(Term<Rational>(Rational(-1), createMonomial(x, 1) * y));
+	EXPECT_EQ(Term<Rational>(Rational(1), createMonomial(x, 1)), bucket.lterm());
+}
+
+TEST(Geobucket, Division)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	Poly divisor = Poly(x) * y - Poly(z) * z + Rational(2);
+	Poly quotient = Poly(x) * x * z + Poly(y) * y - Rational(1, 2) * Poly(z);
+	Poly rest = Poly(x) + Poly(y) + Rational(7);
+	auto res = carl::divide(quotient * divisor + rest, divisor);
+	EXPECT_EQ(quotient, res.quotient);
+	EXPECT_EQ(rest, res.remainder);
+	EXPECT_EQ(rest, carl::remainder(quotient * divisor + rest, divisor));
+}
@@ -0,0 +1,78 @@
+#include "gtest/gtest.h"
+
+#include <carl-arith/poly/umvpoly/MultivariatePolynomial.h>
+#include <carl-arith/poly/umvpoly/functions/Evaluation.h>
+#include <carl-arith/poly/umvpoly/functions/IntervalEvaluation.h>
+#include <carl-arith/poly/umvpoly/functions/horner/HornerForm.h>
+
+#include "../Common.h"
+
+#ifdef THREAD_SAFE
+#include <thread>
+#endif
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+TEST(HornerForm, Evaluate)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	Poly p = Rational(3)*x*x*x*y + Rational(-2)*x*y*y + Rational(5)*x*x + z*z*z*z + Rational(7);
+	HornerForm<Poly> form(p);
+	HornerForm<Poly>::Workspace ws;
+	for (int i = -3; i <= 3; ++i) {
+		std::map<Variable, Interval<double>> box = {
+			{x, Interval<double>(i, i + 1)},
+			{y, Interval<double>(-0.5 * i - 1, 0.5)},
+			{z, Interval<double>(i)}
+		};
+		auto res = form.evaluate(box, ws);
+		EXPECT_EQ(carl::evaluate(form.horner(), box), res);
+		Rational value = carl::evaluate(p, std::map<Variable, Rational>({{x, Rational(i)}, {y, Rational(1)/2}, {z, Rational(i)}}));
+		EXPECT_TRUE(res.contains(carl::to_double(value)));
+		std::vector<Interval<double>> dense;
+		for (auto v: form.variables()) dense.push_back(box[v]);
+		EXPECT_EQ(res, form.evaluate(dense.data(), ws));
+	}
+	EXPECT_EQ(Interval<double>(4), HornerForm<Poly>(Poly(Rational(4))).evaluate({}));
+}
+
+TEST(HornerForm, Pool)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Poly p = x*x*y + Rational(2)*x*y - y + Rational(1);
+	auto f1 = horner_form(p);
+	auto f2 = horner_form(Poly(x*x*y + Rational(2)*x*y - y + Rational(1)));
+	EXPECT_EQ(f1.get(), f2.get());
+	EXPECT_NE(f1.get(), horner_form(p + Rational(1)).get());
+	std::map<Variable, Interval<double>> box = {{x, Interval<double>(-1, 1)}, {y, Interval<double>(0, 2)}};
+	EXPECT_EQ(carl::evaluate(MultivariateHorner<Poly, strategy>(p), box), f1->evaluate(box));
+}
+
+#ifdef THREAD_SAFE
+TEST(HornerForm, Concurrent)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	std::vector<Poly> polys;
+	for (int i = 1; i <= 8; ++i) polys.push_back(x*x*y + Rational(i)*x + y);
+	std::vector<std::vector<const HornerForm<Poly>*>> results(4);
+	std::vector<std::shared_ptr<const HornerForm<Poly>>> keep;
+	for (const auto& p: polys) keep.push_back(horner_form(p));
+	std::vector<std::thread> threads;
+	for (std::size_t t = 0; t < results.size(); ++t) {
+		threads.emplace_back([&polys, &results, t]() {
+			for (const auto& p: polys) results[t].push_back(horner_form(p).get());
+		});
+	}
+	for (auto& t: threads) t.join();
+	for (const auto& r: results) {
+		ASSERT_EQ(polys.size(), r.size());
+		for (std::size_t i = 0; i < r.size(); ++i) EXPECT_EQ(keep[i].get(), r[i]);
+	}
+}
+#endif
@@ -1,5 +1,7 @@
 #include "gtest/gtest.h"
 #include <carl-arith/poly/umvpoly/UnivariatePolynomial.h>
+#include <carl-arith/poly/umvpoly/functions/ParallelMultiplication.h>
+#include <carl-arith/poly/umvpoly/functions/Power.h>
 #include <carl-arith/poly/umvpoly/functions/Quotient.h>
 #include <carl-arith/poly/umvpoly/functions/SPolynomial.h>
 #include <carl-arith/poly/umvpoly/functions/to_univariate_polynomial.h>
@@ -559,6 +561,45 @@ TEST(MultivariatePolynomial, Quotient2)
     EXPECT_EQ( p7, carl::quotient(p7, p6)*p6 );
 }
 
+TEST(MultivariatePolynomial, ParallelMultiply)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	MultivariatePolynomial<Rational> p = carl::pow(MultivariatePolynomial<Rational>(x) + y + z + Rational(1), 4);
+	MultivariatePolynomial<Rational> q = carl::pow(MultivariatePolynomial<Rational>(x) - y + Rational(2)*z - Rational(3), 3);
+	MultivariatePolynomial<Rational> r = p * q;
+	// A threshold of zero enforces the parallel computation, if available.
+	for (std::size_t threads: {1, 2, 3, 8}) {
+		EXPECT_EQ(r, carl::parallel_multiply(p, q, threads, 0));
+		EXPECT_EQ(r, carl::parallel_multiply(q, p, threads, 0));
+	}
+	// Partial products that cancel.
+	EXPECT_EQ(p * p - q * q, carl::parallel_multiply(p + q, p - q, 4, 0));
+	EXPECT_TRUE(carl::is_zero(carl::parallel_multiply(p, MultivariatePolynomial<Rational>(), 4, 0)));
+	EXPECT_EQ(p, carl::parallel_multiply(p, MultivariatePolynomial<Rational>(Rational(1)), 4, 0));
+#ifdef THREAD_SAFE
+	// The products above used the workers of the thread pool, which are reused by later products.
+	std::size_t workers = carl::ThreadPool::getInstance().size();
+	EXPECT_GE(workers, 7u);
+	for (std::size_t i = 0; i < 10; ++i) {
+		EXPECT_EQ(r, carl::parallel_multiply(p, q, 8, 0));
+	}
+	EXPECT_EQ(workers, carl::ThreadPool::getInstance().size());
+#endif
+}
+
+TEST(MultivariatePolynomial, Pow)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	MultivariatePolynomial<Rational> p = x*y - Rational(2)*x + y + Rational(1);
+	for (std::size_t exp = 0; exp < 10; ++exp) {
+		EXPECT_EQ(carl::pow_naive(p, exp), carl::pow(p, exp));
+	}
+	EXPECT_TRUE(carl::is_zero(carl::pow(MultivariatePolynomial<Rational>(), 3)));
+}
+
 TYPED_TEST(MultivariatePolynomialTest, MultivariatePolynomialMultiplication)
 {
     Variable x = fresh_real_variable("x");
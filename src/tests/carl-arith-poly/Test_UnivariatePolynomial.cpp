@@ -7,6 +7,10 @@
 #include <carl-arith/poly/umvpoly/functions/Resultant.h>
 #include <carl-arith/poly/umvpoly/functions/Factorization_univariate.h>
 #include <carl-arith/poly/umvpoly/functions/Derivative.h>
+#include <carl-arith/poly/umvpoly/functions/Evaluation.h>
+#include <carl-arith/poly/umvpoly/functions/Remainder.h>
+#include <carl-arith/poly/umvpoly/functions/Substitution.h>
+#include <carl-arith/poly/umvpoly/functions/to_univariate_polynomial.h>
 #include <carl-arith/poly/umvpoly/functions/Representation.h>
 #include <carl-arith/poly/umvpoly/UnivariatePolynomial.h>
 #include <carl-arith/core/VariablePool.h>
@@ -17,6 +21,8 @@
 #include <carl-common/meta/platform.h>
 
 #include <random>
+#include <thread>
+#include <utility>
 #include <cmath>
 
 #include "../Common.h"
@@ -500,3 +506,156 @@ TEST(UnivariatePolynomial, coprimeFactor)
 
 	ASSERT_EQ(carl::get_denom(pol.coprime_factor()), 1);
 }
+
+TEST(UnivariatePolynomial, Sparse)
+{
+	Variable x = fresh_real_variable("x");
+	using UP = UnivariatePolynomial<Rational>;
+	UP p(x, std::map<carl::uint, Rational>({{0, Rational(-2)}, {1000, Rational(1)}}));
+	EXPECT_TRUE(p.is_sparse());
+	EXPECT_EQ(1000u, p.degree());
+	EXPECT_EQ(Rational(1), p.lcoeff());
+	EXPECT_EQ(Rational(-2), p.tcoeff());
+	EXPECT_FALSE(carl::is_zero(p));
+	EXPECT_FALSE(carl::is_constant(p));
+	EXPECT_EQ(p, UP(x, Rational(1), 1000) - Rational(2));
+	EXPECT_FALSE(UP(x, {Rational(1), Rational(2)}).is_sparse());
+
+	// Forcing dense storage does not change the polynomial.
+	UP dense = p;
+	EXPECT_EQ(1001u, dense.coefficients().size());
+	EXPECT_FALSE(dense.is_sparse());
+	EXPECT_EQ(p, dense);
+	EXPECT_TRUE(UP(x, dense.coefficients()).is_sparse());
+
+	EXPECT_EQ(Rational(-1), carl::evaluate(p, Rational(1)));
+	EXPECT_EQ(carl::pow(Rational(2), 1000) - Rational(2), carl::evaluate(p, Rational(2)));
+	EXPECT_EQ(Rational(-2), carl::evaluate(p, Rational(0)));
+
+	UP d = carl::derivative(p);
+	EXPECT_TRUE(d.is_sparse());
+	EXPECT_EQ(UP(x, Rational(1000), 999), d);
+	EXPECT_EQ(carl::derivative(dense, 2), carl::derivative(p, 2));
+
+	EXPECT_EQ(UP(x, carl::evaluate(p, Rational(3))), carl::substitute(p, x, Rational(3)));
+	std::stringstream ss;
+	ss << p;
+	std::stringstream ssdense;
+	ssdense << dense;
+	EXPECT_EQ(ssdense.str(), ss.str());
+}
+
+TEST(UnivariatePolynomial, SparseMultivariateCoefficients)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	using MP = MultivariatePolynomial<Rational>;
+	MP mp = MP(y) * carl::pow(MP(x), 200) + MP(y) * y * carl::pow(MP(x), 100) - Rational(3);
+	UnivariatePolynomial<MP> p = carl::to_univariate_polynomial(mp, x);
+	EXPECT_TRUE(p.is_sparse());
+	EXPECT_EQ(200u, p.degree());
+	EXPECT_EQ(MP(y), p.lcoeff());
+	EXPECT_EQ(mp, MP(p));
+
+	auto s = carl::substitute(p, y, MP(Rational(2)));
+	EXPECT_TRUE(s.is_sparse());
+	EXPECT_EQ(carl::substitute(mp, y, MP(Rational(2))), MP(s));
+	EXPECT_EQ(MP(carl::derivative(p, y)), carl::derivative(mp, y));
+
+	using UP = UnivariatePolynomial<MP>;
+	UP q = carl::to_univariate_polynomial(MP(y) * carl::pow(MP(x), 40) + Rational(2) * carl::pow(MP(x), 3) + Rational(1), x);
+	EXPECT_TRUE(q.is_sparse());
+	UP pdense = p;
+	pdense.coefficients();
+	UP qdense = q;
+	qdense.coefficients();
+	EXPECT_EQ(carl::pseudo_remainder(pdense, qdense), carl::pseudo_remainder(p, q));
+	UP r(x, {MP(Rational(1)), MP(y), MP(Rational(5))});
+	EXPECT_EQ(carl::pseudo_remainder(pdense, r), carl::pseudo_remainder(p, r));
+	EXPECT_TRUE(carl::is_zero(carl::pseudo_remainder(p * q, q)));
+
+	carl::substitute_inplace(p, y, MP(Rational(0)));
+	EXPECT_EQ(MP(Rational(-3)), MP(p));
+}
+
+TEST(UnivariatePolynomial, SparseZero)
+{
+	Variable x = fresh_real_variable("x");
+	using UP = UnivariatePolynomial<Rational>;
+	UP p(x, Rational(1), 40);
+	EXPECT_TRUE(p.is_sparse());
+	p.truncate();
+	EXPECT_FALSE(p.is_sparse());
+	EXPECT_TRUE(carl::is_zero(p));
+	EXPECT_EQ(UP(x), p);
+
+	UP q(x, std::vector<std::pair<carl::uint, Rational>>({{3, Rational(0)}, {50, Rational(0)}}));
+	EXPECT_FALSE(q.is_sparse());
+	EXPECT_TRUE(carl::is_zero(q));
+
+	Variable y = fresh_real_variable("y");
+	using MP = MultivariatePolynomial<Rational>;
+	auto r = carl::to_univariate_polynomial(MP(y) * carl::pow(MP(x), 200) + MP(y) * y * carl::pow(MP(x), 100), x);
+	EXPECT_TRUE(r.is_sparse());
+	EXPECT_TRUE(carl::is_zero(carl::substitute(r, y, MP(Rational(0)))));
+	carl::substitute_inplace(r, y, MP(Rational(0)));
+	EXPECT_TRUE(carl::is_zero(r));
+}
+
+TEST(UnivariatePolynomial, SparseConstAccess)
+{
+	Variable x = fresh_real_variable("x");
+	using UP = UnivariatePolynomial<Rational>;
+	const UP p(x, std::map<carl::uint, Rational>({{0, Rational(-2)}, {1000, Rational(1)}}));
+	const Rational& lcoeff = p.lcoeff();
+	const auto& sparse = p.sparse_coefficients();
+	// Const accesses to the dense coefficients do not change the storage.
+	EXPECT_EQ(1001u, p.coefficients().size());
+	EXPECT_EQ(Rational(-2), p.coefficients().front());
+	EXPECT_EQ(Rational(1), p.coefficients().back());
+	EXPECT_TRUE(p.is_sparse());
+	EXPECT_EQ(Rational(1), lcoeff);
+	EXPECT_EQ(2u, sparse.size());
+
+	UP dense = p;
+	dense.make_dense();
+	EXPECT_FALSE(dense.is_sparse());
+	EXPECT_EQ(dense, p);
+	EXPECT_EQ(p, dense);
+	UP sum(x, Rational(1));
+	sum += p;
+	UP product(x, Rational(2));
+	product *= p;
+	EXPECT_TRUE(p.is_sparse());
+	EXPECT_EQ(UP(x, Rational(1), 1000) - Rational(1), sum);
+	EXPECT_EQ(UP(x, Rational(2), 1000) - Rational(4), product);
+	EXPECT_TRUE(p.has(x));
+	EXPECT_EQ(Rational(-2), p.numeric_content(0));
+	EXPECT_TRUE(p.is_sparse());
+
+	// Concurrent readers share a single dense copy.
+	const UP q(x, std::map<carl::uint, Rational>({{1, Rational(3)}, {500, Rational(-1)}}));
+	std::vector<const std::vector<Rational>*> copies(4, nullptr);
+	std::vector<std::thread> threads;
+	for (std::size_t i = 0; i < copies.size(); ++i) {
+		threads.emplace_back([&q, &copies, i]() { copies[i] = &q.coefficients(); });
+	}
+	for (auto& t: threads) t.join();
+	for (const auto* c: copies) {
+		EXPECT_EQ(copies.front(), c);
+		EXPECT_EQ(501u, c->size());
+	}
+	EXPECT_TRUE(q.is_sparse());
+
+	// Arithmetic on a sparse polynomial whose dense copy exists uses the current coefficients.
+	const UP r(x, std::map<carl::uint, Rational>({{0, Rational(-2)}, {100, Rational(1)}}));
+	const UP s(x, Rational(1), 100);
+	EXPECT_TRUE(r.is_sparse());
+	EXPECT_EQ(UP(x, Rational(2)), s - r);
+	EXPECT_EQ(101u, r.coefficients().size());
+	EXPECT_EQ(UP(x, Rational(2)), s - r);
+	UP negated = -r;
+	EXPECT_TRUE(negated.is_sparse());
+	EXPECT_EQ(Rational(2), std::as_const(negated).coefficients().front());
+	EXPECT_EQ(Rational(-1), std::as_const(negated).coefficients().back());
+}
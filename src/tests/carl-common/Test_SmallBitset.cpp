@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <carl-common/datastructures/Bitset.h>
+#include <carl-common/datastructures/SmallBitset.h>
+
+#include <random>
+#include <sstream>
+#include <vector>
+
+using SBitset = carl::SmallBitset<128>;
+
+template<typename B>
+std::vector<std::size_t> bits(const B& b) {
+	std::vector<std::size_t> res;
+	for (auto i: b) res.push_back(i);
+	return res;
+}
+
+TEST(SmallBitset, Basic) {
+	SBitset b({1, 5, 64, 127});
+	EXPECT_EQ(b.size(), 128);
+	EXPECT_EQ(b.count(), 4);
+	EXPECT_TRUE(b.test(64));
+	EXPECT_FALSE(b.test(63));
+	EXPECT_FALSE(b.test(1000));
+	EXPECT_EQ(bits(b), std::vector<std::size_t>({1, 5, 64, 127}));
+	EXPECT_EQ(b.find_next(5), 64);
+	EXPECT_EQ(b.find_next(127), SBitset::npos);
+
+	// Grow beyond the inline storage and shrink again.
+	b.set(300);
+	EXPECT_EQ(b.num_blocks(), 5);
+	EXPECT_EQ(bits(b), std::vector<std::size_t>({1, 5, 64, 127, 300}));
+	b.resize(70);
+	EXPECT_EQ(bits(b), std::vector<std::size_t>({1, 5, 64}));
+	b.resize(200);
+	EXPECT_EQ(b.count(), 3);
+
+	b.reset(5);
+	EXPECT_EQ(b, SBitset({1, 64}));
+	EXPECT_TRUE(SBitset({64}).is_subset_of(b));
+	EXPECT_FALSE(SBitset({2}).is_subset_of(b));
+
+	SBitset c(true);
+	EXPECT_TRUE(c.test(17));
+	EXPECT_FALSE((~c).test(17));
+}
+
+TEST(SmallBitset, Negation) {
+	auto b = ~SBitset({0, 2});
+	EXPECT_EQ(b.size(), 3);
+	EXPECT_EQ(bits(b), std::vector<std::size_t>({1}));
+	EXPECT_TRUE(b.test(3));
+}
+
+TEST(SmallBitset, CompareToBitset) {
+	std::mt19937 rng(7);
+	std::uniform_int_distribution<std::size_t> pos(0, 400);
+	std::uniform_int_distribution<int> coin(0, 1);
+	for (int round = 0; round < 50; ++round) {
+		carl::Bitset a, b;
+		SBitset sa, sb;
+		for (int i = 0; i < 20; ++i) {
+			std::size_t p = pos(rng) / (coin(rng) ? 1 : 4);
+			if (coin(rng)) { a.set(p); sa.set(p); }
+			else { b.set(p); sb.set(p); }
+		}
+		EXPECT_EQ(bits(a), bits(sa));
+		EXPECT_EQ(bits(a | b), bits(sa | sb));
+		EXPECT_EQ(bits(a & b), bits(sa & sb));
+		EXPECT_EQ((a | b).count(), (sa | sb).count());
+		EXPECT_EQ(a.is_subset_of(a | b), sa.is_subset_of(sa | sb));
+		EXPECT_EQ(a.is_subset_of(b), sa.is_subset_of(sb));
+		EXPECT_EQ(a == b, sa == sb);
+		EXPECT_EQ(a < b, sa < sb);
+		auto d = a;
+		d -= b;
+		auto sd = sa;
+		sd -= sb;
+		EXPECT_EQ(bits(d), bits(sd));
+		std::stringstream ss1, ss2;
+		ss1 << a;
+		ss2 << sa;
+		EXPECT_EQ(ss1.str(), ss2.str());
+		EXPECT_EQ(std::hash<SBitset>()(sa), std::hash<SBitset>()(SBitset(sa)));
+	}
+}
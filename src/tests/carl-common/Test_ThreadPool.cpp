@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <carl-common/parallel/ThreadPool.h>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+TEST(ThreadPool, Run) {
+	auto& pool = carl::ThreadPool::getInstance();
+	std::vector<std::size_t> res(1000, 0);
+	pool.run(res.size(), 4, [&res](std::size_t i) { res[i] = i * i; });
+	for (std::size_t i = 0; i < res.size(); ++i) {
+		EXPECT_EQ(i * i, res[i]);
+	}
+	// The workers are kept for later loops.
+	std::size_t workers = pool.size();
+	EXPECT_GE(workers, 3u);
+	std::atomic<std::size_t> sum(0);
+	pool.run(100, 4, [&sum](std::size_t i) { sum += i; });
+	EXPECT_EQ(4950u, sum.load());
+	EXPECT_EQ(workers, pool.size());
+
+	// A single thread runs the loop in the calling thread.
+	std::vector<std::size_t> order;
+	pool.run(5, 1, [&order](std::size_t i) { order.push_back(i); });
+	EXPECT_EQ(std::vector<std::size_t>({0, 1, 2, 3, 4}), order);
+	pool.run(0, 4, [](std::size_t) { FAIL(); });
+}
+
+TEST(ThreadPool, Nested) {
+	auto& pool = carl::ThreadPool::getInstance();
+	std::vector<std::size_t> res(8, 0);
+	pool.run(res.size(), 4, [&pool, &res](std::size_t i) {
+		std::atomic<std::size_t> sum(0);
+		pool.run(10, 4, [&sum, i](std::size_t j) { sum += i * j; });
+		res[i] = sum;
+	});
+	for (std::size_t i = 0; i < res.size(); ++i) {
+		EXPECT_EQ(45 * i, res[i]);
+	}
+}
+
+TEST(ThreadPool, Exception) {
+	auto& pool = carl::ThreadPool::getInstance();
+	std::atomic<std::size_t> count(0);
+	EXPECT_THROW(pool.run(100, 4, [&count](std::size_t i) {
+		++count;
+		if (i == 10) throw std::runtime_error("task failed");
+	}), std::runtime_error);
+	EXPECT_LE(count.load(), 100u);
+	// The pool is still usable afterwards.
+	std::atomic<std::size_t> sum(0);
+	pool.run(100, 4, [&sum](std::size_t i) { sum += i; });
+	EXPECT_EQ(4950u, sum.load());
+	EXPECT_THROW(pool.run(3, 1, [](std::size_t) { throw std::logic_error("sequential"); }), std::logic_error);
+}
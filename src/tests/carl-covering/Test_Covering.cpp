@@ -51,3 +51,34 @@ TEST(Covering, TypedSetCover) {
 	EXPECT_EQ(sc.largest_set(), 0);
 	EXPECT_EQ(sc.get_uncovered(), carl::Bitset({0, 1, 2, 3}));
 }
+
+TEST(Covering, SetCoverIncremental) {
+	using namespace carl::covering;
+
+	SetCover sc;
+	sc.set(0, carl::Bitset({0, 1}));
+	sc.set(1, carl::Bitset({1, 2, 3}));
+	sc.set(2, carl::Bitset({3, 4}));
+	sc.set(3, carl::Bitset({0, 4}));
+	sc.set(1, 2);
+
+	EXPECT_EQ(sc.active_set_count(), 4);
+	EXPECT_EQ(sc.covering_sets(1), std::vector<std::size_t>({0, 1}));
+	EXPECT_EQ(sc.covering_sets(4), std::vector<std::size_t>({2, 3}));
+	EXPECT_EQ(sc.largest_set(), 1);
+
+	sc.select_set(1);
+
+	EXPECT_EQ(sc.get_set(0), carl::Bitset({0}));
+	EXPECT_EQ(sc.get_set(2), carl::Bitset({4}));
+	EXPECT_TRUE(sc.covering_sets(3).empty());
+	EXPECT_EQ(sc.active_set_count(), 3);
+	// Ties are broken by the smallest id.
+	EXPECT_EQ(sc.largest_set(), 3);
+
+	sc.select_set(3);
+
+	EXPECT_EQ(sc.active_set_count(), 0);
+	EXPECT_EQ(sc.largest_set(), 0);
+	EXPECT_EQ(sc.get_uncovered(), carl::Bitset());
+}
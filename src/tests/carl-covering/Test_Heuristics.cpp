@@ -3,6 +3,8 @@
 #include <carl-common/datastructures/Bitset.h>
 #include <carl-covering/carl-covering.h>
 
+#include <cstdlib>
+
 using namespace carl::covering;
 
 TypedSetCover<int> get_example() {
@@ -67,4 +69,54 @@ TEST(heuristics, trivial) {
 	TypedSetCover<int> tsc = get_example();
 	auto cover = tsc.get_cover(heuristic::trivial);
 	EXPECT_EQ(cover, std::vector<int>({0,1,2,3,4}));
-}
\ No newline at end of file
+}
+namespace {
+/// Generates a random set cover where every element is covered by some set.
+SetCover get_random(std::size_t sets, std::size_t elements, unsigned seed) {
+	SetCover sc;
+	std::srand(seed);
+	for (std::size_t e = 0; e < elements; ++e) {
+		sc.set(static_cast<std::size_t>(std::rand()) % sets, e);
+		for (std::size_t s = 0; s < sets; ++s) {
+			if (std::rand() % 5 == 0) sc.set(s, e);
+		}
+	}
+	return sc;
+}
+bool is_cover(const SetCover& sc, const carl::Bitset& cover) {
+	carl::Bitset covered;
+	for (auto s: cover) covered |= sc.get_set(s);
+	return sc.get_uncovered().is_subset_of(covered);
+}
+}
+
+TEST(heuristics, exact_random) {
+	for (unsigned seed = 0; seed < 20; ++seed) {
+		SetCover sc = get_random(10, 16, seed);
+		// Brute force over all subsets.
+		std::size_t minimum = sc.set_count();
+		for (std::size_t mask = 0; mask < (std::size_t(1) << sc.set_count()); ++mask) {
+			carl::Bitset cover;
+			for (std::size_t s = 0; s < sc.set_count(); ++s) {
+				if (mask & (std::size_t(1) << s)) cover.set(s);
+			}
+			if (is_cover(sc, cover)) minimum = std::min(minimum, cover.count());
+		}
+		SetCover copy = sc;
+		auto cover = heuristic::exact(copy);
+		EXPECT_EQ(minimum, cover.count());
+		EXPECT_TRUE(copy.get_uncovered().none());
+	}
+}
+
+TEST(heuristics, exact_bounded) {
+	SetCover sc = get_random(60, 120, 42);
+	SetCover greedy = sc;
+	auto greedy_cover = heuristic::greedy(greedy);
+	for (std::size_t nodes: {std::size_t(0), std::size_t(100), std::size_t(100000)}) {
+		SetCover copy = sc;
+		auto cover = heuristic::exact_bounded(copy, nodes);
+		EXPECT_TRUE(copy.get_uncovered().none());
+		EXPECT_LE(cover.count(), greedy_cover.count());
+	}
+}
@@ -389,6 +389,29 @@ TEST(Formula, gatherVariables)
 	}
 }
 
+TEST(Formula, VariableSignature)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	Variable b = fresh_boolean_variable("b");
+	FormulaT fx(Pol(x), Relation::LESS);
+	FormulaT fyz(Pol(y)*z, Relation::EQ);
+	FormulaT f(FormulaType::AND, FormulaT(FormulaType::OR, fx, FormulaT(b)), fyz);
+	EXPECT_EQ(f.variables(), carlVariables({x,y,z,b}));
+	EXPECT_EQ(f.negated().variables(), carlVariables({x,y,z,b}));
+	EXPECT_TRUE(f.variable_signature().has(b));
+	EXPECT_FALSE(fx.variable_signature().has(y));
+	EXPECT_TRUE(fx.variable_signature().is_subset_of(f.variable_signature()));
+	EXPECT_FALSE(fx.variable_signature().intersects(fyz.variable_signature()));
+	EXPECT_TRUE(fyz.variable_signature().intersects(f.variable_signature()));
+	carlVariables common;
+	fyz.variable_signature().intersection(f.variable_signature(), common);
+	EXPECT_EQ(common, carlVariables({y,z}));
+	EXPECT_EQ(fyz.constraint().variable_signature(), fyz.variable_signature());
+	EXPECT_EQ(boolean_variables(f), carlVariables({b}));
+}
+
 TEST(Formula, Uniqueness)
 {
 	//(X !> (IR ]-594743/343, -1189485/686[, __r^2 + -1031250000/343 R))
@@ -109,3 +109,66 @@ TEST(ModelEvaluation, EvaluateBV)
 	auto res = carl::evaluate(f, m);
 	std::cout << res << std::endl;
 }
+
+TEST(ModelEvaluation, Incremental)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	Variable b = fresh_boolean_variable("b");
+	FormulaT fx(Pol(x) - Rational(1), Relation::GREATER);
+	FormulaT fy(Pol(y), Relation::LESS);
+	FormulaT fz(Pol(z), Relation::EQ);
+	FormulaT f(FormulaType::AND, FormulaT(FormulaType::OR, fx, FormulaT(b)), FormulaT(FormulaType::OR, fy, fz));
+
+	ModelT m;
+	FormulaEvaluationCache<Rational,Pol> cache;
+	m.assign(x, Rational(0));
+	m.assign(y, Rational(-1));
+	auto res = evaluate(f, m, cache);
+	EXPECT_TRUE(res.isSubstitution());
+	EXPECT_EQ(substitute(f, m, cache), substitute(f, m));
+
+	m.assign(b, true);
+	std::size_t misses = cache.misses();
+	res = evaluate(f, m, cache);
+	EXPECT_TRUE(res.isBool() && res.asBool());
+	// Only the subformulas containing b are recomputed.
+	EXPECT_EQ(cache.misses() - misses, 3u);
+
+	m.assign(y, Rational(1));
+	m.emplace(z, createSubstitution<Rational,Pol,ModelPolynomialSubstitution<Rational,Pol>>(Pol(x) + Rational(1)));
+	res = evaluate(f, m, cache);
+	EXPECT_TRUE(res.isBool() && !res.asBool());
+	EXPECT_EQ(res, evaluate(f, m));
+
+	// z depends on x, hence changing x changes the value of fz.
+	m.assign(x, Rational(-1));
+	res = evaluate(f, m, cache);
+	EXPECT_TRUE(res.isBool() && res.asBool());
+	EXPECT_EQ(m.last_changed(z), m.generation());
+}
+
+TEST(ModelEvaluation, IncrementalAssignment)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	FormulaT f(FormulaType::AND, FormulaT(Pol(x), Relation::GREATER), FormulaT(Pol(y), Relation::GREATER));
+
+	ModelT m({{x, Rational(1)}, {y, Rational(1)}});
+	EXPECT_EQ(m.last_changed(x), m.generation());
+	FormulaEvaluationCache<Rational,Pol> cache;
+	auto res = evaluate(f, m, cache);
+	EXPECT_TRUE(res.isBool() && res.asBool());
+
+	// An assigned model with the same generation must not reuse the cached results.
+	ModelT other({{x, Rational(1)}, {y, Rational(-1)}});
+	EXPECT_EQ(m.generation(), other.generation());
+	m = other;
+	res = evaluate(f, m, cache);
+	EXPECT_TRUE(res.isBool() && !res.asBool());
+
+	m = ModelT({{x, Rational(1)}, {y, Rational(1)}});
+	res = evaluate(f, m, cache);
+	EXPECT_TRUE(res.isBool() && res.asBool());
+}
@@ -0,0 +1,122 @@
+#include "gtest/gtest.h"
+
+#include "../Common.h"
+
+#include <carl-io/DIMACSImporter.h>
+#include <carl-io/DIMACSReader.h>
+#include <carl-io/OPBImporter.h>
+#include <carl-io/OPBReader.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+
+#include <unistd.h>
+
+using namespace carl;
+using Poly = carl::MultivariatePolynomial<mpq_class>;
+
+namespace {
+/// Writes the given content to a temporary file that is removed on destruction.
+struct TemporaryFile {
+	std::string name;
+	explicit TemporaryFile(const std::string& content) {
+		// mkstemp creates a unique file, also if several test processes run in parallel.
+		name = (std::filesystem::temp_directory_path() / "carl-io-test-XXXXXX").string();
+		int fd = ::mkstemp(name.data());
+		if (fd != -1) ::close(fd);
+		std::ofstream(name) << content;
+	}
+	~TemporaryFile() {
+		std::remove(name.c_str());
+	}
+};
+}
+
+TEST(MappedReaders, MappedScanner) {
+	std::string input = "  -42 +7 x_1 9999999999\nrest\r\n";
+	io::MappedScanner s(input.data(), input.data() + input.size());
+	int i = 0;
+	s.skip_space();
+	EXPECT_TRUE(s.read_integer(i));
+	EXPECT_EQ(i, -42);
+	s.skip_blank();
+	EXPECT_TRUE(s.read_integer(i));
+	EXPECT_EQ(i, 7);
+	s.skip_blank();
+	EXPECT_FALSE(s.read_integer(i));
+	EXPECT_EQ(s.read_identifier(), "x_1");
+	s.skip_blank();
+	EXPECT_FALSE(s.read_integer(i));
+	long long l = 0;
+	EXPECT_TRUE(s.read_integer(l));
+	EXPECT_EQ(l, 9999999999);
+	s.skip_space();
+	EXPECT_EQ(s.line(), 2);
+	EXPECT_EQ(s.read_line(), "rest");
+	EXPECT_TRUE(s.at_end());
+}
+
+TEST(MappedReaders, DIMACSReader) {
+	TemporaryFile file("c comment\np cnf 3 3\n1 -2 0\n2 3\n -1 0\n3 0\nreset\np cnf 4 1\n4 0\n");
+	io::DIMACSReader reader(file.name);
+	ASSERT_TRUE(reader.is_open());
+	std::vector<long long> lits;
+	EXPECT_TRUE(reader.next_clause(lits));
+	EXPECT_EQ(reader.variables(), 3);
+	EXPECT_EQ(lits, std::vector<long long>({1, -2}));
+	EXPECT_TRUE(reader.next_clause(lits));
+	EXPECT_EQ(lits, std::vector<long long>({2, 3, -1}));
+	EXPECT_TRUE(reader.next_clause(lits));
+	EXPECT_FALSE(reader.next_clause(lits));
+	EXPECT_FALSE(reader.at_end());
+	EXPECT_TRUE(reader.next_clause(lits));
+	EXPECT_EQ(reader.variables(), 4);
+	EXPECT_EQ(lits, std::vector<long long>({4}));
+	EXPECT_FALSE(reader.next_clause(lits));
+	EXPECT_TRUE(reader.at_end());
+	EXPECT_FALSE(reader.failed());
+}
+
+TEST(MappedReaders, DIMACSImporter) {
+	TemporaryFile file("p cnf 2 2\n1 2 0\n-1 0\nreset\np cnf 2 1\n-2 0\n");
+	io::DIMACSImporter<Poly> importer(file.name);
+	ASSERT_TRUE(importer.hasNext());
+	auto f = importer.next();
+	EXPECT_EQ(f.type(), FormulaType::AND);
+	EXPECT_EQ(f.size(), 2);
+	ASSERT_TRUE(importer.hasNext());
+	f = importer.next();
+	EXPECT_EQ(f.type(), FormulaType::NOT);
+	EXPECT_FALSE(importer.hasNext());
+}
+
+TEST(MappedReaders, OPB) {
+	std::string content = "* comment\nmin: +1 x1 -2 x2 ;\n+3 x1 +1 x3 >= 2 ;\n* another comment\n-1 x2\n  +1 x3 = -1;\n";
+	TemporaryFile file(content);
+	auto mapped = io::parseOPBFile(file.name);
+	ASSERT_TRUE(mapped);
+	std::ifstream in(file.name);
+	auto spirit = io::parseOPBFile(in);
+	ASSERT_TRUE(spirit);
+	ASSERT_EQ(mapped->objective.size(), 2);
+	ASSERT_EQ(mapped->constraints.size(), 2);
+	ASSERT_EQ(mapped->constraints.size(), spirit->constraints.size());
+	for (std::size_t i = 0; i < mapped->constraints.size(); ++i) {
+		const auto& m = mapped->constraints[i];
+		const auto& s = spirit->constraints[i];
+		EXPECT_EQ(std::get<1>(m), std::get<1>(s));
+		EXPECT_EQ(std::get<2>(m), std::get<2>(s));
+		ASSERT_EQ(std::get<0>(m).size(), std::get<0>(s).size());
+		for (std::size_t j = 0; j < std::get<0>(m).size(); ++j) {
+			EXPECT_EQ(std::get<0>(m)[j].first, std::get<0>(s)[j].first);
+			EXPECT_EQ(std::get<0>(m)[j].second.name(), std::get<0>(s)[j].second.name());
+		}
+	}
+	// The same name refers to the same variable.
+	EXPECT_EQ(std::get<0>(mapped->constraints[0])[1].second, std::get<0>(mapped->constraints[1])[1].second);
+
+	TemporaryFile broken("+1 x1 >= ;\n");
+	EXPECT_FALSE(io::parseOPBFile(broken.name));
+}
@@ -0,0 +1,179 @@
+#include "gtest/gtest.h"
+
+#include "../Common.h"
+
+#include <carl-io/SMTLIBReader.h>
+
+#include <sstream>
+
+using namespace carl;
+using Poly = carl::MultivariatePolynomial<mpq_class>;
+using Reader = io::SMTLIBReader<Poly>;
+
+TEST(SMTLIBReader, Commands) {
+	std::istringstream in(R"(
+		; a comment
+		(set-logic QF_NRA)
+		(set-info :source |multi
+		line|)
+		(declare-fun x () Real)
+		(declare-const b Bool)
+		(define-fun sq ((y Real)) Real (* y y))
+		(assert (or b (> (sq x) 2.5)))
+		(push 1)
+		(declare-fun z () Int)
+		(assert (let ((s (+ x z)) (t (- x))) (and (<= s t 1) (= s 0))))
+		(check-sat)
+		(pop 1)
+		(check-sat)
+		(exit)
+		(assert false)
+	)");
+	Reader reader(in);
+	std::vector<Reader::CommandType> types;
+	std::vector<Formula<Poly>> asserted;
+	while (auto cmd = reader.next()) {
+		types.push_back(cmd->type);
+		if (cmd->type == Reader::CommandType::Assert) asserted.push_back(cmd->formula);
+		if (cmd->type == Reader::CommandType::CheckSat && reader.level() == 1) {
+			ASSERT_EQ(asserted.size(), 2);
+			EXPECT_EQ(reader.formula(), Formula<Poly>(AND, asserted[0], asserted[1]));
+		}
+	}
+	EXPECT_FALSE(reader.failed());
+	using T = Reader::CommandType;
+	EXPECT_EQ(types, std::vector<T>({ T::Other, T::Other, T::Other, T::Other, T::Other, T::Assert, T::Push, T::Other, T::Assert, T::CheckSat, T::Pop, T::CheckSat, T::Exit }));
+	ASSERT_EQ(asserted.size(), 2);
+	EXPECT_EQ(reader.level(), 0);
+	EXPECT_EQ(reader.formula(), asserted[0]);
+
+	Variable x = asserted[0].variables().size() > 0 ? *std::find_if(asserted[0].variables().begin(), asserted[0].variables().end(), [](auto v){ return v.type() == VariableType::VT_REAL; }) : Variable::NO_VARIABLE;
+	ASSERT_NE(x, Variable::NO_VARIABLE);
+	Formula<Poly> b(*std::find_if(asserted[0].variables().begin(), asserted[0].variables().end(), [](auto v){ return v.type() == VariableType::VT_BOOL; }));
+	Formula<Poly> expected(OR, b, Formula<Poly>(Poly(x)*x - Poly(Rational(5)/2), Relation::GREATER));
+	EXPECT_EQ(asserted[0], expected);
+	EXPECT_EQ(asserted[1].type(), FormulaType::AND);
+}
+
+TEST(SMTLIBReader, SharedLet) {
+	// Every binding refers to the previous one twice, hence expanding the lets would double the term in every level.
+	std::stringstream ss;
+	ss << "(declare-fun x () Real)\n(assert ";
+	std::size_t depth = 2000;
+	for (std::size_t i = 0; i < depth; ++i) {
+		std::string prev = (i == 0 ? "x" : "a" + std::to_string(i-1));
+		ss << "(let ((a" << i << " (+ " << prev << " " << prev << "))) ";
+	}
+	ss << "(> a" << depth - 1 << " 1)";
+	for (std::size_t i = 0; i < depth; ++i) ss << ")";
+	ss << ")\n";
+	Reader reader(ss);
+	ASSERT_TRUE(reader.next());
+	auto cmd = reader.next();
+	ASSERT_TRUE(cmd);
+	EXPECT_FALSE(reader.failed());
+	EXPECT_EQ(cmd->formula.type(), FormulaType::CONSTRAINT);
+}
+
+TEST(SMTLIBReader, ArithmeticIte) {
+	std::istringstream in("(declare-fun x () Real)(declare-fun p () Bool)(assert (> (ite p x 1) 0))");
+	Reader reader(in);
+	auto cmd = reader.next();
+	cmd = reader.next();
+	cmd = reader.next();
+	ASSERT_TRUE(cmd);
+	EXPECT_EQ(cmd->formula.type(), FormulaType::AND);
+	EXPECT_EQ(cmd->formula.size(), 2);
+}
+
+TEST(SMTLIBReader, IntegerIte) {
+	// The fresh variable for an ite is an integer if both branches are, and real otherwise.
+	for (const auto& [branch, type]: std::vector<std::pair<std::string, VariableType>>{
+		{ "2", VariableType::VT_INT }, { "(/ 1 2)", VariableType::VT_REAL }
+	}) {
+		std::istringstream in("(declare-fun x () Int)(declare-fun p () Bool)(assert (> (ite p x " + branch + ") 0))");
+		Reader reader(in);
+		auto cmd = reader.next();
+		cmd = reader.next();
+		cmd = reader.next();
+		ASSERT_TRUE(cmd);
+		carlVariables vars;
+		carl::variables(cmd->formula, vars);
+		std::size_t fresh = 0;
+		for (const auto& v: vars) {
+			if (v.type() == VariableType::VT_BOOL || v.name() == "x") continue;
+			EXPECT_EQ(type, v.type());
+			++fresh;
+		}
+		EXPECT_EQ(1u, fresh);
+	}
+}
+
+TEST(SMTLIBReader, FunctionScope) {
+	// The body of f refers to the global y, not to the y bound at the call site.
+	std::istringstream in(R"(
+		(declare-fun y () Real)
+		(define-fun f ((a Real)) Real (+ a y))
+		(assert (let ((y 3)) (> (f 1) 0)))
+		(assert (let ((a 2)) (> (+ 1 y) 0)))
+	)");
+	Reader reader(in);
+	std::vector<Formula<Poly>> asserted;
+	while (auto cmd = reader.next()) {
+		if (cmd->type == Reader::CommandType::Assert) asserted.push_back(cmd->formula);
+	}
+	EXPECT_FALSE(reader.failed());
+	ASSERT_EQ(asserted.size(), 2);
+	EXPECT_EQ(asserted[0], asserted[1]);
+	EXPECT_EQ(asserted[0].variables().size(), 1);
+}
+
+TEST(SMTLIBReader, IteDefinitionScope) {
+	auto has_ite = [](const Formula<Poly>& f) {
+		bool res = false;
+		carl::visit(f, [&res](const Formula<Poly>& g) { if (g.type() == FormulaType::ITE) res = true; });
+		return res;
+	};
+	{
+		// The definition is kept without any later assertion.
+		std::istringstream in("(declare-fun x () Real)(declare-fun p () Bool)(define-fun t () Real (ite p x 1))");
+		Reader reader(in);
+		while (reader.next());
+		EXPECT_FALSE(reader.failed());
+		EXPECT_TRUE(has_ite(reader.formula()));
+	}
+	{
+		// The definition is kept if the next assertion is popped.
+		std::istringstream in("(declare-fun x () Real)(declare-fun p () Bool)(define-fun t () Real (ite p x 1))(push 1)(assert (> t 0))(pop 1)(assert (< t 5))");
+		Reader reader(in);
+		std::vector<Reader::CommandType> types;
+		while (auto cmd = reader.next()) types.push_back(cmd->type);
+		EXPECT_FALSE(reader.failed());
+		using T = Reader::CommandType;
+		EXPECT_EQ(types, std::vector<T>({ T::Other, T::Other, T::Assert, T::Push, T::Assert, T::Pop, T::Assert }));
+		EXPECT_EQ(reader.level(), 0);
+		EXPECT_TRUE(has_ite(reader.formula()));
+	}
+}
+
+TEST(SMTLIBReader, Errors) {
+	{
+		std::istringstream in("(assert (> y 0))");
+		Reader reader(in);
+		EXPECT_FALSE(reader.next());
+		EXPECT_TRUE(reader.failed());
+	}
+	{
+		std::istringstream in("(declare-fun x () Real)(assert (+ x 1))");
+		Reader reader(in);
+		EXPECT_TRUE(reader.next());
+		EXPECT_FALSE(reader.next());
+		EXPECT_TRUE(reader.failed());
+	}
+	{
+		std::istringstream in("(pop 1)");
+		Reader reader(in);
+		EXPECT_FALSE(reader.next());
+		EXPECT_TRUE(reader.failed());
+	}
+}
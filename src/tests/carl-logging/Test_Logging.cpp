@@ -6,6 +6,7 @@
 
 #include "../get_output.h"
 
+#include <algorithm>
 #include <sstream>
 
 TEST(Logging, LogLevelOutput)
@@ -54,3 +55,73 @@ TEST(LoggingHelper, basename)
 {
 	EXPECT_EQ("abc.de", carl::basename("/foo/bar/abc.de"));
 }
+
+namespace {
+void log_messages() {
+	__CARL_LOG_DEBUG("carl.test.cache", "debug");
+	__CARL_LOG_INFO("carl.test.cache", "info");
+	__CARL_LOG_WARN("carl.test.cache.sub", "warn");
+}
+std::size_t count_lines(const std::string& s) {
+	return static_cast<std::size_t>(std::count(s.begin(), s.end(), '\n'));
+}
+}
+
+TEST(Logging, CallSite)
+{
+	std::stringstream ss;
+	carl::logging::logger().configure("test_callsite", ss);
+	carl::logging::logger().filter("test_callsite")("", carl::logging::LogLevel::LVL_OFF)("carl.test.cache", carl::logging::LogLevel::LVL_INFO);
+	carl::logging::logger().resetFormatter();
+	carl::logging::Filter& filter = carl::logging::logger().filter("test_callsite");
+	EXPECT_EQ(filter.level("carl.test.cache.sub.x"), carl::logging::LogLevel::LVL_INFO);
+	EXPECT_EQ(filter.level("carl.other"), carl::logging::LogLevel::LVL_OFF);
+
+	log_messages();
+	log_messages();
+	EXPECT_EQ(count_lines(ss.str()), 4);
+	EXPECT_EQ(ss.str().find("debug"), std::string::npos);
+
+	// Changing the filter invalidates the cached levels.
+	filter("carl.test.cache", carl::logging::LogLevel::LVL_DEBUG);
+	ss.str("");
+	log_messages();
+	EXPECT_EQ(count_lines(ss.str()), 3);
+	filter("carl.test", carl::logging::LogLevel::LVL_OFF)("carl.test.cache", carl::logging::LogLevel::LVL_OFF);
+	ss.str("");
+	log_messages();
+	EXPECT_EQ(count_lines(ss.str()), 0);
+
+	carl::logging::CallSite site;
+	EXPECT_FALSE(site.visible(carl::logging::LogLevel::LVL_FATAL, "carl.test"));
+	filter("carl.test", carl::logging::LogLevel::LVL_ERROR);
+	EXPECT_TRUE(site.visible(carl::logging::LogLevel::LVL_FATAL, "carl.test"));
+	filter("carl.test", carl::logging::LogLevel::LVL_OFF);
+
+	// A channel that is not a string literal may change its content at the same address.
+	filter("carl.test.on", carl::logging::LogLevel::LVL_ERROR);
+	std::string channel = "carl.test.on";
+	carl::logging::CallSite dynamic;
+	EXPECT_TRUE(dynamic.visible(carl::logging::LogLevel::LVL_FATAL, channel));
+	channel.replace(10, 2, "no");
+	EXPECT_FALSE(dynamic.visible(carl::logging::LogLevel::LVL_FATAL, channel));
+	filter("carl.test.on", carl::logging::LogLevel::LVL_OFF);
+}
+
+TEST(Logging, AsyncSink)
+{
+	std::stringstream ss;
+	{
+		auto sink = std::make_shared<carl::logging::AsyncSink>(std::make_shared<carl::logging::StreamSink>(ss), 16);
+		carl::logging::logger().configure("test_async", sink);
+		carl::logging::logger().filter("test_async")("", carl::logging::LogLevel::LVL_OFF)("carl.test.async", carl::logging::LogLevel::LVL_INFO);
+		carl::logging::logger().resetFormatter();
+		for (int i = 0; i < 1000; ++i) {
+			__CARL_LOG_INFO("carl.test.async", "message " << i);
+		}
+		sink->flush();
+		EXPECT_EQ(count_lines(ss.str()), 1000);
+		EXPECT_NE(ss.str().find("message 999"), std::string::npos);
+		carl::logging::logger().filter("test_async")("carl.test.async", carl::logging::LogLevel::LVL_OFF);
+	}
+}
@@ -1,10 +1,13 @@
 #include "../get_output.h"
 
 #include <carl-statistics/Statistics.h>
+#include <carl-statistics/StatisticsPrinter.h>
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <sstream>
 #include <thread>
+#include <vector>
 
 TEST(Statistics, Timer)
 {
@@ -14,3 +17,74 @@ TEST(Statistics, Timer)
 	timer.finish(start);
 	ASSERT_EQ(timer.count(), 1);
 }
+
+TEST(Statistics, Series)
+{
+	carl::statistics::Series a;
+	carl::statistics::Series b;
+	EXPECT_EQ(a.min(), 0);
+	a.add(5);
+	a.add(3);
+	b.add(10);
+	a.merge(b);
+	EXPECT_EQ(a.count(), 3);
+	EXPECT_EQ(a.sum(), 18);
+	EXPECT_EQ(a.min(), 3);
+	EXPECT_EQ(a.max(), 10);
+}
+
+namespace {
+	class ThreadStatistics: public carl::statistics::Statistics {
+	public:
+		carl::statistics::Sharded<carl::statistics::Counter> calls;
+		carl::statistics::Sharded<carl::statistics::Series> sizes;
+		carl::statistics::Sharded<carl::statistics::MultiCounter<std::size_t>> threads;
+		std::string mode = "parallel";
+		void collect() override {
+			Statistics::addKeyValuePair("calls", calls);
+			Statistics::addKeyValuePair("sizes", sizes);
+			Statistics::addKeyValuePair("threads", threads);
+			Statistics::addKeyValuePair("mode", mode);
+			Statistics::addKeyValuePair("ratio", 0.5);
+		}
+	};
+}
+
+TEST(Statistics, ShardedFromThreads)
+{
+	auto& stats = carl::statistics::get<ThreadStatistics>("threaded");
+	std::vector<std::thread> threads;
+	for (std::size_t t = 0; t < 8; ++t) {
+		threads.emplace_back([&stats, t]() {
+			for (std::size_t i = 0; i < 10000; ++i) {
+				stats.calls.local().inc();
+				stats.sizes.local().add(t * 10000 + i);
+				stats.threads.local().inc(t, 1);
+			}
+		});
+	}
+	for (auto& t: threads) t.join();
+	stats.collect();
+
+	const auto& data = stats.collected();
+	EXPECT_EQ(std::get<std::size_t>(data.at("calls")), 80000);
+	EXPECT_EQ(std::get<std::size_t>(data.at("sizes.count")), 80000);
+	EXPECT_EQ(std::get<std::size_t>(data.at("sizes.min")), 0);
+	EXPECT_EQ(std::get<std::size_t>(data.at("sizes.max")), 79999);
+	EXPECT_EQ(std::get<std::size_t>(data.at("threads.total")), 80000);
+	EXPECT_EQ(std::get<std::string>(data.at("mode")), "parallel");
+	EXPECT_EQ(std::get<double>(data.at("ratio")), 0.5);
+
+	std::stringstream json;
+	json << carl::statistics::statistics_as_json();
+	EXPECT_NE(json.str().find("\"threaded\": {"), std::string::npos);
+	EXPECT_NE(json.str().find("\"calls\": 80000"), std::string::npos);
+	EXPECT_NE(json.str().find("\"mode\": \"parallel\""), std::string::npos);
+
+	std::stringstream csv;
+	csv << carl::statistics::statistics_as_csv();
+	EXPECT_EQ(csv.str().rfind("module,key,type,value\n", 0), 0);
+	EXPECT_NE(csv.str().find("threaded,calls,unsigned,80000\n"), std::string::npos);
+	EXPECT_NE(csv.str().find("threaded,ratio,double,0.5\n"), std::string::npos);
+	EXPECT_NE(csv.str().find("threaded,mode,string,parallel\n"), std::string::npos);
+}
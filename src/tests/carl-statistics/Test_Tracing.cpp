@@ -0,0 +1,71 @@
+#include <carl-statistics/Tracing.h>
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
+using namespace carl::statistics::tracing;
+
+namespace {
+	std::size_t count(const std::string& haystack, const std::string& needle) {
+		std::size_t res = 0;
+		for (auto pos = haystack.find(needle); pos != std::string::npos; pos = haystack.find(needle, pos + 1)) ++res;
+		return res;
+	}
+}
+
+TEST(Tracing, Spans)
+{
+	auto& tracer = Tracer::getInstance();
+	tracer.clear();
+	{
+		Span outer("test", "outer");
+		for (int i = 0; i < 3; ++i) {
+			Span inner("test", "inner");
+		}
+	}
+	EXPECT_EQ(tracer.size(), 4);
+	const auto& buffer = tracer.local();
+	ASSERT_EQ(buffer.size(), 4);
+	// Spans are recorded when they end, hence the outer span comes last and encloses the others.
+	const auto& outer = buffer[3];
+	EXPECT_EQ(std::string(outer.name), "outer");
+	for (std::size_t i = 0; i < 3; ++i) {
+		EXPECT_EQ(std::string(buffer[i].name), "inner");
+		EXPECT_LE(outer.begin, buffer[i].begin);
+		EXPECT_LE(buffer[i].begin, buffer[i].end);
+		EXPECT_LE(buffer[i].end, outer.end);
+	}
+
+	tracer.set_enabled(false);
+	{
+		Span ignored("test", "ignored");
+	}
+	tracer.set_enabled(true);
+	EXPECT_EQ(tracer.size(), 4);
+}
+
+TEST(Tracing, ChromeTrace)
+{
+	auto& tracer = Tracer::getInstance();
+	tracer.clear();
+	std::thread t([]() {
+		for (int i = 0; i < 10; ++i) {
+			Span span("test", "worker");
+		}
+	});
+	{
+		Span span("test", "main \"quoted\"");
+	}
+	t.join();
+	EXPECT_EQ(tracer.size(), 11);
+
+	std::stringstream ss;
+	tracer.write_chrome_trace(ss);
+	std::string trace = ss.str();
+	EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0);
+	EXPECT_EQ(count(trace, "\"ph\":\"X\""), 11);
+	EXPECT_EQ(count(trace, "\"name\":\"worker\""), 10);
+	EXPECT_EQ(count(trace, "\"name\":\"main \\\"quoted\\\"\""), 1);
+	EXPECT_NE(trace.find("\"dropped\":0"), std::string::npos);
+}
@@ -0,0 +1,120 @@
+#include "gtest/gtest.h"
+
+#include <carl-vs/substitute.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+TEST(SqrtExPowers, Powers)
+{
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	Poly q = -Poly(z) + Rational(1);
+	Poly r = Poly(y) - Rational(2);
+	Poly s = Rational(2)*Poly(y);
+	Poly t = Poly(z)*z + Rational(4)*y;
+	SqrtExPowers<Poly> powers(SqrtEx<Poly>(q, r, s, t));
+	// Request the degrees out of order, such that the cache grows several times.
+	for (carl::uint degree: {3, 1, 6, 2, 7}) {
+		powers.reserve(degree);
+		for (carl::uint k = 1; k <= degree; ++k) {
+			// (q + r*sqrt(t))^k = sum_j binom(k,j) * q^(k-j) * r^j * sqrt(t)^j
+			Poly constant_part;
+			Poly factor;
+			Rational binomial(1);
+			for (carl::uint j = 0; j <= k; ++j) {
+				Poly summand = binomial * carl::pow(q, k - j) * carl::pow(r, j) * carl::pow(t, j / 2);
+				if (j % 2 == 0) constant_part += summand;
+				else factor += summand;
+				binomial = binomial * Rational(k - j) / Rational(j + 1);
+			}
+			EXPECT_EQ(constant_part, powers.constant_part(k));
+			EXPECT_EQ(factor, powers.factor(k));
+			EXPECT_EQ(carl::pow(s, k), powers.denominator(k));
+		}
+		EXPECT_EQ(Poly(Rational(1)), powers.denominator(0));
+	}
+}
+
+TEST(SqrtExPowers, Substitute)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	Poly px(x);
+	std::vector<Poly> polys = {
+		px*px*y + px*z - Rational(1),
+		px*px*px*px*y - px*px*z + px*y*z - Rational(2),
+		Poly(y)*z + Rational(3),
+		px - Poly(z),
+		px*px*px*z + px*px*y*y - Poly(y)*z,
+	};
+	SqrtEx<Poly> sqrt_ex(-Poly(z), Poly(Rational(1)), Rational(2)*Poly(y), Poly(z)*z + Rational(4)*y);
+	SqrtExPowers<Poly> powers(sqrt_ex);
+	for (int run = 0; run < 2; ++run) {
+		for (const auto& p: polys) {
+			// Substituting with the shared powers yields the same as substituting with fresh ones.
+			SqrtExPowers<Poly> fresh(sqrt_ex);
+			EXPECT_EQ(substitute(p, x, fresh), substitute(p, x, powers));
+		}
+	}
+}
+
+class SplitProductsCache: public ::testing::Test {
+protected:
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	std::vector<vs::ConstraintConjunction<Poly>> conjunctions;
+
+	void SetUp() override {
+		Poly px(x);
+		Poly py(y);
+		Constraint<Poly> eq((px - Rational(1)) * (py + Rational(2)), Relation::EQ);
+		Constraint<Poly> neq(px * (px + py), Relation::NEQ);
+		Constraint<Poly> less((px + Rational(3)) * (py - px), Relation::LESS);
+		Constraint<Poly> geq(px*px - py, Relation::GEQ);
+		conjunctions = {
+			{ eq },
+			{ eq, neq },
+			{ neq, less },
+			{ less, geq, eq },
+			{ geq },
+		};
+	}
+
+	/// Splits all conjunctions without using the cache.
+	vs::CaseDistinction<Poly> uncached(bool onlyNeq) const {
+		vs::CaseDistinction<Poly> result;
+		for (const auto& conj: conjunctions) {
+			std::map<const Constraint<Poly>, vs::CaseDistinction<Poly>> empty;
+			vs::CaseDistinction<Poly> temp;
+			vs::detail::splitProducts(conj, temp, empty, onlyNeq);
+			result.insert(result.end(), temp.begin(), temp.end());
+		}
+		return result;
+	}
+};
+
+TEST_F(SplitProductsCache, SameAsUncached)
+{
+	for (bool onlyNeq: {false, true}) {
+		auto expected = uncached(onlyNeq);
+		// The second run takes all constraints from the cache.
+		for (int run = 0; run < 2; ++run) {
+			vs::CaseDistinction<Poly> cases = conjunctions;
+			EXPECT_TRUE(vs::detail::splitProducts(cases, onlyNeq));
+			EXPECT_EQ(expected, cases);
+		}
+		const auto& cache = vs::detail::SplitProductsCache<Poly>::get(onlyNeq);
+		for (const auto& conj: conjunctions) {
+			for (const auto& c: conj) {
+				auto it = cache.find(c);
+				ASSERT_TRUE(it != cache.end());
+				EXPECT_EQ(vs::detail::splitProducts(c, onlyNeq), it->second);
+			}
+		}
+	}
+}
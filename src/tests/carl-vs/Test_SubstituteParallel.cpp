@@ -0,0 +1,69 @@
+#include "gtest/gtest.h"
+
+#include <carl-vs/substitute_parallel.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+using VSTerm = vs::Term<Poly>;
+
+class SubstituteParallel: public ::testing::Test {
+protected:
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	vs::ConstraintConjunction<Poly> constraints;
+	std::vector<VSTerm> candidates;
+
+	void SetUp() override {
+		Poly px(x);
+		constraints.emplace_back(px*px*px*px*y - px*px*z + px*y*z - Rational(2), Relation::LESS);
+		constraints.emplace_back(px*px*px*z + px*px*y*y - Poly(y)*z, Relation::GEQ);
+		constraints.emplace_back(px*px*px - px*y + Poly(z), Relation::NEQ);
+		constraints.emplace_back(px*px*y + px*z*z - Rational(1), Relation::LEQ);
+		// The roots of y*x^2 + z*x - 1.
+		Poly radicand = Poly(z)*z + Rational(4)*y;
+		candidates.push_back(VSTerm::normal(SqrtEx<Poly>(-Poly(z), Poly(Rational(1)), Rational(2)*Poly(y), radicand)));
+		candidates.push_back(VSTerm::normal(SqrtEx<Poly>(-Poly(z), Poly(Rational(-1)), Rational(2)*Poly(y), radicand)));
+		candidates.push_back(VSTerm::plus_eps(SqrtEx<Poly>(-Poly(z), Poly(Rational(1)), Rational(2)*Poly(y), radicand)));
+		candidates.push_back(VSTerm::normal(SqrtEx<Poly>(Poly(y))));
+		candidates.push_back(VSTerm::minus_infty());
+		candidates.push_back(VSTerm::normal(SqrtEx<Poly>(Poly(Rational(1)))));
+	}
+};
+
+TEST_F(SubstituteParallel, SequentialAndThreaded)
+{
+	auto sequential = vs::substitute_candidates(constraints, x, candidates, 1);
+	ASSERT_EQ(candidates.size(), sequential.cases.size());
+	for (std::size_t i = 0; i < candidates.size(); ++i) {
+		if (sequential.satisfiable && i > *sequential.satisfiable) {
+			EXPECT_FALSE(sequential.cases[i]);
+			continue;
+		}
+		// Every candidate yields the same result as substituting it on its own.
+		EXPECT_EQ(vs::substitute(constraints, x, candidates[i]), sequential.cases[i]);
+	}
+	for (std::size_t threads: {2, 3, 8}) {
+		for (std::size_t run = 0; run < 5; ++run) {
+			auto threaded = vs::substitute_candidates(constraints, x, candidates, threads);
+			EXPECT_EQ(sequential.satisfiable, threaded.satisfiable);
+			EXPECT_EQ(sequential.cases, threaded.cases);
+		}
+	}
+}
+
+TEST_F(SubstituteParallel, Satisfiable)
+{
+	// x = 1 satisfies x - 1 <= 0, hence later candidates are dropped.
+	vs::ConstraintConjunction<Poly> trivial = { Constraint<Poly>(Poly(x) - Rational(1), Relation::LEQ) };
+	auto sequential = vs::substitute_candidates(trivial, x, candidates, 1);
+	ASSERT_TRUE(sequential.satisfiable);
+	for (std::size_t threads: {2, 8}) {
+		auto threaded = vs::substitute_candidates(trivial, x, candidates, threads);
+		EXPECT_EQ(sequential.satisfiable, threaded.satisfiable);
+		EXPECT_EQ(sequential.cases, threaded.cases);
+	}
+}
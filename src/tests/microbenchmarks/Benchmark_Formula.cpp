@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include <carl-formula/formula/Formula.h>
+#include <carl-formula/formula/functions/CNF.h>
+
+#include "Generators.h"
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+using FormulaT = carl::Formula<MVP>;
+
+/// Creates a random formula of the given depth over the given atoms.
+static FormulaT random_formula(const RandomGenerator& gen, const std::vector<FormulaT>& atoms, std::size_t depth) {
+	if (depth == 0) {
+		return atoms[gen.uniDist(atoms.size())];
+	}
+	switch (gen.uniDist(4)) {
+		case 0: return FormulaT(carl::FormulaType::NOT, random_formula(gen, atoms, depth - 1));
+		case 1: return FormulaT(carl::FormulaType::IFF, random_formula(gen, atoms, depth - 1), random_formula(gen, atoms, depth - 1));
+		case 2: return FormulaT(carl::FormulaType::AND, random_formula(gen, atoms, depth - 1), random_formula(gen, atoms, depth - 1), random_formula(gen, atoms, depth - 1));
+		default: return FormulaT(carl::FormulaType::OR, random_formula(gen, atoms, depth - 1), random_formula(gen, atoms, depth - 1), random_formula(gen, atoms, depth - 1));
+	}
+}
+
+static std::vector<MVP> random_polynomials(const RandomGenerator& gen, std::size_t n) {
+	std::vector<MVP> res;
+	for (std::size_t i = 0; i < n; ++i) {
+		res.push_back(gen.polynomial(4, 2));
+	}
+	return res;
+}
+
+/// Creates constraints, i.e. normalizes polynomials and looks them up in the constraint and formula pools.
+static void Formula_Constraints(benchmark::State& state) {
+	RandomGenerator gen(4);
+	auto polys = random_polynomials(gen, static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state) {
+		for (const auto& p: polys) {
+			benchmark::DoNotOptimize(FormulaT(carl::Constraint<MVP>(p, carl::Relation::LEQ)));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Formula_Constraints)->Arg(16)->Arg(256);
+
+/// Creates random formulas of the given depth over 32 constraints.
+static void Formula_Construct(benchmark::State& state) {
+	RandomGenerator gen(4);
+	std::vector<FormulaT> atoms;
+	for (const auto& p: random_polynomials(gen, 32)) atoms.emplace_back(carl::Constraint<MVP>(p, carl::Relation::LESS));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(random_formula(gen, atoms, static_cast<std::size_t>(state.range(0))));
+	}
+}
+BENCHMARK(Formula_Construct)->Arg(2)->Arg(4)->Arg(6);
+
+static void Formula_CNF(benchmark::State& state) {
+	RandomGenerator gen(4);
+	std::vector<FormulaT> atoms;
+	for (const auto& p: random_polynomials(gen, 32)) atoms.emplace_back(carl::Constraint<MVP>(p, carl::Relation::LESS));
+	std::vector<FormulaT> formulas;
+	for (std::size_t i = 0; i < 16; ++i) {
+		formulas.push_back(random_formula(gen, atoms, static_cast<std::size_t>(state.range(0))));
+	}
+	for (auto _ : state) {
+		for (const auto& f: formulas) {
+			benchmark::DoNotOptimize(carl::to_cnf(f));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(formulas.size()));
+}
+BENCHMARK(Formula_CNF)->Arg(2)->Arg(4)->Arg(5);
@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include <carl-arith/groebner/groebner.h>
+
+#include "Generators.h"
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+
+template<template<typename, template<typename> class> class Procedure, typename Input>
+static void compute_gb(benchmark::State& state, Input&& input) {
+	std::size_t size = 0;
+	for (auto _ : state) {
+		carl::GBProcedure<MVP, Procedure, carl::StdAdding> gb;
+		for (const auto& p: input) gb.addPolynomial(p);
+		gb.reduceInput();
+		gb.calculate();
+		size = gb.getIdeal().nrGenerators();
+	}
+	state.counters["basis"] = static_cast<double>(size);
+}
+
+/// The cyclic n-roots problem.
+static std::vector<MVP> cyclic(std::size_t n) {
+	RandomGenerator gen(n);
+	std::vector<MVP> input;
+	for (std::size_t d = 1; d < n; ++d) {
+		MVP p;
+		for (std::size_t i = 0; i < n; ++i) {
+			MVP t(mpq_class(1));
+			for (std::size_t j = 0; j < d; ++j) t *= gen.variable((i + j) % n);
+			p += t;
+		}
+		input.push_back(p);
+	}
+	MVP last(mpq_class(1));
+	for (std::size_t i = 0; i < n; ++i) last *= gen.variable(i);
+	input.push_back(last - MVP(mpq_class(1)));
+	return input;
+}
+
+/// As many random quadratic polynomials as variables.
+static std::vector<MVP> random_quadratic(std::size_t n) {
+	RandomGenerator gen(n);
+	std::vector<MVP> input;
+	for (std::size_t i = 0; i < n; ++i) {
+		input.push_back(gen.polynomial(2 * n + 2, 2, 4));
+	}
+	return input;
+}
+
+static void GB_Cyclic(benchmark::State& state) {
+	compute_gb<carl::Buchberger>(state, cyclic(static_cast<std::size_t>(state.range(0))));
+}
+BENCHMARK(GB_Cyclic)->Arg(3)->Arg(4)->Unit(benchmark::kMillisecond);
+
+static void GB_Cyclic_Signature(benchmark::State& state) {
+	compute_gb<carl::SignatureGB>(state, cyclic(static_cast<std::size_t>(state.range(0))));
+}
+BENCHMARK(GB_Cyclic_Signature)->Arg(3)->Arg(4)->Unit(benchmark::kMillisecond);
+
+static void GB_Random_Quadratic(benchmark::State& state) {
+	compute_gb<carl::Buchberger>(state, random_quadratic(static_cast<std::size_t>(state.range(0))));
+}
+BENCHMARK(GB_Random_Quadratic)->Arg(2)->Arg(3)->Unit(benchmark::kMillisecond);
+
+static void GB_Random_Quadratic_Signature(benchmark::State& state) {
+	compute_gb<carl::SignatureGB>(state, random_quadratic(static_cast<std::size_t>(state.range(0))));
+}
+BENCHMARK(GB_Random_Quadratic_Signature)->Arg(2)->Arg(3)->Unit(benchmark::kMillisecond);
+
+/// Reduction of a random polynomial modulo an ideal of long random polynomials.
+template<template<class> class Datastructure>
+static void reduce(benchmark::State& state) {
+	auto n = static_cast<std::size_t>(state.range(0));
+	RandomGenerator gen(4);
+	carl::Ideal<MVP> ideal;
+	for (std::size_t i = 0; i < 4; ++i) {
+		ideal.addGenerator(gen.polynomial(n, 4).normalize());
+	}
+	auto p = gen.polynomial(n, 8);
+	for (auto _ : state) {
+		carl::Reductor<MVP, MVP, Datastructure> reductor(ideal, p);
+		benchmark::DoNotOptimize(reductor.fullReduce());
+	}
+}
+
+static void GB_Reduce_Heap(benchmark::State& state) {
+	reduce<carl::Heap>(state);
+}
+BENCHMARK(GB_Reduce_Heap)->RangeMultiplier(4)->Range(4, 256);
+
+static void GB_Reduce_Geobucket(benchmark::State& state) {
+	reduce<carl::ReductorGeobucket>(state);
+}
+BENCHMARK(GB_Reduce_Geobucket)->RangeMultiplier(4)->Range(4, 256);
@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <carl-io/DIMACSImporter.h>
+#include <carl-io/DIMACSReader.h>
+#include <carl-io/OPBImporter.h>
+#include <carl-io/OPBReader.h>
+#include <carl-io/SMTLIBReader.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+using Poly = carl::MultivariatePolynomial<mpq_class>;
+
+/// Writes random DIMACS, OPB and SMT-LIB files of a few megabytes. Throughput is reported as bytes per second.
+class Importers_Fixture: public benchmark::Fixture {
+public:
+	std::string dimacs;
+	std::string opb;
+	std::string smtlib;
+
+	void SetUp(const benchmark::State&) override {
+		auto dir = std::filesystem::temp_directory_path();
+		dimacs = (dir / "carl-benchmark.cnf").string();
+		opb = (dir / "carl-benchmark.opb").string();
+		smtlib = (dir / "carl-benchmark.smt2").string();
+		std::mt19937 rng(42);
+		std::uniform_int_distribution<long long> var(1, 100000);
+		std::uniform_int_distribution<int> coeff(-20, 20);
+		{
+			std::ofstream out(dimacs);
+			out << "c random 3-SAT\np cnf 100000 400000\n";
+			for (int i = 0; i < 400000; ++i) {
+				for (int j = 0; j < 3; ++j) out << (coeff(rng) < 0 ? -var(rng) : var(rng)) << " ";
+				out << "0\n";
+			}
+		}
+		{
+			std::ofstream out(opb);
+			out << "* random pseudo-boolean problem\nmin: +1 x1 -1 x2 ;\n";
+			for (int i = 0; i < 100000; ++i) {
+				for (int j = 0; j < 4; ++j) out << "+" << (coeff(rng) + 21) << " x" << (var(rng) % 1000) << " ";
+				out << ">= " << coeff(rng) << " ;\n";
+			}
+		}
+		{
+			std::ofstream out(smtlib);
+			out << "(set-logic QF_NRA)\n";
+			for (int i = 0; i < 100; ++i) out << "(declare-fun x" << i << " () Real)\n";
+			for (int i = 0; i < 20000; ++i) {
+				auto v = [&rng](){ return "x" + std::to_string(std::uniform_int_distribution<int>(0, 99)(rng)); };
+				out << "(assert (let ((s (+ (* " << v() << " " << v() << ") " << coeff(rng) + 21 << ".5))) (or (< s " << v() << ") (>= (* s " << v() << ") " << v() << "))))\n";
+			}
+			out << "(check-sat)\n";
+		}
+	}
+	void TearDown(const benchmark::State&) override {
+		std::remove(dimacs.c_str());
+		std::remove(opb.c_str());
+		std::remove(smtlib.c_str());
+	}
+};
+
+BENCHMARK_F(Importers_Fixture, DIMACS_Reader)(benchmark::State& state) {
+	std::size_t bytes = 0;
+	for (auto _ : state) {
+		carl::io::DIMACSReader reader(dimacs);
+		std::vector<long long> literals;
+		std::size_t sum = 0;
+		while (reader.next_clause(literals)) sum += literals.size();
+		benchmark::DoNotOptimize(sum);
+		bytes += reader.bytes();
+	}
+	state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+
+BENCHMARK_F(Importers_Fixture, DIMACS_Importer)(benchmark::State& state) {
+	for (auto _ : state) {
+		carl::io::DIMACSImporter<Poly> importer(dimacs);
+		benchmark::DoNotOptimize(importer.next());
+	}
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(dimacs)));
+}
+
+BENCHMARK_F(Importers_Fixture, OPB_Reader)(benchmark::State& state) {
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::io::parseOPBFile(opb));
+	}
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(opb)));
+}
+
+BENCHMARK_F(Importers_Fixture, OPB_Spirit)(benchmark::State& state) {
+	for (auto _ : state) {
+		std::ifstream in(opb);
+		benchmark::DoNotOptimize(carl::io::parseOPBFile(in));
+	}
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(opb)));
+}
+
+BENCHMARK_F(Importers_Fixture, SMTLIB_Reader)(benchmark::State& state) {
+	for (auto _ : state) {
+		carl::io::SMTLIBReader<Poly> reader(smtlib);
+		while (reader.next());
+		benchmark::DoNotOptimize(reader.formula());
+	}
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(smtlib)));
+}
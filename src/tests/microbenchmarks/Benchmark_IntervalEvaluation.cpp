@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <carl-arith/interval/FastDoubleInterval.h>
+#include <carl-arith/poly/umvpoly/MultivariatePolynomial.h>
+#include <carl-arith/poly/umvpoly/functions/AffineEvaluation.h>
+#include <carl-arith/poly/umvpoly/functions/IntervalBatchEvaluation.h>
+#include <carl-arith/poly/umvpoly/functions/IntervalEvaluation.h>
+#include <carl-arith/poly/umvpoly/functions/horner/HornerForm.h>
+#include <carl-arith/numbers/numbers.h>
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+using DInterval = carl::Interval<double>;
+
+class IntervalEvaluation_Fixture: public benchmark::Fixture {
+public:
+    carl::Variable x = carl::fresh_real_variable("x");
+    carl::Variable y = carl::fresh_real_variable("y");
+    carl::Variable z = carl::fresh_real_variable("z");
+    MVP p;
+    std::vector<std::map<carl::Variable, DInterval>> boxes;
+
+    void SetUp(const benchmark::State&) override {
+        p = MVP(x)*x*x*y + MVP(x)*y*y*z - MVP(mpq_class(3))*y*z*z + MVP(x)*z + MVP(mpq_class(7));
+        boxes.clear();
+        for (int i = 0; i < 1024; ++i) {
+            double c = 0.01 * (i % 200) - 1;
+            boxes.push_back({{x, DInterval(c, c + 0.1)}, {y, DInterval(-c, 1.0)}, {z, DInterval(c - 0.5, c)}});
+        }
+    }
+};
+
+BENCHMARK_F(IntervalEvaluation_Fixture, Evaluate_PerBox)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (const auto& box: boxes) {
+            benchmark::DoNotOptimize(carl::evaluate(p, box));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(boxes.size()));
+}
+
+BENCHMARK_F(IntervalEvaluation_Fixture, Horner_Rebuild)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (const auto& box: boxes) {
+            benchmark::DoNotOptimize(carl::evaluate(carl::MultivariateHorner<MVP, carl::strategy>(p), box));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(boxes.size()));
+}
+
+BENCHMARK_F(IntervalEvaluation_Fixture, Horner_Cached)(benchmark::State& state) {
+    auto form = carl::horner_form(p);
+    carl::HornerForm<MVP>::Workspace ws;
+    for (auto _ : state) {
+        for (const auto& box: boxes) {
+            benchmark::DoNotOptimize(form->evaluate(box, ws));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(boxes.size()));
+}
+
+/// Reports time per evaluation and the average width of the enclosures.
+template<typename F>
+static void evaluate_with_width(benchmark::State& state, const std::vector<std::map<carl::Variable, DInterval>>& boxes, F&& f) {
+    for (auto _ : state) {
+        for (const auto& box: boxes) {
+            benchmark::DoNotOptimize(f(box));
+        }
+    }
+    double width = 0;
+    for (const auto& box: boxes) {
+        width += f(box).diameter();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(boxes.size()));
+    state.counters["width"] = width / static_cast<double>(boxes.size());
+}
+
+BENCHMARK_F(IntervalEvaluation_Fixture, Width_Interval)(benchmark::State& state) {
+    evaluate_with_width(state, boxes, [this](const auto& box) { return carl::evaluate(p, box); });
+}
+
+BENCHMARK_F(IntervalEvaluation_Fixture, Width_Affine)(benchmark::State& state) {
+    evaluate_with_width(state, boxes, [this](const auto& box) { return carl::evaluate_affine(p, box); });
+}
+
+BENCHMARK_F(IntervalEvaluation_Fixture, Width_Tight)(benchmark::State& state) {
+    evaluate_with_width(state, boxes, [this](const auto& box) { return carl::evaluate_tight(p, box); });
+}
+
+BENCHMARK_F(IntervalEvaluation_Fixture, Evaluate_Batch)(benchmark::State& state) {
+    carl::IntervalBatchEvaluator eval(p, {x, y, z});
+    auto batch = eval.make_batch(boxes);
+    carl::IntervalBatchEvaluator::Batch result;
+    carl::IntervalBatchEvaluator::Workspace ws;
+    for (auto _ : state) {
+        eval.evaluate(batch, result, ws);
+        benchmark::DoNotOptimize(result.upper[0].data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(boxes.size()));
+}
+
+template<typename I>
+static void Interval_Arithmetic(benchmark::State& state) {
+    std::vector<I> values;
+    for (int i = 0; i < 256; ++i) {
+        values.emplace_back(0.01 * i - 1.3, 0.02 * i + 0.1);
+    }
+    for (auto _ : state) {
+        for (std::size_t i = 1; i < values.size(); ++i) {
+            benchmark::DoNotOptimize(values[i-1] * values[i] + values[i] - values[i-1] * values[i-1]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+}
+BENCHMARK_TEMPLATE(Interval_Arithmetic, DInterval);
+BENCHMARK_TEMPLATE(Interval_Arithmetic, carl::FastDoubleInterval);
@@ -0,0 +1,45 @@
+#include <benchmark/benchmark.h>
+
+#include <carl-logging/logging.h>
+#include <carl-logging/logging-internals.h>
+
+#include <cstdio>
+
+/// Checks the visibility of a disabled message by resolving the channel for every call.
+static void Logging_Visible_Uncached(benchmark::State& state) {
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::logging::visible(carl::logging::LogLevel::LVL_DEBUG, "carl.core.intervalevaluation"));
+	}
+}
+BENCHMARK(Logging_Visible_Uncached);
+
+/// Checks the visibility of a disabled message with a cached call site.
+static void Logging_Visible_CallSite(benchmark::State& state) {
+	static carl::logging::CallSite site;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(site.visible(carl::logging::LogLevel::LVL_DEBUG, "carl.core.intervalevaluation"));
+	}
+}
+BENCHMARK(Logging_Visible_CallSite);
+
+/// Logs enabled messages to a file, either directly or through an AsyncSink.
+static void Logging_File(benchmark::State& state) {
+	auto sink = std::make_shared<carl::logging::FileSink>("carl-benchmark.log");
+	std::shared_ptr<carl::logging::AsyncSink> async;
+	if (state.range(0)) {
+		async = std::make_shared<carl::logging::AsyncSink>(sink);
+		carl::logging::logger().configure("benchmark", async);
+	} else {
+		carl::logging::logger().configure("benchmark", sink);
+	}
+	carl::logging::logger().filter("benchmark")("", carl::logging::LogLevel::LVL_OFF)("carl.benchmark", carl::logging::LogLevel::LVL_INFO);
+	carl::logging::logger().resetFormatter();
+	int i = 0;
+	for (auto _ : state) {
+		__CARL_LOG_INFO("carl.benchmark", "message " << ++i);
+	}
+	if (async) async->flush();
+	carl::logging::logger().filter("benchmark")("carl.benchmark", carl::logging::LogLevel::LVL_OFF);
+	std::remove("carl-benchmark.log");
+}
+BENCHMARK(Logging_File)->Arg(0)->Arg(1);
@@ -1,8 +1,18 @@
 #include <benchmark/benchmark.h>
 
 #include <carl-arith/poly/umvpoly/MultivariatePolynomial.h>
+#include <carl-arith/poly/umvpoly/functions/Derivative.h>
+#include <carl-arith/poly/umvpoly/functions/Division.h>
+#include <carl-arith/poly/umvpoly/functions/Evaluation.h>
+#include <carl-arith/poly/umvpoly/functions/Factorization_univariate.h>
+#include <carl-arith/poly/umvpoly/functions/GCD.h>
+#include <carl-arith/poly/umvpoly/functions/ParallelMultiplication.h>
+#include <carl-arith/poly/umvpoly/functions/Power.h>
+#include <carl-arith/poly/umvpoly/functions/Resultant.h>
 #include <carl-arith/numbers/numbers.h>
 
+#include "Generators.h"
+
 using MVP = carl::MultivariatePolynomial<mpq_class>;
 
 class MVP_Add_Fixture: public benchmark::Fixture {
@@ -26,3 +36,129 @@ BENCHMARK_F(MVP_Add_Fixture, MVP_Add_alt)(benchmark::State& state) {
         benchmark::DoNotOptimize(MVP(p) += (q));
     }
 }
+
+/// Arguments: number of terms of the operands.
+static void PolynomialSizes(benchmark::internal::Benchmark* b) {
+    b->RangeMultiplier(4)->Range(4, 256);
+}
+
+static void Monomial_Create(benchmark::State& state) {
+    RandomGenerator gen(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < 64; ++i) {
+            benchmark::DoNotOptimize(gen.monomial(8));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+BENCHMARK(Monomial_Create)->Arg(2)->Arg(8)->Arg(32);
+
+static void MVP_Add_Random(benchmark::State& state) {
+    RandomGenerator gen(4);
+    auto p = gen.polynomial(static_cast<std::size_t>(state.range(0)), 6);
+    auto q = gen.polynomial(static_cast<std::size_t>(state.range(0)), 6);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(p + q);
+    }
+}
+BENCHMARK(MVP_Add_Random)->Apply(PolynomialSizes);
+
+static void MVP_Mul_Random(benchmark::State& state) {
+    RandomGenerator gen(4);
+    auto p = gen.polynomial(static_cast<std::size_t>(state.range(0)), 6);
+    auto q = gen.polynomial(static_cast<std::size_t>(state.range(0)), 6);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(p * q);
+    }
+}
+BENCHMARK(MVP_Mul_Random)->Apply(PolynomialSizes);
+
+/// Arguments: number of terms of the operands, number of threads.
+static void MVP_Mul_Parallel(benchmark::State& state) {
+    RandomGenerator gen(4);
+    auto p = gen.polynomial(static_cast<std::size_t>(state.range(0)), 6);
+    auto q = gen.polynomial(static_cast<std::size_t>(state.range(0)), 6);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(carl::parallel_multiply(p, q, static_cast<std::size_t>(state.range(1)), 0));
+    }
+}
+BENCHMARK(MVP_Mul_Parallel)->ArgsProduct({{64, 256, 1024}, {1, 2, 4}})->UseRealTime();
+
+static void MVP_Pow(benchmark::State& state) {
+    RandomGenerator gen(4);
+    auto p = gen.polynomial(8, 4);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(carl::pow(p, static_cast<std::size_t>(state.range(0))));
+    }
+}
+BENCHMARK(MVP_Pow)->Arg(4)->Arg(8)->Arg(16)->UseRealTime();
+
+static void MVP_Div_Random(benchmark::State& state) {
+    RandomGenerator gen(4);
+    auto q = gen.polynomial(static_cast<std::size_t>(state.range(0)), 6);
+    auto p = q * gen.polynomial(static_cast<std::size_t>(state.range(0)), 6) + gen.polynomial(8, 6);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(carl::divide(p, q));
+    }
+}
+BENCHMARK(MVP_Div_Random)->RangeMultiplier(4)->Range(4, 64);
+
+static void MVP_GCD_Random(benchmark::State& state) {
+    RandomGenerator gen(3);
+    auto g = gen.polynomial(static_cast<std::size_t>(state.range(0)), 3);
+    auto p = g * gen.polynomial(static_cast<std::size_t>(state.range(0)), 3);
+    auto q = g * gen.polynomial(static_cast<std::size_t>(state.range(0)), 3);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(carl::gcd(p, q));
+    }
+}
+BENCHMARK(MVP_GCD_Random)->Arg(2)->Arg(4)->Arg(8);
+
+static void UVP_Resultant_Random(benchmark::State& state) {
+    RandomGenerator gen(3);
+    auto x = gen.variable(0);
+    auto degree = static_cast<std::size_t>(state.range(0));
+    auto p = carl::to_univariate_polynomial(gen.polynomial(3 * degree, degree) + carl::pow(MVP(x), degree), x);
+    auto q = carl::to_univariate_polynomial(gen.polynomial(3 * degree, degree) + carl::pow(MVP(x), degree), x);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(carl::resultant(p, q));
+    }
+}
+BENCHMARK(UVP_Resultant_Random)->Arg(2)->Arg(3)->Arg(4);
+
+static void UVP_Factorization_Random(benchmark::State& state) {
+    RandomGenerator gen(1);
+    auto x = gen.variable(0);
+    // A product of small factors, some of them repeated.
+    carl::UnivariatePolynomial<mpq_class> p(x, mpq_class(1));
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        auto f = gen.univariate(x, 1 + gen.uniDist(3), 4);
+        p *= f;
+        if (i % 3 == 0) p *= f;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(carl::factorization(p));
+    }
+}
+BENCHMARK(UVP_Factorization_Random)->Arg(2)->Arg(4)->Arg(8);
+
+static void UVP_Evaluate_Sparse(benchmark::State& state) {
+    RandomGenerator gen(1);
+    auto x = gen.variable(0);
+    auto p = gen.sparse_univariate(x, static_cast<std::size_t>(state.range(0)), 8);
+    mpq_class value(3, 2);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(carl::evaluate(p, value));
+    }
+}
+BENCHMARK(UVP_Evaluate_Sparse)->RangeMultiplier(16)->Range(16, 4096);
+
+static void UVP_Derivative_Sparse(benchmark::State& state) {
+    RandomGenerator gen(1);
+    auto x = gen.variable(0);
+    auto p = gen.sparse_univariate(x, static_cast<std::size_t>(state.range(0)), 8);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(carl::derivative(p));
+    }
+}
+BENCHMARK(UVP_Derivative_Sparse)->RangeMultiplier(16)->Range(16, 4096);
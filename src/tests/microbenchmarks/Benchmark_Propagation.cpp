@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+
+#include <carl-arith/intervalcontraction/Propagator.h>
+#include <carl-arith/numbers/numbers.h>
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+using Constr = carl::BasicConstraint<MVP>;
+
+class Propagation_Fixture: public benchmark::Fixture {
+public:
+    std::vector<carl::Variable> vars;
+    std::vector<Constr> constraints;
+    std::vector<std::vector<carl::Interval<double>>> boxes;
+
+    void SetUp(const benchmark::State& state) override {
+        std::size_t n = static_cast<std::size_t>(state.range(0));
+        vars.clear();
+        constraints.clear();
+        boxes.clear();
+        for (std::size_t i = 0; i < n; ++i) {
+            vars.push_back(carl::fresh_real_variable("x" + std::to_string(i)));
+        }
+        // x_{i+1} = x_i^2 - 1 and x_i + x_{i+1} <= 1
+        MVP sum;
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+            constraints.emplace_back(MVP(vars[i+1]) - MVP(vars[i])*vars[i] + MVP(mpq_class(1)), carl::Relation::EQ);
+            constraints.emplace_back(MVP(vars[i]) + vars[i+1] - MVP(mpq_class(1)), carl::Relation::LEQ);
+            sum += vars[i];
+        }
+        constraints.emplace_back(sum, carl::Relation::GEQ);
+        for (int k = 0; k < 64; ++k) {
+            double w = 0.5 + 0.05 * k;
+            boxes.emplace_back(n, carl::Interval<double>(-w, w + 1));
+        }
+    }
+};
+
+BENCHMARK_DEFINE_F(Propagation_Fixture, Propagate)(benchmark::State& state) {
+    carl::contractor::Propagator<MVP> prop;
+    for (const auto& c: constraints) prop.add(c);
+    for (auto _ : state) {
+        for (const auto& b: boxes) {
+            auto box = prop.to_box({});
+            for (std::size_t i = 0; i < vars.size(); ++i) {
+                box[i] = b[i];
+            }
+            benchmark::DoNotOptimize(prop.propagate(box));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(boxes.size()));
+    state.counters["revisions"] = benchmark::Counter(static_cast<double>(prop.revisions()), benchmark::Counter::kIsRate);
+}
+BENCHMARK_REGISTER_F(Propagation_Fixture, Propagate)->Arg(4)->Arg(16)->Arg(64);
@@ -3,6 +3,8 @@
 
 #include <carl-arith/ran/ran.h>
 
+#include "Generators.h"
+
 using Poly = carl::UnivariatePolynomial<mpq_class>;
 
 class RAN_Fixture: public benchmark::Fixture {
@@ -39,3 +41,26 @@ BENCHMARK_F(RAN_Fixture, RAN_CreateRefineNew)(benchmark::State& state) {
 		ran.refine();
 	}
 }
+
+BENCHMARK_DEFINE_F(RAN_Fixture, RAN_Compare_Random)(benchmark::State& state) {
+	RandomGenerator gen(1);
+	// All roots of two products of random quadratic factors a*x^2 - b, which are irrational in general.
+	std::vector<carl::IntRepRealAlgebraicNumber<mpq_class>> rans;
+	for (int i = 0; i < 2; ++i) {
+		Poly q(gen.variable(0), mpq_class(1));
+		for (std::int64_t j = 0; j < state.range(0); ++j) {
+			q *= Poly(gen.variable(0), {-carl::abs(gen.coefficient(8)), mpq_class(0), carl::abs(gen.coefficient(4))});
+		}
+		auto roots = carl::real_roots(q).roots();
+		rans.insert(rans.end(), roots.begin(), roots.end());
+	}
+	for (auto _ : state) {
+		for (const auto& a: rans) {
+			for (const auto& b: rans) {
+				benchmark::DoNotOptimize(a < b);
+			}
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(rans.size() * rans.size()));
+}
+BENCHMARK_REGISTER_F(RAN_Fixture, RAN_Compare_Random)->Arg(2)->Arg(4)->Arg(8);
@@ -3,6 +3,8 @@
 
 #include <carl-arith/ran/ran.h>
 
+#include "Generators.h"
+
 using Poly = carl::UnivariatePolynomial<mpq_class>;
 
 class RF_Fixture: public benchmark::Fixture {	
@@ -46,3 +48,25 @@ BENCHMARK_F(RF_Fixture, Real_Roots_2)(benchmark::State& state) {
 
 
 
+
+BENCHMARK_DEFINE_F(RF_Fixture, Real_Roots_Random)(benchmark::State& state) {
+	RandomGenerator gen(1);
+	// Products of linear factors have only real roots, which are all isolated and refined.
+	Poly p(gen.variable(0), mpq_class(1));
+	for (std::int64_t i = 0; i < state.range(0); ++i) {
+		p *= Poly(gen.variable(0), {gen.coefficient(8), gen.coefficient(4)});
+	}
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::real_roots(p, carl::Interval<mpq_class>::unbounded_interval()));
+	}
+}
+BENCHMARK_REGISTER_F(RF_Fixture, Real_Roots_Random)->Arg(2)->Arg(4)->Arg(8)->Arg(16);
+
+BENCHMARK_DEFINE_F(RF_Fixture, Real_Roots_Random_Dense)(benchmark::State& state) {
+	RandomGenerator gen(1);
+	auto p = gen.univariate(gen.variable(0), static_cast<std::size_t>(state.range(0)), 16);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::real_roots(p, carl::Interval<mpq_class>::unbounded_interval()));
+	}
+}
+BENCHMARK_REGISTER_F(RF_Fixture, Real_Roots_Random_Dense)->Arg(4)->Arg(8)->Arg(16);
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <carl-common/datastructures/SmallBitset.h>
+#include <carl-covering/carl-covering.h>
+
+#include <random>
+
+using carl::covering::SetCover;
+
+static SetCover random_set_cover(std::size_t sets, std::size_t elements, std::size_t per_set) {
+	std::mt19937 rng(42);
+	std::uniform_int_distribution<std::size_t> dist(0, elements - 1);
+	SetCover sc;
+	for (std::size_t e = 0; e < elements; ++e) {
+		sc.set(e % sets, e);
+	}
+	for (std::size_t s = 0; s < sets; ++s) {
+		for (std::size_t i = 0; i < per_set; ++i) {
+			sc.set(s, dist(rng));
+		}
+	}
+	return sc;
+}
+
+static void SetCover_Greedy(benchmark::State& state) {
+	auto sets = static_cast<std::size_t>(state.range(0));
+	SetCover base = random_set_cover(sets, 4 * sets, 8);
+	for (auto _ : state) {
+		SetCover sc = base;
+		benchmark::DoNotOptimize(carl::covering::heuristic::greedy(sc));
+	}
+	state.SetComplexityN(state.range(0));
+}
+BENCHMARK(SetCover_Greedy)->RangeMultiplier(4)->Range(64, 4096)->Complexity();
+
+static void SetCover_Construct(benchmark::State& state) {
+	auto sets = static_cast<std::size_t>(state.range(0));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(random_set_cover(sets, 4 * sets, 8));
+	}
+}
+BENCHMARK(SetCover_Construct)->RangeMultiplier(4)->Range(64, 4096);
+
+static void SetCover_RemoveDuplicates(benchmark::State& state) {
+	auto sets = static_cast<std::size_t>(state.range(0));
+	SetCover base = random_set_cover(sets, 4 * sets, 8);
+	for (auto _ : state) {
+		SetCover sc = base;
+		benchmark::DoNotOptimize(carl::covering::heuristic::remove_duplicates(sc));
+	}
+}
+BENCHMARK(SetCover_RemoveDuplicates)->RangeMultiplier(4)->Range(64, 4096);
+
+/// Typical bitset operations of covering heuristics on many small sets.
+template<typename B>
+static void Bitset_Covering(benchmark::State& state) {
+	auto bits = static_cast<std::size_t>(state.range(0));
+	std::mt19937 rng(42);
+	std::uniform_int_distribution<std::size_t> dist(0, bits - 1);
+	std::vector<B> sets(256);
+	for (auto& s: sets) {
+		for (int i = 0; i < 6; ++i) s.set(dist(rng));
+	}
+	for (auto _ : state) {
+		B uncovered;
+		std::size_t sum = 0;
+		for (const auto& s: sets) {
+			B copy = s;
+			if (!copy.is_subset_of(uncovered)) uncovered |= copy;
+			for (auto e: copy) sum += e;
+			sum += (copy & uncovered).count();
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(sets.size()));
+}
+BENCHMARK_TEMPLATE(Bitset_Covering, carl::Bitset)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK_TEMPLATE(Bitset_Covering, carl::SmallBitset<>)->Arg(64)->Arg(256)->Arg(1024);
@@ -0,0 +1,42 @@
+#include <benchmark/benchmark.h>
+
+#include <carl-statistics/Counter.h>
+#include <carl-statistics/Series.h>
+#include <carl-statistics/Sharded.h>
+
+using namespace carl::statistics;
+
+static Counter shared_counter;
+static Sharded<Counter> sharded_counter;
+static Series shared_series;
+static Sharded<Series> sharded_series;
+
+static void Statistics_Counter_Shared(benchmark::State& state) {
+	for (auto _ : state) {
+		shared_counter.inc();
+	}
+}
+BENCHMARK(Statistics_Counter_Shared)->ThreadRange(1, 8);
+
+static void Statistics_Counter_Sharded(benchmark::State& state) {
+	for (auto _ : state) {
+		sharded_counter.local().inc();
+	}
+}
+BENCHMARK(Statistics_Counter_Sharded)->ThreadRange(1, 8);
+
+static void Statistics_Series_Shared(benchmark::State& state) {
+	std::size_t i = 0;
+	for (auto _ : state) {
+		shared_series.add(i++ % 1024);
+	}
+}
+BENCHMARK(Statistics_Series_Shared)->ThreadRange(1, 8);
+
+static void Statistics_Series_Sharded(benchmark::State& state) {
+	std::size_t i = 0;
+	for (auto _ : state) {
+		sharded_series.local().add(i++ % 1024);
+	}
+}
+BENCHMARK(Statistics_Series_Sharded)->ThreadRange(1, 8);
@@ -0,0 +1,19 @@
+#include <benchmark/benchmark.h>
+
+#include <carl-statistics/Tracing.h>
+
+using namespace carl::statistics::tracing;
+
+static void Tracing_Span(benchmark::State& state) {
+	auto& tracer = Tracer::getInstance();
+	tracer.set_enabled(state.range(0) != 0);
+	for (auto _ : state) {
+		Span span("benchmark", "span");
+		benchmark::ClobberMemory();
+		// Keep the buffer from filling up over many iterations.
+		if (tracer.local().size() >= ThreadBuffer::chunk_size * 64) tracer.local().clear();
+	}
+	tracer.set_enabled(true);
+	tracer.local().clear();
+}
+BENCHMARK(Tracing_Span)->Arg(0)->Arg(1);
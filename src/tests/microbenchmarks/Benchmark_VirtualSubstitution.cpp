@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <carl-arith/poly/umvpoly/MultivariatePolynomial.h>
+#include <carl-vs/substitute_parallel.h>
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+
+class VirtualSubstitution_Fixture: public benchmark::Fixture {
+public:
+    carl::Variable x = carl::fresh_real_variable("x");
+    carl::Variable y = carl::fresh_real_variable("y");
+    carl::Variable z = carl::fresh_real_variable("z");
+    carl::vs::ConstraintConjunction<MVP> constraints;
+    std::vector<carl::vs::Term<MVP>> candidates;
+
+    void SetUp(const benchmark::State&) override {
+        constraints.clear();
+        candidates.clear();
+        MVP px(x);
+        constraints.emplace_back(px*px*px*px*y - px*px*z + px*y*z - MVP(mpq_class(2)), carl::Relation::LESS);
+        constraints.emplace_back(px*px*px*z + px*px*y*y - MVP(y)*z, carl::Relation::GEQ);
+        constraints.emplace_back(px*px*px - px*y + MVP(z), carl::Relation::NEQ);
+        constraints.emplace_back(px*px*y + px*z*z - MVP(mpq_class(1)), carl::Relation::LEQ);
+        // the roots of y*x^2 + z*x - 1
+        MVP radicand = MVP(z)*z + MVP(mpq_class(4))*y;
+        candidates.push_back(carl::vs::Term<MVP>::normal(carl::SqrtEx<MVP>(-MVP(z), MVP(mpq_class(1)), MVP(mpq_class(2))*y, radicand)));
+        candidates.push_back(carl::vs::Term<MVP>::normal(carl::SqrtEx<MVP>(-MVP(z), MVP(mpq_class(-1)), MVP(mpq_class(2))*y, radicand)));
+        candidates.push_back(carl::vs::Term<MVP>::plus_eps(carl::SqrtEx<MVP>(-MVP(z), MVP(mpq_class(1)), MVP(mpq_class(2))*y, radicand)));
+        candidates.push_back(carl::vs::Term<MVP>::minus_infty());
+    }
+
+    /// Constraints must not outlive the constraint pool, which may be destroyed before the fixture.
+    void TearDown(const benchmark::State&) override {
+        constraints.clear();
+        candidates.clear();
+    }
+};
+
+/// Substitutes a single candidate, selected by the argument, into every constraint.
+BENCHMARK_DEFINE_F(VirtualSubstitution_Fixture, PerConstraint)(benchmark::State& state) {
+    const auto& term = candidates[static_cast<std::size_t>(state.range(0))];
+    for (auto _ : state) {
+        for (const auto& c: constraints) {
+            benchmark::DoNotOptimize(carl::vs::substitute(c, x, term));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(constraints.size()));
+}
+BENCHMARK_REGISTER_F(VirtualSubstitution_Fixture, PerConstraint)->DenseRange(0, 3);
+
+/// Same as PerConstraint, but all constraints share the powers of the square root expression.
+BENCHMARK_DEFINE_F(VirtualSubstitution_Fixture, SharedSubstitution)(benchmark::State& state) {
+    const auto& term = candidates[static_cast<std::size_t>(state.range(0))];
+    for (auto _ : state) {
+        carl::vs::detail::Substitution<MVP> subs(x, term);
+        for (const auto& c: constraints) {
+            benchmark::DoNotOptimize(carl::vs::substitute(c, subs));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(constraints.size()));
+}
+BENCHMARK_REGISTER_F(VirtualSubstitution_Fixture, SharedSubstitution)->DenseRange(0, 3);
+
+BENCHMARK_F(VirtualSubstitution_Fixture, Conjunction)(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(carl::vs::substitute_candidates(constraints, x, candidates, 1));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(candidates.size() * constraints.size()));
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <carl-arith/numbers/numbers.h>
+#include <carl-arith/poly/umvpoly/MultivariatePolynomial.h>
+#include <carl-arith/poly/umvpoly/UnivariatePolynomial.h>
+
+#include <map>
+#include <random>
+
+#include "../benchmarks/framework/BenchmarkGenerator.h"
+
+/**
+ * Generates reproducible random objects for the microbenchmarks.
+ *
+ * The generator is seeded explicitly and draws all numbers from its own engine, hence the same arguments yield the same objects in every run and in every version of carl.
+ * The sizes are given explicitly, such that benchmarks can be parameterised by them.
+ */
+class RandomGenerator: public carl::ObjectGenerator {
+public:
+	using Poly = carl::MultivariatePolynomial<mpq_class>;
+	using UPoly = carl::UnivariatePolynomial<mpq_class>;
+
+	explicit RandomGenerator(std::size_t variables, unsigned long seed = 4):
+		ObjectGenerator(carl::BenchmarkInformation(carl::BenchmarkSelection::Random, variables), seed)
+	{}
+
+	carl::Variable variable(std::size_t i) const {
+		return bi.variables[i];
+	}
+
+	/// Returns a nonzero integer with a random sign and at most the given number of bits.
+	mpq_class coefficient(std::size_t bits) const {
+		mpz_class res = 0;
+		for (std::size_t b = 0; b < bits; b += 16) {
+			std::size_t chunk = std::min<std::size_t>(16, bits - b);
+			res = (res << static_cast<mp_bitcnt_t>(chunk)) + static_cast<unsigned long>(uniDist(std::size_t(1) << chunk));
+		}
+		if (res == 0) res = 1;
+		return mpq_class(uniDist(2) == 0 ? res : mpz_class(-res));
+	}
+
+	/// Returns a monomial of a total degree between zero and the given degree.
+	carl::Monomial::Arg monomial(std::size_t degree) const {
+		carl::Monomial::Arg res;
+		for (std::size_t d = uniDist(degree + 1); d > 0; --d) {
+			res = res * randomVariable();
+		}
+		return res;
+	}
+
+	/// Returns a polynomial with at most the given number of terms, duplicate monomials are merged.
+	Poly polynomial(std::size_t terms, std::size_t degree, std::size_t bits = 8) const {
+		std::vector<carl::Term<mpq_class>> res;
+		res.reserve(terms);
+		for (std::size_t i = 0; i < terms; ++i) {
+			res.emplace_back(coefficient(bits), monomial(degree));
+		}
+		return Poly(std::move(res), true, false);
+	}
+
+	/// Returns a dense univariate polynomial of the given degree.
+	UPoly univariate(carl::Variable var, std::size_t degree, std::size_t bits = 8) const {
+		std::vector<mpq_class> coeffs;
+		coeffs.reserve(degree + 1);
+		for (std::size_t i = 0; i <= degree; ++i) {
+			coeffs.push_back(coefficient(bits));
+		}
+		return UPoly(var, std::move(coeffs));
+	}
+
+	/// Returns a univariate polynomial of the given degree with at most the given number of nonzero coefficients.
+	UPoly sparse_univariate(carl::Variable var, std::size_t degree, std::size_t terms, std::size_t bits = 8) const {
+		std::map<carl::uint, mpq_class> coeffs;
+		coeffs.emplace(degree, coefficient(bits));
+		for (std::size_t i = 1; i < terms; ++i) {
+			coeffs.emplace(uniDist(degree), coefficient(bits));
+		}
+		return UPoly(var, coeffs);
+	}
+};
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""
+Compares two JSON result files of runMicroBenchmarks and reports regressions.
+
+Create the result files with
+    runMicroBenchmarks --benchmark_out=result.json --benchmark_out_format=json --benchmark_repetitions=5
+or with the run-microbenchmarks target, then run
+    compare_benchmarks.py baseline.json contender.json [--threshold 0.1] [--metric cpu_time]
+
+If repetitions were used, the median of the repetitions is compared, otherwise the mean of all runs of a benchmark.
+The exit code is 1 if some benchmark got slower by more than the threshold, 0 otherwise.
+"""
+
+import argparse
+import json
+import statistics
+import sys
+
+UNITS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(filename, metric):
+    """Returns the time in nanoseconds per benchmark name."""
+    with open(filename) as f:
+        data = json.load(f)
+    medians = {}
+    runs = {}
+    for b in data["benchmarks"]:
+        if b.get("error_occurred"):
+            continue
+        name = b.get("run_name", b["name"])
+        value = b[metric] * UNITS[b.get("time_unit", "ns")]
+        if b.get("run_type") == "aggregate":
+            if b.get("aggregate_name") == "median":
+                medians[name] = value
+        else:
+            runs.setdefault(name, []).append(value)
+    result = {name: statistics.mean(values) for name, values in runs.items()}
+    result.update(medians)
+    return result, data.get("context", {})
+
+
+def format_time(ns):
+    for unit in ["s", "ms", "us"]:
+        if ns >= UNITS[unit]:
+            return "%.3f %s" % (ns / UNITS[unit], unit)
+    return "%.1f ns" % ns
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline")
+    parser.add_argument("contender")
+    parser.add_argument("--threshold", type=float, default=0.1, help="relative slowdown that counts as regression (default: 0.1)")
+    parser.add_argument("--metric", choices=["cpu_time", "real_time"], default="cpu_time")
+    args = parser.parse_args()
+
+    base, base_context = load(args.baseline, args.metric)
+    cont, cont_context = load(args.contender, args.metric)
+    for key in ["host_name", "num_cpus", "mhz_per_cpu", "library_build_type"]:
+        if base_context.get(key) != cont_context.get(key):
+            print("Warning: %s differs: %s vs. %s" % (key, base_context.get(key), cont_context.get(key)))
+
+    names = [n for n in base if n in cont]
+    width = max([len(n) for n in names] + [9])
+    print("%-*s %12s %12s %8s" % (width, "benchmark", "baseline", "contender", "change"))
+    regressions = []
+    for name in names:
+        change = cont[name] / base[name] - 1 if base[name] > 0 else 0.0
+        marker = ""
+        if change > args.threshold:
+            marker = "  REGRESSION"
+            regressions.append(name)
+        elif change < -args.threshold:
+            marker = "  improved"
+        print("%-*s %12s %12s %+7.1f%%%s" % (width, name, format_time(base[name]), format_time(cont[name]), 100 * change, marker))
+
+    for name in sorted(set(base) - set(cont)):
+        print("Only in baseline: %s" % name)
+    for name in sorted(set(cont) - set(base)):
+        print("Only in contender: %s" % name)
+
+    if regressions:
+        print("%d of %d benchmarks regressed by more than %.0f%%." % (len(regressions), len(names), 100 * args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())